@@ -0,0 +1,256 @@
+/* -*- Mode: C; c-basic-offset:4 ; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2026      The PRRTE contributors.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Measure the attribute traffic of mapping a large job without
+ * needing a large machine. For every proc, the simulated mapper
+ * queries a set of job and app attributes (some of which are not
+ * set, as most options aren't given), then sets and reads back a few
+ * proc attributes - the pattern the rmaps and binding code follow.
+ * The attributes are held two ways: on a plain list that every
+ * lookup scans (as prte_attribute_t lists used to be), and on a list
+ * with a table indexed by key over the object's block of keys once
+ * it holds more than a few entries (as prte_attr_list_t does). The
+ * two must see the same attributes. Reports procs mapped/sec for each.
+ *
+ * Usage: attrbench [-n <procs>] [-j <job attrs>] [-q <job queries/proc>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <sys/time.h>
+
+/* the key blocks from src/util/attr.h */
+#define APP_START_KEY       0
+#define APP_MAX_KEY       100
+#define JOB_START_KEY     200
+#define JOB_MAX_KEY       300
+#define PROC_START_KEY    300
+#define PROC_MAX_KEY      400
+
+#define INDEX_THRESHOLD     8
+
+typedef struct attr_t {
+    struct attr_t *next;
+    struct attr_t *prev;
+    uint16_t key;
+    int64_t value;
+} attr_t;
+
+typedef struct {
+    attr_t head;
+    size_t size;
+    int indexed;
+    uint16_t base;
+    uint16_t span;
+    attr_t **index;
+} attr_list_t;
+
+static int nprocs = 100000;
+static int njob = 30;
+static int nqueries = 12;
+
+static double get_time(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+}
+
+static void list_init(attr_list_t *l, int indexed, uint16_t base, uint16_t max)
+{
+    l->head.next = &l->head;
+    l->head.prev = &l->head;
+    l->size = 0;
+    l->indexed = indexed;
+    l->base = base;
+    l->span = max - base;
+    l->index = NULL;
+}
+
+static void list_destruct(attr_list_t *l)
+{
+    attr_t *kv, *next;
+
+    for (kv = l->head.next; kv != &l->head; kv = next) {
+        next = kv->next;
+        free(kv);
+    }
+    free(l->index);
+}
+
+static attr_t **slot(attr_list_t *l, uint16_t key)
+{
+    if (NULL == l->index || key < l->base || key >= l->base + l->span) {
+        return NULL;
+    }
+    return &l->index[key - l->base];
+}
+
+static attr_t *find(attr_list_t *l, uint16_t key)
+{
+    attr_t *kv, **s;
+
+    if (NULL != (s = slot(l, key))) {
+        return *s;
+    }
+    for (kv = l->head.next; kv != &l->head; kv = kv->next) {
+        if (key == kv->key) {
+            return kv;
+        }
+    }
+    return NULL;
+}
+
+static void append(attr_list_t *l, uint16_t key, int64_t value)
+{
+    attr_t *kv = (attr_t*)malloc(sizeof(attr_t)), **s;
+
+    kv->key = key;
+    kv->value = value;
+    kv->prev = l->head.prev;
+    kv->next = &l->head;
+    l->head.prev->next = kv;
+    l->head.prev = kv;
+    l->size++;
+
+    if (NULL != l->index) {
+        if (NULL != (s = slot(l, key)) && NULL == *s) {
+            *s = kv;
+        }
+    } else if (l->indexed && INDEX_THRESHOLD < l->size) {
+        l->index = (attr_t**)calloc(l->span, sizeof(attr_t*));
+        for (kv = l->head.next; kv != &l->head; kv = kv->next) {
+            if (NULL != (s = slot(l, kv->key)) && NULL == *s) {
+                *s = kv;
+            }
+        }
+    }
+}
+
+static void set(attr_list_t *l, uint16_t key, int64_t value)
+{
+    attr_t *kv;
+
+    if (NULL != (kv = find(l, key))) {
+        kv->value = value;
+        return;
+    }
+    append(l, key, value);
+}
+
+static int64_t map_job(int indexed, uint16_t *queries, double *elapsed)
+{
+    attr_list_t job, app, *procs;
+    attr_t *kv;
+    int64_t sum = 0;
+    double start;
+    int i, q;
+
+    list_init(&job, indexed, JOB_START_KEY, JOB_MAX_KEY);
+    list_init(&app, indexed, APP_START_KEY, APP_MAX_KEY);
+    procs = (attr_list_t*)malloc(nprocs * sizeof(attr_list_t));
+    /* the options given on the cmd line are spread across the block */
+    for (i = 0; i < njob; i++) {
+        append(&job, JOB_START_KEY + 1 + (i * 3) % (JOB_MAX_KEY - JOB_START_KEY - 1), i);
+    }
+    for (i = 0; i < 4; i++) {
+        append(&app, APP_START_KEY + 1 + i * 7, i);
+    }
+
+    start = get_time();
+    for (i = 0; i < nprocs; i++) {
+        list_init(&procs[i], indexed, PROC_START_KEY, PROC_MAX_KEY);
+        for (q = 0; q < nqueries; q++) {
+            if (NULL != (kv = find(&job, queries[q]))) {
+                sum += kv->value;
+            }
+        }
+        for (q = 0; q < 3; q++) {
+            if (NULL != (kv = find(&app, APP_START_KEY + 1 + q * 11))) {
+                sum += kv->value;
+            }
+        }
+        set(&procs[i], PROC_START_KEY + 2, i);
+        set(&procs[i], PROC_START_KEY + 5, i);
+        set(&procs[i], PROC_START_KEY + 9, i);
+        set(&procs[i], PROC_START_KEY + 2, i + 1);
+        if (NULL != (kv = find(&procs[i], PROC_START_KEY + 5))) {
+            sum += kv->value;
+        }
+        if (NULL != (kv = find(&procs[i], PROC_START_KEY + 7))) {
+            sum += kv->value;
+        }
+    }
+    *elapsed = get_time() - start;
+
+    for (i = 0; i < nprocs; i++) {
+        list_destruct(&procs[i]);
+    }
+    free(procs);
+    list_destruct(&job);
+    list_destruct(&app);
+    return sum;
+}
+
+int main(int argc, char **argv)
+{
+    int n;
+    uint16_t *queries;
+    int64_t slist, sindex;
+    double t, tlist, tindex;
+
+    for (n=1; n < argc; n++) {
+        if (0 == strcmp(argv[n], "-n") && n+1 < argc) {
+            nprocs = strtol(argv[++n], NULL, 10);
+        } else if (0 == strcmp(argv[n], "-j") && n+1 < argc) {
+            njob = strtol(argv[++n], NULL, 10);
+        } else if (0 == strcmp(argv[n], "-q") && n+1 < argc) {
+            nqueries = strtol(argv[++n], NULL, 10);
+        }
+    }
+    if (1 > nprocs || 0 > njob || JOB_MAX_KEY - JOB_START_KEY - 1 < njob || 0 > nqueries) {
+        fprintf(stderr, "Usage: %s [-n <procs>] [-j <job attrs>] [-q <job queries/proc>]\n", argv[0]);
+        return 1;
+    }
+
+    /* query a spread of keys - those not a multiple of 3 apart
+     * from the first were never set */
+    queries = (uint16_t*)malloc((nqueries + 1) * sizeof(uint16_t));
+    for (n = 0; n < nqueries; n++) {
+        queries[n] = JOB_START_KEY + 1 + (n * 5) % (JOB_MAX_KEY - JOB_START_KEY - 1);
+    }
+
+    /* alternate the two and keep the best of each so neither
+     * is penalized by the state of the allocator */
+    tlist = tindex = 1.0e9;
+    slist = sindex = 0;
+    for (n = 0; n < 5; n++) {
+        slist = map_job(0, queries, &t);
+        if (t < tlist) {
+            tlist = t;
+        }
+        sindex = map_job(1, queries, &t);
+        if (t < tindex) {
+            tindex = t;
+        }
+    }
+    free(queries);
+    if (slist != sindex) {
+        fprintf(stderr, "list and index disagree: %ld vs %ld\n", (long)slist, (long)sindex);
+        return 1;
+    }
+
+    fprintf(stderr, "%d procs, %d job attributes, %d job queries/proc\n", nprocs, njob, nqueries);
+    fprintf(stderr, "\tlist scan: %12.0f procs/sec\n", nprocs / tlist);
+    fprintf(stderr, "\tindexed:   %12.0f procs/sec\n", nprocs / tindex);
+    return 0;
+}
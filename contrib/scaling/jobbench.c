@@ -0,0 +1,237 @@
+/* -*- Mode: C; c-basic-offset:4 ; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2026      The PRRTE contributors.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Measure the cost of looking up a job by nspace as the number of
+ * jobs in a persistent DVM grows, without needing a large machine.
+ * For each job count, random nspaces are looked up first by scanning
+ * the job array and comparing every nspace (as
+ * prte_get_job_data_object used to do), then through an index keyed
+ * by nspace using the same open addressing scheme as
+ * prte_hash_table_t. The two must find the same job. Reports the
+ * cost of a lookup for each.
+ *
+ * Usage: jobbench [-m <max jobs>] [-l <lookups>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <sys/time.h>
+
+#define NSLEN 255
+
+typedef struct {
+    char nspace[NSLEN+1];
+    int index;
+} job_t;
+
+typedef struct {
+    int valid;
+    const void *key;
+    size_t key_size;
+    void *value;
+} elt_t;
+
+typedef struct {
+    elt_t *table;
+    size_t capacity;
+    size_t size;
+    size_t trigger;
+} index_t;
+
+static double get_time(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+}
+
+/* the old way - walk the array */
+static job_t *scan(job_t **jobs, int size, const char *nspace)
+{
+    int i;
+
+    for (i = 0; i < size; i++) {
+        if (NULL == jobs[i]) {
+            continue;
+        }
+        if (0 == strncmp(jobs[i]->nspace, nspace, NSLEN)) {
+            return jobs[i];
+        }
+    }
+    return NULL;
+}
+
+/* the index - the same scheme prte_hash_table_t uses for ptr keys */
+static uint64_t hash_key(const void *key, size_t key_size)
+{
+    const unsigned char *scanner = (const unsigned char*)key;
+    uint64_t hash = 0;
+    size_t ii;
+
+    for (ii = 0; ii < key_size; ii++) {
+        hash = 31 * hash + *scanner++;
+    }
+    return hash;
+}
+
+static size_t round_capacity_up(size_t capacity)
+{
+    return ((capacity + 29) / 30 * 30 + 1);
+}
+
+static void index_init(index_t *ix, size_t estimate)
+{
+    /* density of 1/2 */
+    ix->capacity = round_capacity_up(estimate * 2);
+    ix->table = (elt_t*)calloc(ix->capacity, sizeof(elt_t));
+    ix->size = 0;
+    ix->trigger = ix->capacity / 2;
+}
+
+static void index_insert(elt_t *table, size_t capacity, elt_t *elt)
+{
+    size_t ii;
+
+    for (ii = hash_key(elt->key, elt->key_size) % capacity; ; ii++) {
+        if (ii == capacity) {
+            ii = 0;
+        }
+        if (!table[ii].valid) {
+            table[ii] = *elt;
+            return;
+        }
+    }
+}
+
+static void index_set(index_t *ix, const char *nspace, void *value)
+{
+    elt_t elt, *table;
+    size_t capacity, jj;
+
+    elt.valid = 1;
+    elt.key = nspace;
+    elt.key_size = strnlen(nspace, NSLEN);
+    elt.value = value;
+    index_insert(ix->table, ix->capacity, &elt);
+    if (++ix->size < ix->trigger) {
+        return;
+    }
+    /* grow by 2/1 */
+    capacity = round_capacity_up(ix->capacity * 2);
+    table = (elt_t*)calloc(capacity, sizeof(elt_t));
+    for (jj = 0; jj < ix->capacity; jj++) {
+        if (ix->table[jj].valid) {
+            index_insert(table, capacity, &ix->table[jj]);
+        }
+    }
+    free(ix->table);
+    ix->table = table;
+    ix->capacity = capacity;
+    ix->trigger = capacity / 2;
+}
+
+static job_t *index_get(index_t *ix, const char *nspace)
+{
+    size_t ii, key_size = strnlen(nspace, NSLEN);
+    elt_t *elt;
+
+    for (ii = hash_key(nspace, key_size) % ix->capacity; ; ii++) {
+        if (ii == ix->capacity) {
+            ii = 0;
+        }
+        elt = &ix->table[ii];
+        if (!elt->valid) {
+            return NULL;
+        }
+        if (elt->key_size == key_size && 0 == memcmp(elt->key, nspace, key_size)) {
+            return (job_t*)elt->value;
+        }
+    }
+}
+
+static int run(int njobs, int lookups)
+{
+    job_t **jobs;
+    index_t ix;
+    int *targets, n, sink = 0, scans;
+    double start, tscan, tindex;
+
+    jobs = (job_t**)calloc(njobs, sizeof(job_t*));
+    targets = (int*)malloc(lookups * sizeof(int));
+    index_init(&ix, 128);
+    for (n = 0; n < njobs; n++) {
+        jobs[n] = (job_t*)calloc(1, sizeof(job_t));
+        snprintf(jobs[n]->nspace, NSLEN, "prte-node0001-123456@%d", n + 1);
+        jobs[n]->index = n;
+        index_set(&ix, jobs[n]->nspace, jobs[n]);
+    }
+    for (n = 0; n < lookups; n++) {
+        targets[n] = random() % njobs;
+    }
+
+    /* keep the scan from taking forever on large job counts */
+    scans = lookups;
+    if (100000000 / njobs < scans) {
+        scans = 100000000 / njobs;
+    }
+    for (n = 0; n < scans; n++) {
+        if (scan(jobs, njobs, jobs[targets[n]]->nspace) !=
+            index_get(&ix, jobs[targets[n]]->nspace)) {
+            fprintf(stderr, "%d jobs: lookups of %s disagree\n",
+                    njobs, jobs[targets[n]]->nspace);
+            return 1;
+        }
+    }
+    start = get_time();
+    for (n = 0; n < scans; n++) {
+        sink += scan(jobs, njobs, jobs[targets[n]]->nspace)->index;
+    }
+    tscan = (get_time() - start) / scans;
+    start = get_time();
+    for (n = 0; n < lookups; n++) {
+        sink += index_get(&ix, jobs[targets[n]]->nspace)->index;
+    }
+    tindex = (get_time() - start) / lookups;
+
+    fprintf(stderr, "%8d jobs: scan %12.1f nsec/lookup   index %8.1f nsec/lookup\n",
+            njobs, tscan * 1.0e9, tindex * 1.0e9);
+
+    for (n = 0; n < njobs; n++) {
+        free(jobs[n]);
+    }
+    free(jobs);
+    free(targets);
+    free(ix.table);
+    return (sink == -1) ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+    int n, maxjobs = 100000, lookups = 1000000, rc = 0;
+
+    for (n=1; n < argc; n++) {
+        if (0 == strcmp(argv[n], "-m") && n+1 < argc) {
+            maxjobs = strtol(argv[++n], NULL, 10);
+        } else if (0 == strcmp(argv[n], "-l") && n+1 < argc) {
+            lookups = strtol(argv[++n], NULL, 10);
+        }
+    }
+    if (10 > maxjobs || 1 > lookups) {
+        fprintf(stderr, "Usage: %s [-m <max jobs>] [-l <lookups>]\n", argv[0]);
+        return 1;
+    }
+
+    for (n = 10; n <= maxjobs && 0 == rc; n *= 10) {
+        rc = run(n, lookups);
+    }
+    return rc;
+}
@@ -0,0 +1,225 @@
+#!/usr/bin/env perl
+#
+# Copyright (c) 2026      The PRRTE contributors.  All rights reserved.
+# $COPYRIGHT$
+#
+# Additional copyrights may follow
+#
+# $HEADER$
+#
+# Measure the cost of mapping large jobs without needing a large
+# machine. Each test uses the ras simulator to fabricate a cluster
+# of the requested size, maps a job across it with --do-not-launch,
+# and collects the per-phase timing line that rmaps emits when
+# rmaps_base_report_timing is set. Results are written in
+# comma-separated value format, one row per (mapper, node count, rep).
+
+
+use strict;
+use Getopt::Long;
+
+# globals
+my $nodelist = "100,1000,10000,100000";
+my $topology = "package:2 core:16 pu:2";
+my $topofile;
+my $ppn = 0;
+my $reps = 3;
+my $starter = "prterun";
+my $myresults = "mapping.csv";
+my $mapperlist;
+my $workdir = "/tmp";
+my @csvrow;
+
+# the mappers we know how to drive - the value is the command line
+# option that selects them. seq and rankfile require a file that we
+# generate for each node count.
+my @mappers = qw(byslot bynode byobj ppr mindist seq rankfile);
+my %mapopts = (
+    "byslot"   => "--map-by slot",
+    "bynode"   => "--map-by node",
+    "byobj"    => "--map-by package",
+    "ppr"      => "--map-by ppr:1:core",
+    "mindist"  => "--map-by dist:DEVICE=auto",
+    "seq"      => "--map-by seq:FILE=",
+    "rankfile" => "--map-by rankfile:FILE=",
+);
+
+# Set to true if the script should merely print the cmds
+# it would run, but don't run them
+my $SHOWME = 0;
+# Set to true to suppress most informational messages.
+my $QUIET = 0;
+# Set to true if we just want to see the help message
+my $HELP = 0;
+
+GetOptions(
+    "help" => \$HELP,
+    "quiet" => \$QUIET,
+    "showme" => \$SHOWME,
+    "reps=s" => \$reps,
+    "nodes=s" => \$nodelist,
+    "topology=s" => \$topology,
+    "topofile=s" => \$topofile,
+    "ppn=s" => \$ppn,
+    "mappers=s" => \$mapperlist,
+    "starter=s" => \$starter,
+    "results=s" => \$myresults,
+    "workdir=s" => \$workdir,
+) or die "unable to parse options, stopped";
+
+if ($HELP) {
+    print "$0 [options]
+
+--help | -h          This help message
+--quiet | -q         Only output critical messages to stdout
+--showme             Show the actual commands without executing them
+--reps=n             Number of times to run each test (for statistics)
+--nodes=list         Comma-separated list of simulated node counts (default: $nodelist)
+--topology=s         hwloc synthetic topology of each simulated node (default: \"$topology\")
+--topofile=file      Use this hwloc XML file instead of a synthetic topology. Synthetic
+                     topologies carry no devices, so mindist falls back to byslot
+                     unless a topology file with a network device is given
+--ppn=n              Procs/node to map (default: one per core in the synthetic topology)
+--mappers=list       Comma-separated subset of: " . join(",", @mappers) . "
+--starter=s          Command used to run the test (default: $starter)
+--results=file       File where results are to be stored in comma-separated value format
+--workdir=dir        Where to write generated seq and rank files (default: $workdir)
+";
+    exit(0);
+}
+
+if ($mapperlist) {
+    my @requested = split(/,/, $mapperlist);
+    foreach my $m (@requested) {
+        die "unknown mapper $m, stopped" unless (exists $mapopts{$m});
+    }
+    @mappers = @requested;
+}
+my @nodes = split(/,/, $nodelist);
+
+# count the cores in the synthetic topology so we can size the job
+# and generate seq/rankfile entries - slots are assigned per core
+# unless hwthreads are being used as cpus
+my $cpus_per_node = 1;
+foreach my $level (split(/\s+/, $topology)) {
+    if ($level !~ /^pu:/ && $level =~ /:(\d+)$/) {
+        $cpus_per_node *= $1;
+    }
+}
+if (0 == $ppn) {
+    die "--ppn must be given with --topofile, stopped" if ($topofile);
+    $ppn = $cpus_per_node;
+}
+
+# the simulator names its nodes "nodeA" followed by the node
+# index zero-padded to the number of digits in the node count
+sub nodename
+{
+    my ($nnodes, $idx) = @_;
+    return sprintf("nodeA%0*d", length("$nnodes"), $idx);
+}
+
+# write a sequential file or rankfile covering every proc in the job
+sub genfile
+{
+    my ($mapper, $nnodes) = @_;
+    my $file = "$workdir/mapping-$mapper-$nnodes.txt";
+    my $rank = 0;
+
+    if ($SHOWME) {
+        return $file;
+    }
+    open(my $fh, ">", $file) || die "could not create $file, stopped";
+    for (my $n = 0; $n < $nnodes; $n++) {
+        my $host = nodename($nnodes, $n);
+        for (my $p = 0; $p < $ppn; $p++) {
+            if ($mapper eq "seq") {
+                print $fh "$host\n";
+            } else {
+                print $fh "rank $rank=$host slot=" . ($p % $cpus_per_node) . "\n";
+            }
+            $rank++;
+        }
+    }
+    close($fh);
+    return $file;
+}
+
+# get the local date and time
+my ($sec,$min,$hour,$day,$month,$yr19,@rest) =   localtime(time);
+
+print "\n--------------------------------------------------\n";
+print "\nTest configuration:\n";
+print "\tDate:\t" . "$day-".++$month. "-".($yr19+1900) . " " . sprintf("%02d",$hour).":".sprintf("%02d",$min).":".sprintf("%02d",$sec) . "\n";;
+print "\tNodes:\t\t" . join(", ", @nodes) . "\n";
+print "\tTopology:\t" . ($topofile ? $topofile : $topology) . "\n";
+print "\tProcs/node:\t" . $ppn . "\n";
+print "\tMappers:\t" . join(", ", @mappers) . "\n";
+print "\n--------------------------------------------------\n";
+
+if ($myresults && !$SHOWME) {
+    open FILE, ">$myresults" || die "file could not be opened";
+    print FILE "mapper,policy,nodes,procs,rep,map,vpids,local_ranks,bindings,total,maxrss_kb\n";
+}
+
+foreach my $mapper (@mappers) {
+    foreach my $nnodes (@nodes) {
+        my $np = $nnodes * $ppn;
+        my $opt = $mapopts{$mapper};
+        my $file;
+
+        if ($mapper eq "seq" || $mapper eq "rankfile") {
+            $file = genfile($mapper, $nnodes);
+            $opt = $opt . $file;
+        }
+        my $topo = $topofile ? " --prtemca ras_simulator_topo_files $topofile"
+                             : " --prtemca ras_simulator_topologies \"$topology\"";
+        my $cmd = "$starter --prtemca ras simulator" .
+                  " --prtemca ras_simulator_num_nodes $nnodes" . $topo .
+                  " --prtemca rmaps_base_report_timing 1" .
+                  " --do-not-launch -n $np $opt /bin/true 2>&1";
+
+        for (my $rep = 0; $rep < $reps; $rep++) {
+            if ($SHOWME) {
+                print $cmd . "\n";
+                next;
+            }
+            if (!$QUIET) {
+                print "Running $mapper on $nnodes nodes ($np procs) rep $rep\n";
+            }
+            my $output = `$cmd`;
+            my $found = 0;
+            foreach my $line (split(/\n/, $output)) {
+                next unless ($line =~ /rmaps:base:timing/);
+                my %vals;
+                foreach my $kv (split(/\s+/, $line)) {
+                    if ($kv =~ /^(\w+)=(\S+)$/) {
+                        $vals{$1} = $2;
+                    }
+                }
+                @csvrow = ($mapper, "\"" . $vals{"policy"} . "\"", $nnodes, $vals{"procs"}, $rep,
+                           $vals{"map"}, $vals{"vpids"}, $vals{"local_ranks"},
+                           $vals{"bindings"}, $vals{"total"}, $vals{"maxrss_kb"});
+                if (!$QUIET) {
+                    print "\tmap $vals{map} vpids $vals{vpids} local_ranks $vals{local_ranks} " .
+                          "bindings $vals{bindings} total $vals{total} sec, peak RSS $vals{maxrss_kb} KB\n";
+                }
+                if ($myresults) {
+                    print FILE join(",", @csvrow) . "\n";
+                }
+                $found = 1;
+            }
+            if (!$found) {
+                print "\tNo timing reported - test failed:\n$output\n";
+                last;
+            }
+        }
+        if (defined $file && !$SHOWME) {
+            unlink($file);
+        }
+    }
+}
+
+if ($myresults && !$SHOWME) {
+    close(FILE);
+}
@@ -0,0 +1,301 @@
+/* -*- Mode: C; c-basic-offset:4 ; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2026      The PRRTE contributors.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Measure the cost of computing the next hop towards a daemon in the
+ * radix and binomial routing trees without needing a large machine.
+ * For each tree, a handful of daemons compute the route to every
+ * other daemon, first by walking their children and checking the
+ * per-child bitmap of daemons below it (as the routed components
+ * used to do), then by computing the hop from the tree shape. The
+ * two must agree. Reports lookups/sec and the memory the bitmaps
+ * would have required.
+ *
+ * Usage: routebench [-n <daemons>] [-r <radix>] [-l <loops>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <sys/time.h>
+
+typedef struct {
+    int rank;
+    uint64_t *relatives;
+} child_t;
+
+typedef struct {
+    int me;
+    int parent;
+    int nchildren;
+    child_t *children;
+    /* radix position */
+    int width;
+    int offset;
+    int child_start;
+    /* binomial position */
+    int lowmask;
+} tree_t;
+
+static int ndaemons = 65536;
+static int radix = 64;
+
+static double get_time(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+}
+
+static int hibit(int value)
+{
+    int i;
+
+    for (i = 8 * (int)sizeof(int) - 2; i >= 0; i--) {
+        if (value & (1 << i)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static int cube_dim(int value)
+{
+    int dim, size;
+
+    for (dim = 0, size = 1; size < value; ++dim, size <<= 1);
+    return dim;
+}
+
+static void set_bit(uint64_t *bm, int bit)
+{
+    bm[bit / 64] |= (uint64_t)1 << (bit % 64);
+}
+
+static int is_set(uint64_t *bm, int bit)
+{
+    return 0 != (bm[bit / 64] & ((uint64_t)1 << (bit % 64)));
+}
+
+static child_t *add_child(tree_t *t, int rank)
+{
+    child_t *c = &t->children[t->nchildren++];
+
+    c->rank = rank;
+    c->relatives = (uint64_t*)calloc((ndaemons + 63) / 64, sizeof(uint64_t));
+    return c;
+}
+
+/* radix tree */
+static void radix_level(int rank, int *start, int *width)
+{
+    int Sum = 1, NInLevel = 1;
+
+    while (Sum < (rank+1)) {
+        NInLevel *= radix;
+        Sum += NInLevel;
+    }
+    *start = Sum - NInLevel;
+    *width = NInLevel;
+}
+
+static void radix_relatives(int rank, uint64_t *bm)
+{
+    int i, peer, start, width;
+
+    radix_level(rank, &start, &width);
+    peer = rank + width;
+    for (i = 0; i < radix && peer < ndaemons; i++, peer += width) {
+        set_bit(bm, peer);
+        radix_relatives(peer, bm);
+    }
+}
+
+static void radix_setup(tree_t *t, int me)
+{
+    int i, peer, start, width;
+    child_t *c;
+
+    memset(t, 0, sizeof(*t));
+    t->me = me;
+    t->children = (child_t*)calloc(radix, sizeof(child_t));
+    radix_level(me, &start, &width);
+    t->width = width;
+    t->offset = me - start;
+    t->child_start = start + width;
+    t->parent = (0 == me) ? -1 : (t->offset % (width / radix)) + (start - width / radix);
+    peer = me + width;
+    for (i = 0; i < radix && peer < ndaemons; i++, peer += width) {
+        c = add_child(t, peer);
+        radix_relatives(peer, c->relatives);
+    }
+}
+
+static int radix_hop(tree_t *t, int target)
+{
+    int start, width, offset;
+
+    if (target <= t->me) {
+        return t->parent;
+    }
+    radix_level(target, &start, &width);
+    if (width <= t->width) {
+        return t->parent;
+    }
+    offset = target - start;
+    if (offset % t->width != t->offset) {
+        return t->parent;
+    }
+    return t->child_start + (offset % (t->width * radix));
+}
+
+/* binomial tree */
+static void binomial_relatives(int rank, int dim, uint64_t *bm)
+{
+    int i, peer;
+
+    for (i = hibit(rank) + 1; i < dim; i++) {
+        peer = rank | (1 << i);
+        if (peer < ndaemons) {
+            set_bit(bm, peer);
+            binomial_relatives(peer, dim, bm);
+        }
+    }
+}
+
+static void binomial_setup(tree_t *t, int me)
+{
+    int i, peer, hb, dim = cube_dim(ndaemons);
+    child_t *c;
+
+    memset(t, 0, sizeof(*t));
+    t->me = me;
+    t->children = (child_t*)calloc(dim + 1, sizeof(child_t));
+    hb = hibit(me);
+    t->parent = (0 > hb) ? 0 : (me & ~(1 << hb));
+    t->lowmask = (1 << (hb + 1)) - 1;
+    for (i = hb + 1; i < dim; i++) {
+        peer = me | (1 << i);
+        if (peer < ndaemons) {
+            c = add_child(t, peer);
+            binomial_relatives(peer, dim, c->relatives);
+        }
+    }
+}
+
+static int binomial_hop(tree_t *t, int target)
+{
+    int rest;
+
+    if (target == t->me || (target & t->lowmask) != t->me) {
+        return t->parent;
+    }
+    rest = target & ~t->lowmask;
+    return t->me | (rest & -rest);
+}
+
+/* the old way - walk the children checking their bitmaps */
+static int bitmap_hop(tree_t *t, int target)
+{
+    int i;
+
+    for (i = 0; i < t->nchildren; i++) {
+        if (t->children[i].rank == target ||
+            is_set(t->children[i].relatives, target)) {
+            return t->children[i].rank;
+        }
+    }
+    return t->parent;
+}
+
+static void release(tree_t *t)
+{
+    int i;
+
+    for (i = 0; i < t->nchildren; i++) {
+        free(t->children[i].relatives);
+    }
+    free(t->children);
+}
+
+static int run(const char *name, void (*setup)(tree_t*, int),
+               int (*hop)(tree_t*, int), int loops)
+{
+    int members[4], m, l, target, sink = 0;
+    tree_t t;
+    double start, tbit = 0.0, tarith = 0.0, lookups;
+    size_t bytes = 0;
+
+    members[0] = 0;
+    members[1] = 1;
+    members[2] = ndaemons / 2;
+    members[3] = ndaemons - 1;
+
+    for (m = 0; m < 4; m++) {
+        setup(&t, members[m]);
+        bytes += (size_t)t.nchildren * ((ndaemons + 63) / 64) * sizeof(uint64_t);
+        for (target = 0; target < ndaemons; target++) {
+            if (target == t.me) {
+                continue;
+            }
+            if (bitmap_hop(&t, target) != hop(&t, target)) {
+                fprintf(stderr, "%s: daemon %d routes to %d via %d, expected %d\n",
+                        name, t.me, target, hop(&t, target), bitmap_hop(&t, target));
+                release(&t);
+                return 1;
+            }
+        }
+        start = get_time();
+        for (l = 0; l < loops; l++) {
+            for (target = 0; target < ndaemons; target++) {
+                sink += bitmap_hop(&t, target);
+            }
+        }
+        tbit += get_time() - start;
+        start = get_time();
+        for (l = 0; l < loops; l++) {
+            for (target = 0; target < ndaemons; target++) {
+                sink += hop(&t, target);
+            }
+        }
+        tarith += get_time() - start;
+        release(&t);
+    }
+
+    lookups = 4.0 * loops * ndaemons;
+    fprintf(stderr, "%s: %d daemons\n", name, ndaemons);
+    fprintf(stderr, "\tbitmap walk: %12.0f lookups/sec (%8.1f KB of bitmaps per daemon)\n",
+            lookups / tbit, (double)bytes / 4.0 / 1024.0);
+    fprintf(stderr, "\tarithmetic:  %12.0f lookups/sec\n", lookups / tarith);
+    return (sink == -1) ? 1 : 0;
+}
+
+int main(int argc, char **argv)
+{
+    int n, loops = 10, rc;
+
+    for (n=1; n < argc; n++) {
+        if (0 == strcmp(argv[n], "-n") && n+1 < argc) {
+            ndaemons = strtol(argv[++n], NULL, 10);
+        } else if (0 == strcmp(argv[n], "-r") && n+1 < argc) {
+            radix = strtol(argv[++n], NULL, 10);
+        } else if (0 == strcmp(argv[n], "-l") && n+1 < argc) {
+            loops = strtol(argv[++n], NULL, 10);
+        }
+    }
+    if (2 > ndaemons || 2 > radix || 1 > loops) {
+        fprintf(stderr, "Usage: %s [-n <daemons>] [-r <radix>] [-l <loops>]\n", argv[0]);
+        return 1;
+    }
+
+    rc = run("radix", radix_setup, radix_hop, loops);
+    rc |= run("binomial", binomial_setup, binomial_hop, loops);
+    return rc;
+}
@@ -0,0 +1,212 @@
+/* -*- Mode: C; c-basic-offset:4 ; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2026      The PRRTE contributors.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Measure the cost on the HNP of applying the proc state updates
+ * daemons report at launch and termination, without needing a large
+ * machine. Each update message carries a section per job listing the
+ * state of each of its procs. The HNP used to activate an event per
+ * proc, each with its own caddy, and then track the proc from that
+ * event. It now applies a job section in a single event. Both ways
+ * are driven through libevent here, with the proc tracking reduced
+ * to updating the proc and counting the job's terminated procs. The
+ * two must agree on the result. Reports updates/sec for each.
+ *
+ * Usage: statebench [-j <jobs>] [-n <procs/job>] [-l <loops>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <event.h>
+
+typedef struct {
+    int state;
+    int exit_code;
+} proc_t;
+
+typedef struct {
+    proc_t *procs;
+    int nprocs;
+    int num_terminated;
+} job_t;
+
+/* what arrives in the update message */
+typedef struct {
+    int rank;
+    int state;
+    int exit_code;
+} update_t;
+
+/* one per activated event */
+typedef struct {
+    struct event ev;
+    job_t *jdata;
+    update_t *updates;
+    int nupdates;
+} caddy_t;
+
+#define PROC_STATE_RUNNING      4
+#define PROC_STATE_TERMINATED  20
+
+static int njobs = 16;
+static int nprocs = 4096;
+
+static double get_time(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+}
+
+static void track_proc(job_t *jdata, update_t *up)
+{
+    proc_t *p = &jdata->procs[up->rank];
+
+    p->state = up->state;
+    p->exit_code = up->exit_code;
+    if (PROC_STATE_TERMINATED <= up->state) {
+        jdata->num_terminated++;
+    }
+}
+
+/* the old way - an event for each proc */
+static void proc_cb(int fd, short args, void *cbdata)
+{
+    caddy_t *cd = (caddy_t*)cbdata;
+
+    track_proc(cd->jdata, cd->updates);
+    free(cd);
+}
+
+/* the new way - an event for each job section */
+static void batch_cb(int fd, short args, void *cbdata)
+{
+    caddy_t *cd = (caddy_t*)cbdata;
+    int n;
+
+    for (n = 0; n < cd->nupdates; n++) {
+        track_proc(cd->jdata, &cd->updates[n]);
+    }
+    free(cd);
+}
+
+static void activate(struct event_base *base, job_t *jdata, update_t *updates,
+                     int nupdates, void (*cb)(int, short, void*))
+{
+    caddy_t *cd = (caddy_t*)malloc(sizeof(caddy_t));
+
+    cd->jdata = jdata;
+    cd->updates = updates;
+    cd->nupdates = nupdates;
+    event_assign(&cd->ev, base, -1, EV_WRITE, cb, cd);
+    event_active(&cd->ev, EV_WRITE, 1);
+}
+
+static void reset(job_t *jobs)
+{
+    int j;
+
+    for (j = 0; j < njobs; j++) {
+        memset(jobs[j].procs, 0, nprocs * sizeof(proc_t));
+        jobs[j].num_terminated = 0;
+    }
+}
+
+static double run(struct event_base *base, job_t *jobs, update_t **updates,
+                  int loops, int batched)
+{
+    int l, j, n;
+    double start;
+
+    start = get_time();
+    for (l = 0; l < loops; l++) {
+        reset(jobs);
+        for (j = 0; j < njobs; j++) {
+            if (batched) {
+                activate(base, &jobs[j], updates[j], nprocs, batch_cb);
+            } else {
+                for (n = 0; n < nprocs; n++) {
+                    activate(base, &jobs[j], &updates[j][n], 1, proc_cb);
+                }
+            }
+        }
+        event_base_loop(base, EVLOOP_NONBLOCK);
+    }
+    return get_time() - start;
+}
+
+int main(int argc, char **argv)
+{
+    int n, j, loops = 20;
+    struct event_base *base;
+    job_t *jobs;
+    update_t **updates;
+    double tproc, tbatch, nupdates;
+    int *terminated;
+
+    for (n=1; n < argc; n++) {
+        if (0 == strcmp(argv[n], "-j") && n+1 < argc) {
+            njobs = strtol(argv[++n], NULL, 10);
+        } else if (0 == strcmp(argv[n], "-n") && n+1 < argc) {
+            nprocs = strtol(argv[++n], NULL, 10);
+        } else if (0 == strcmp(argv[n], "-l") && n+1 < argc) {
+            loops = strtol(argv[++n], NULL, 10);
+        }
+    }
+    if (1 > njobs || 1 > nprocs || 1 > loops) {
+        fprintf(stderr, "Usage: %s [-j <jobs>] [-n <procs/job>] [-l <loops>]\n", argv[0]);
+        return 1;
+    }
+
+    base = event_base_new();
+    jobs = (job_t*)calloc(njobs, sizeof(job_t));
+    updates = (update_t**)calloc(njobs, sizeof(update_t*));
+    terminated = (int*)calloc(njobs, sizeof(int));
+    for (j = 0; j < njobs; j++) {
+        jobs[j].nprocs = nprocs;
+        jobs[j].procs = (proc_t*)calloc(nprocs, sizeof(proc_t));
+        updates[j] = (update_t*)calloc(nprocs, sizeof(update_t));
+        /* a mix of running and terminated procs */
+        for (n = 0; n < nprocs; n++) {
+            updates[j][n].rank = n;
+            updates[j][n].state = (n % 2) ? PROC_STATE_TERMINATED : PROC_STATE_RUNNING;
+            updates[j][n].exit_code = n % 3;
+        }
+    }
+
+    tproc = run(base, jobs, updates, loops, 0);
+    for (j = 0; j < njobs; j++) {
+        terminated[j] = jobs[j].num_terminated;
+    }
+    tbatch = run(base, jobs, updates, loops, 1);
+    for (j = 0; j < njobs; j++) {
+        if (terminated[j] != jobs[j].num_terminated) {
+            fprintf(stderr, "job %d: %d procs terminated per proc, %d per job section\n",
+                    j, terminated[j], jobs[j].num_terminated);
+            return 1;
+        }
+    }
+
+    nupdates = (double)loops * njobs * nprocs;
+    fprintf(stderr, "%d jobs of %d procs\n", njobs, nprocs);
+    fprintf(stderr, "\tevent per proc:        %12.0f updates/sec\n", nupdates / tproc);
+    fprintf(stderr, "\tevent per job section: %12.0f updates/sec\n", nupdates / tbatch);
+
+    for (j = 0; j < njobs; j++) {
+        free(jobs[j].procs);
+        free(updates[j]);
+    }
+    free(jobs);
+    free(updates);
+    free(terminated);
+    event_base_free(base);
+    return 0;
+}
@@ -0,0 +1,335 @@
+/* -*- Mode: C; c-basic-offset:4 ; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2026      The PRRTE contributors.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Estimate the throughput of positioning a file across a daemon tree
+ * without needing a large machine. The HNP streams the file in chunks
+ * down a tree of the given fan-out and stalls whenever it gets a
+ * window of chunks ahead of the slowest daemon. Each daemon writes
+ * every chunk it receives, relays it to its children, and reports
+ * progress every half window. Progress is reported two ways: each
+ * daemon acking the HNP directly, with the ack relayed hop by hop up
+ * the tree (as the raw filem component used to do), and each daemon
+ * passing a credit point up to its parent once it and all of its
+ * children have reached it.
+ *
+ * The daemons are simulated as serial servers: handling or sending a
+ * message costs a fixed overhead, sending a chunk also costs its size
+ * over the link bandwidth, and writing a chunk costs what a memcpy of
+ * it takes on this machine. Reports the simulated rate at which the
+ * file reaches every daemon and the acks the HNP itself handled. Both
+ * ways must deliver every chunk to every daemon.
+ *
+ * Usage: xferbench [-n <daemons>] [-r <fan-out>] [-c <chunks>] [-s <chunk KB>]
+ *                  [-w <window>] [-o <usec/msg>] [-b <link MB/sec>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#define MSG_CHUNK   0
+#define MSG_CREDIT  1
+
+typedef struct {
+    double time;
+    long seq;
+    int type;
+    /* the daemon handling the message and the one it is for -
+     * messages for someone else are relayed to the parent */
+    int at;
+    int target;
+    int value;
+} msg_t;
+
+static int ndaemons = 4096;
+static int fanout = 64;
+static int nchunks = 64;
+static size_t chunk_size = 1024 * 1024;
+static int window = 8;
+static double overhead = 2.0;
+static double bandwidth = 10000.0;
+
+static int credit, nslots;
+static double copy_usec, chunk_usec;
+
+/* messages in flight, ordered by arrival time */
+static msg_t *heap = NULL;
+static size_t hsize = 0, hcount = 0;
+static long seq;
+
+/* per-daemon state */
+static double *busy;
+static int *received;
+static int *nchildren;
+static int *next_mark;
+static int *counts;
+
+/* HNP state */
+static int sent, acked;
+static long hnp_acks;
+static double finish;
+
+static double get_time(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+}
+
+static int parent(int d)
+{
+    return (d - 1) / fanout;
+}
+
+static int earlier(msg_t *a, msg_t *b)
+{
+    return a->time < b->time || (a->time == b->time && a->seq < b->seq);
+}
+
+/* send a message from daemon "from" - the sender is busy until it
+ * is on the wire */
+static void post(int from, int type, int at, int target, int value)
+{
+    msg_t m, tmp;
+    size_t i;
+
+    busy[from] += overhead;
+    if (MSG_CHUNK == type) {
+        busy[from] += chunk_usec;
+    }
+    m.time = busy[from];
+    m.seq = seq++;
+    m.type = type;
+    m.at = at;
+    m.target = target;
+    m.value = value;
+
+    if (hcount == hsize) {
+        hsize = (0 == hsize) ? 1024 : 2 * hsize;
+        heap = (msg_t*)realloc(heap, hsize * sizeof(msg_t));
+    }
+    i = hcount++;
+    heap[i] = m;
+    while (0 < i && earlier(&heap[i], &heap[(i - 1) / 2])) {
+        tmp = heap[i];
+        heap[i] = heap[(i - 1) / 2];
+        heap[(i - 1) / 2] = tmp;
+        i = (i - 1) / 2;
+    }
+}
+
+static msg_t next_msg(void)
+{
+    msg_t m = heap[0], tmp;
+    size_t i = 0, c;
+
+    heap[0] = heap[--hcount];
+    while ((c = 2 * i + 1) < hcount) {
+        if (c + 1 < hcount && earlier(&heap[c + 1], &heap[c])) {
+            c++;
+        }
+        if (!earlier(&heap[c], &heap[i])) {
+            break;
+        }
+        tmp = heap[i];
+        heap[i] = heap[c];
+        heap[c] = tmp;
+        i = c;
+    }
+    return m;
+}
+
+static void send_chunks(void)
+{
+    while (sent < nchunks && sent < acked * credit + window) {
+        post(0, MSG_CHUNK, 0, 0, sent);
+        sent++;
+    }
+}
+
+/* count a credit point at daemon d - for the flat acks only the
+ * HNP counts, expecting every daemon */
+static void count_credit(int d, int mark, int nexpected, int aggregate)
+{
+    int *c = &counts[d * nslots];
+
+    if (mark < next_mark[d] || next_mark[d] + nslots <= mark) {
+        fprintf(stderr, "daemon %d: credit point %d outside of [%d,%d)\n",
+                d, mark, next_mark[d], next_mark[d] + nslots);
+        exit(1);
+    }
+    c[mark % nslots]++;
+    while (c[next_mark[d] % nslots] == nexpected) {
+        c[next_mark[d] % nslots] = 0;
+        if (0 == d) {
+            acked = next_mark[d] + 1;
+            send_chunks();
+        } else if (aggregate) {
+            post(d, MSG_CREDIT, parent(d), parent(d), next_mark[d]);
+        }
+        next_mark[d]++;
+    }
+}
+
+static void report(int d, int mark, int aggregate)
+{
+    if (aggregate) {
+        count_credit(d, mark, nchildren[d] + 1, 1);
+    } else if (0 == d) {
+        count_credit(0, mark, ndaemons, 0);
+    } else {
+        post(d, MSG_CREDIT, parent(d), 0, mark);
+    }
+}
+
+static void handle(msg_t *m, int aggregate)
+{
+    int d = m->at, c, first;
+
+    if (busy[d] < m->time) {
+        busy[d] = m->time;
+    }
+    busy[d] += overhead;
+
+    if (MSG_CREDIT == m->type) {
+        if (0 == d) {
+            hnp_acks++;
+        }
+        if (d != m->target) {
+            /* relay it towards its target */
+            post(d, MSG_CREDIT, parent(d), m->target, m->value);
+        } else if (aggregate) {
+            count_credit(d, m->value, nchildren[d] + 1, 1);
+        } else {
+            count_credit(0, m->value, ndaemons, 0);
+        }
+        return;
+    }
+
+    /* write the chunk and pass it down the tree */
+    busy[d] += copy_usec;
+    first = fanout * d + 1;
+    for (c = first; c < first + fanout && c < ndaemons; c++) {
+        post(d, MSG_CHUNK, c, c, m->value);
+    }
+    if (nchunks == ++received[d] && finish < busy[d]) {
+        finish = busy[d];
+    }
+    if (0 == ((m->value + 1) % credit)) {
+        report(d, m->value / credit, aggregate);
+    }
+}
+
+static int run(const char *name, int aggregate)
+{
+    msg_t m;
+    int d;
+    double mbytes;
+
+    memset(busy, 0, ndaemons * sizeof(double));
+    memset(received, 0, ndaemons * sizeof(int));
+    memset(next_mark, 0, ndaemons * sizeof(int));
+    memset(counts, 0, (size_t)ndaemons * nslots * sizeof(int));
+    sent = 0;
+    acked = 0;
+    hnp_acks = 0;
+    finish = 0.0;
+    seq = 0;
+
+    send_chunks();
+    while (0 < hcount) {
+        m = next_msg();
+        handle(&m, aggregate);
+    }
+
+    for (d = 0; d < ndaemons; d++) {
+        if (nchunks != received[d]) {
+            fprintf(stderr, "%s: daemon %d received %d of %d chunks\n",
+                    name, d, received[d], nchunks);
+            return 1;
+        }
+    }
+
+    mbytes = (double)nchunks * chunk_size / (1024.0 * 1024.0);
+    fprintf(stderr, "\t%s %10.1f MB/sec %10ld acks at the HNP\n",
+            name, mbytes / (finish / 1000000.0), hnp_acks);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    int n, rc;
+    unsigned char *src, *dst;
+    double start;
+
+    for (n=1; n < argc; n++) {
+        if (0 == strcmp(argv[n], "-n") && n+1 < argc) {
+            ndaemons = strtol(argv[++n], NULL, 10);
+        } else if (0 == strcmp(argv[n], "-r") && n+1 < argc) {
+            fanout = strtol(argv[++n], NULL, 10);
+        } else if (0 == strcmp(argv[n], "-c") && n+1 < argc) {
+            nchunks = strtol(argv[++n], NULL, 10);
+        } else if (0 == strcmp(argv[n], "-s") && n+1 < argc) {
+            chunk_size = (size_t)strtol(argv[++n], NULL, 10) * 1024;
+        } else if (0 == strcmp(argv[n], "-w") && n+1 < argc) {
+            window = strtol(argv[++n], NULL, 10);
+        } else if (0 == strcmp(argv[n], "-o") && n+1 < argc) {
+            overhead = strtod(argv[++n], NULL);
+        } else if (0 == strcmp(argv[n], "-b") && n+1 < argc) {
+            bandwidth = strtod(argv[++n], NULL);
+        }
+    }
+    if (1 > ndaemons || 1 > fanout || 1 > nchunks || 0 == chunk_size ||
+        2 > window || 0.0 > overhead || 0.0 >= bandwidth) {
+        fprintf(stderr, "Usage: %s [-n <daemons>] [-r <fan-out>] [-c <chunks>] [-s <chunk KB>]\n"
+                        "\t[-w <window>] [-o <usec/msg>] [-b <link MB/sec>]\n", argv[0]);
+        return 1;
+    }
+    credit = window / 2;
+    nslots = (window / credit) + 2;
+
+    /* what writing a chunk costs here */
+    src = (unsigned char*)malloc(chunk_size);
+    dst = (unsigned char*)malloc(chunk_size);
+    memset(src, 'x', chunk_size);
+    start = get_time();
+    for (n = 0; n < 64; n++) {
+        memcpy(dst, src, chunk_size);
+        src[n] = dst[chunk_size - 1 - n];
+    }
+    copy_usec = (get_time() - start) * 1000000.0 / 64.0;
+    chunk_usec = (double)chunk_size / bandwidth;
+    free(src);
+    free(dst);
+
+    busy = (double*)calloc(ndaemons, sizeof(double));
+    received = (int*)calloc(ndaemons, sizeof(int));
+    nchildren = (int*)calloc(ndaemons, sizeof(int));
+    next_mark = (int*)calloc(ndaemons, sizeof(int));
+    counts = (int*)calloc((size_t)ndaemons * nslots, sizeof(int));
+    for (n = 1; n < ndaemons; n++) {
+        nchildren[parent(n)]++;
+    }
+
+    fprintf(stderr, "%d daemons, fan-out %d, %d chunks of %lu KB, window %d, %.1f usec/msg, %.0f MB/sec links\n",
+            ndaemons, fanout, nchunks, (unsigned long)(chunk_size / 1024), window,
+            overhead, bandwidth);
+    rc = run("flat acks:      ", 0);
+    rc |= run("aggregated acks:", 1);
+
+    free(busy);
+    free(received);
+    free(nchildren);
+    free(next_mark);
+    free(counts);
+    free(heap);
+    return rc;
+}
@@ -0,0 +1,193 @@
+/* -*- Mode: C; c-basic-offset:4 ; indent-tabs-mode:nil -*- */
+/*
+ * Copyright (c) 2026      The PRRTE contributors.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Measure the rate at which the DVM can start procs by repeatedly
+ * spawning a job of /bin/true and waiting for it to complete. Compare
+ * spawn engines by starting the DVM with and without
+ * "--prtemca odls_default_use_vfork 1". Adding
+ * "--prtemca odls_base_report_timing 1" has each daemon report the
+ * time spent preparing, forking and reporting its local procs.
+ *
+ * Usage: launchrate [-n <procs per job>] [-r <repetitions>] [-c <cmd>]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/time.h>
+
+#include <pmix_tool.h>
+#include "examples.h"
+
+static pmix_proc_t myproc;
+
+static double get_time(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+}
+
+static void notification_fn(size_t evhdlr_registration_id,
+                            pmix_status_t status,
+                            const pmix_proc_t *source,
+                            pmix_info_t info[], size_t ninfo,
+                            pmix_info_t results[], size_t nresults,
+                            pmix_event_notification_cbfunc_fn_t cbfunc,
+                            void *cbdata)
+{
+    myrel_t *lock = NULL;
+    size_t n;
+    pmix_status_t jobstatus = 0;
+
+    /* we should always have info returned to us - if not, there is
+     * nothing we can do */
+    if (NULL != info) {
+        for (n=0; n < ninfo; n++) {
+            if (0 == strncmp(info[n].key, PMIX_JOB_TERM_STATUS, PMIX_MAX_KEYLEN)) {
+                jobstatus = info[n].value.data.status;
+            } else if (0 == strncmp(info[n].key, PMIX_EVENT_RETURN_OBJECT, PMIX_MAX_KEYLEN)) {
+                lock = (myrel_t*)info[n].value.data.ptr;
+            }
+        }
+    }
+    if (NULL == lock) {
+        fprintf(stderr, "LOCK WAS NOT RETURNED IN EVENT NOTIFICATION\n");
+        goto done;
+    }
+    /* save the status */
+    lock->lock.status = jobstatus;
+    /* release the lock */
+    DEBUG_WAKEUP_THREAD(&lock->lock);
+
+  done:
+    /* we _always_ have to execute the evhandler callback or
+     * else the event progress engine will hang */
+    if (NULL != cbfunc) {
+        cbfunc(PMIX_SUCCESS, NULL, 0, NULL, NULL, cbdata);
+    }
+}
+
+static void evhandler_reg_callbk(pmix_status_t status,
+                                 size_t evhandler_ref,
+                                 void *cbdata)
+{
+    mylock_t *lock = (mylock_t*)cbdata;
+
+    if (PMIX_SUCCESS != status) {
+        fprintf(stderr, "Client %s:%d EVENT HANDLER REGISTRATION FAILED WITH STATUS %d, ref=%lu\n",
+                   myproc.nspace, myproc.rank, status, (unsigned long)evhandler_ref);
+    }
+    lock->status = status;
+    lock->evhandler_ref = evhandler_ref;
+    DEBUG_WAKEUP_THREAD(lock);
+}
+
+
+int main(int argc, char **argv)
+{
+    pmix_status_t rc;
+    pmix_info_t info;
+    pmix_app_t *app;
+    bool flag;
+    myrel_t myrel;
+    mylock_t mylock;
+    pmix_status_t code = PMIX_ERR_JOB_TERMINATED;
+    pmix_nspace_t appspace;
+    int nprocs = 16, reps = 10, n;
+    char *cmd = "/bin/true";
+    double start, t, tmin = -1.0, tmax = 0.0, ttot = 0.0;
+
+    for (n=1; n < argc; n++) {
+        if (0 == strcmp(argv[n], "-n") && n+1 < argc) {
+            nprocs = strtol(argv[++n], NULL, 10);
+        } else if (0 == strcmp(argv[n], "-r") && n+1 < argc) {
+            reps = strtol(argv[++n], NULL, 10);
+        } else if (0 == strcmp(argv[n], "-c") && n+1 < argc) {
+            cmd = argv[++n];
+        }
+    }
+
+    /* attach to the system server so we can have it spawn for us */
+    flag = true;
+    PMIX_INFO_LOAD(&info, PMIX_CONNECT_TO_SYSTEM, &flag, PMIX_BOOL);
+    if (PMIX_SUCCESS != (rc = PMIx_tool_init(&myproc, &info, 1))) {
+        fprintf(stderr, "PMIx_tool_init failed: %d\n", rc);
+        exit(rc);
+    }
+
+    DEBUG_CONSTRUCT_MYREL(&myrel);
+
+    /* register an event handler so we can be notified when
+     * each spawned job completes */
+    DEBUG_CONSTRUCT_LOCK(&mylock);
+    PMIX_INFO_LOAD(&info, PMIX_EVENT_RETURN_OBJECT, &myrel, PMIX_POINTER);
+    PMIx_Register_event_handler(&code, 1, &info, 1,
+                                notification_fn, evhandler_reg_callbk, (void*)&mylock);
+    DEBUG_WAIT_THREAD(&mylock);
+    rc = mylock.status;
+    DEBUG_DESTRUCT_LOCK(&mylock);
+    if (PMIX_SUCCESS != rc) {
+        fprintf(stderr, "[%s:%d] Default handler registration failed\n", myproc.nspace, myproc.rank);
+        goto done;
+    }
+
+    for (n=0; n < reps; n++) {
+        PMIX_APP_CREATE(app, 1);
+        app[0].cmd = strdup(cmd);
+        app[0].argv = (char**)malloc(2*sizeof(char*));
+        app[0].argv[0] = strdup(cmd);
+        app[0].argv[1] = NULL;
+        app[0].maxprocs = nprocs;
+        app[0].ninfo = 1;
+        PMIX_INFO_CREATE(app[0].info, app[0].ninfo);
+        PMIX_INFO_LOAD(&app[0].info[0], PMIX_NOTIFY_COMPLETION, &flag, PMIX_BOOL);
+
+        start = get_time();
+        rc = PMIx_Spawn(NULL, 0, app, 1, appspace);
+        PMIX_APP_FREE(app, 1);
+        if (PMIX_SUCCESS != rc) {
+            fprintf(stderr, "PMIx_Spawn failed: %s\n", PMIx_Error_string(rc));
+            break;
+        }
+        DEBUG_WAIT_THREAD(&myrel.lock);
+        t = get_time() - start;
+        if (0 != myrel.lock.status) {
+            fprintf(stderr, "Job %s terminated with status %s\n",
+                    appspace, PMIx_Error_string(myrel.lock.status));
+            break;
+        }
+        DEBUG_DESTRUCT_MYREL(&myrel);
+        DEBUG_CONSTRUCT_MYREL(&myrel);
+
+        ttot += t;
+        if (tmin < 0.0 || t < tmin) {
+            tmin = t;
+        }
+        if (t > tmax) {
+            tmax = t;
+        }
+    }
+
+    if (n == reps && 0 < reps) {
+        fprintf(stderr, "LAUNCHRATE: %s x %d procs, %d reps\n", cmd, nprocs, reps);
+        fprintf(stderr, "\tper job:  min %8.3f  avg %8.3f  max %8.3f sec\n",
+                tmin, ttot / reps, tmax);
+        fprintf(stderr, "\trate:     %8.1f procs/sec\n", (double)nprocs * reps / ttot);
+    }
+    DEBUG_DESTRUCT_MYREL(&myrel);
+
+  done:
+    PMIx_tool_finalize();
+
+    return(0);
+}
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026      The PRRTE contributors.  All rights reserved.
+ * $COPYRIGHT$
+ *
+ * Additional copyrights may follow
+ *
+ * $HEADER$
+ *
+ * Stress the data server in the manner of a connect/accept-heavy
+ * application: every proc publishes a large number of "ports", then
+ * looks up ports published by its peers, waits on a port that has
+ * not yet been published, and finally unpublishes everything. Rank 0
+ * reports the time taken by each phase.
+ *
+ * Usage: prun -n <nprocs> ./pubstress [-n <keys per proc>] [-l <lookups per proc>]
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/time.h>
+
+#include <pmix.h>
+
+static double get_time(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+}
+
+int main(int argc, char **argv)
+{
+    pmix_proc_t myproc;
+    int rc;
+    pmix_value_t value;
+    pmix_value_t *val = &value;
+    pmix_proc_t proc;
+    uint32_t nprocs, peer;
+    pmix_info_t *info, winfo;
+    pmix_pdata_t *pdata;
+    char **keys;
+    int nkeys = 1000, nlookups = 1000;
+    int n, m;
+    double start, tpub = 0.0, tlook = 0.0, twait = 0.0, tunpub = 0.0;
+    bool ok = true;
+
+    for (n=1; n < argc; n++) {
+        if (0 == strcmp(argv[n], "-n") && n+1 < argc) {
+            nkeys = strtol(argv[++n], NULL, 10);
+        } else if (0 == strcmp(argv[n], "-l") && n+1 < argc) {
+            nlookups = strtol(argv[++n], NULL, 10);
+        }
+    }
+    if (0 >= nkeys) {
+        nkeys = 1;
+    }
+
+    /* init us */
+    if (PMIX_SUCCESS != (rc = PMIx_Init(&myproc, NULL, 0))) {
+        fprintf(stderr, "Client ns %s rank %d: PMIx_Init failed: %d\n", myproc.nspace, myproc.rank, rc);
+        exit(0);
+    }
+
+    /* get our job size */
+    PMIX_PROC_CONSTRUCT(&proc);
+    (void)strncpy(proc.nspace, myproc.nspace, PMIX_MAX_NSLEN);
+    proc.rank = PMIX_RANK_WILDCARD;
+    if (PMIX_SUCCESS != (rc = PMIx_Get(&proc, PMIX_JOB_SIZE, NULL, 0, &val))) {
+        fprintf(stderr, "Client ns %s rank %d: PMIx_Get job size failed: %d\n", myproc.nspace, myproc.rank, rc);
+        goto done;
+    }
+    nprocs = val->data.uint32;
+    PMIX_VALUE_RELEASE(val);
+
+    /* publish our ports */
+    PMIX_INFO_CREATE(info, nkeys);
+    for (n=0; n < nkeys; n++) {
+        snprintf(info[n].key, PMIX_MAX_KEYLEN, "PORT-%u-%d", myproc.rank, n);
+        info[n].value.type = PMIX_UINT32;
+        info[n].value.data.uint32 = (uint32_t)n;
+    }
+    start = get_time();
+    for (n=0; n < nkeys; n++) {
+        /* publish them one at a time as connect/accept would */
+        if (PMIX_SUCCESS != (rc = PMIx_Publish(&info[n], 1))) {
+            fprintf(stderr, "Client ns %s rank %d: PMIx_Publish failed: %d\n", myproc.nspace, myproc.rank, rc);
+            PMIX_INFO_FREE(info, nkeys);
+            goto done;
+        }
+    }
+    tpub = get_time() - start;
+    PMIX_INFO_FREE(info, nkeys);
+
+    /* wait for everyone to publish */
+    if (PMIX_SUCCESS != (rc = PMIx_Fence(&proc, 1, NULL, 0))) {
+        fprintf(stderr, "Client ns %s rank %d: PMIx_Fence failed: %d\n", myproc.nspace, myproc.rank, rc);
+        goto done;
+    }
+
+    /* lookup ports published by our peers */
+    PMIX_PDATA_CREATE(pdata, 1);
+    start = get_time();
+    for (n=0; n < nlookups; n++) {
+        peer = (myproc.rank + 1 + n) % nprocs;
+        m = n % nkeys;
+        PMIX_PDATA_DESTRUCT(&pdata[0]);
+        PMIX_PDATA_CONSTRUCT(&pdata[0]);
+        snprintf(pdata[0].key, PMIX_MAX_KEYLEN, "PORT-%u-%d", peer, m);
+        if (PMIX_SUCCESS != (rc = PMIx_Lookup(pdata, 1, NULL, 0))) {
+            fprintf(stderr, "Client ns %s rank %d: PMIx_Lookup of %s failed: %d\n",
+                    myproc.nspace, myproc.rank, pdata[0].key, rc);
+            ok = false;
+            break;
+        }
+        if (PMIX_UINT32 != pdata[0].value.type || (uint32_t)m != pdata[0].value.data.uint32 ||
+            peer != pdata[0].proc.rank) {
+            fprintf(stderr, "Client ns %s rank %d: PMIx_Lookup of %s returned wrong data\n",
+                    myproc.nspace, myproc.rank, pdata[0].key);
+            ok = false;
+            break;
+        }
+    }
+    tlook = get_time() - start;
+    PMIX_PDATA_FREE(pdata, 1);
+
+    /* have each proc wait on a port that its right-hand neighbor
+     * has not yet published - this exercises the pending queue */
+    peer = (myproc.rank + 1) % nprocs;
+    if (PMIX_SUCCESS != (rc = PMIx_Fence(&proc, 1, NULL, 0))) {
+        fprintf(stderr, "Client ns %s rank %d: PMIx_Fence failed: %d\n", myproc.nspace, myproc.rank, rc);
+        goto done;
+    }
+    start = get_time();
+    PMIX_INFO_CREATE(info, 1);
+    snprintf(info[0].key, PMIX_MAX_KEYLEN, "LATE-%u", myproc.rank);
+    info[0].value.type = PMIX_UINT32;
+    info[0].value.data.uint32 = myproc.rank;
+    if (PMIX_SUCCESS != (rc = PMIx_Publish(info, 1))) {
+        fprintf(stderr, "Client ns %s rank %d: PMIx_Publish failed: %d\n", myproc.nspace, myproc.rank, rc);
+        PMIX_INFO_FREE(info, 1);
+        goto done;
+    }
+    PMIX_INFO_FREE(info, 1);
+    PMIX_PDATA_CREATE(pdata, 1);
+    snprintf(pdata[0].key, PMIX_MAX_KEYLEN, "LATE-%u", peer);
+    PMIX_INFO_LOAD(&winfo, PMIX_WAIT, NULL, PMIX_BOOL);
+    if (PMIX_SUCCESS != (rc = PMIx_Lookup(pdata, 1, &winfo, 1))) {
+        fprintf(stderr, "Client ns %s rank %d: PMIx_Lookup with wait failed: %d\n",
+                myproc.nspace, myproc.rank, rc);
+        ok = false;
+    }
+    PMIX_INFO_DESTRUCT(&winfo);
+    PMIX_PDATA_FREE(pdata, 1);
+    twait = get_time() - start;
+
+    /* wait for everyone to complete their lookups */
+    if (PMIX_SUCCESS != (rc = PMIx_Fence(&proc, 1, NULL, 0))) {
+        fprintf(stderr, "Client ns %s rank %d: PMIx_Fence failed: %d\n", myproc.nspace, myproc.rank, rc);
+        goto done;
+    }
+
+    /* unpublish our ports */
+    keys = (char**)malloc(2 * sizeof(char*));
+    keys[0] = (char*)malloc(PMIX_MAX_KEYLEN+1);
+    keys[1] = NULL;
+    start = get_time();
+    for (n=0; n < nkeys; n++) {
+        snprintf(keys[0], PMIX_MAX_KEYLEN, "PORT-%u-%d", myproc.rank, n);
+        if (PMIX_SUCCESS != (rc = PMIx_Unpublish(keys, NULL, 0))) {
+            fprintf(stderr, "Client ns %s rank %d: PMIx_Unpublish failed: %d\n", myproc.nspace, myproc.rank, rc);
+            ok = false;
+            break;
+        }
+    }
+    tunpub = get_time() - start;
+    snprintf(keys[0], PMIX_MAX_KEYLEN, "LATE-%u", myproc.rank);
+    (void)PMIx_Unpublish(keys, NULL, 0);
+    free(keys[0]);
+    free(keys);
+
+    /* call fence again so everyone waits before leaving */
+    if (PMIX_SUCCESS != (rc = PMIx_Fence(&proc, 1, NULL, 0))) {
+        fprintf(stderr, "Client ns %s rank %d: PMIx_Fence failed: %d\n", myproc.nspace, myproc.rank, rc);
+        goto done;
+    }
+
+    if (0 == myproc.rank) {
+        fprintf(stderr, "PUBSTRESS %s: %u procs %d keys/proc %d lookups/proc\n",
+                ok ? "SUCCEEDED" : "FAILED", nprocs, nkeys, nlookups);
+        fprintf(stderr, "\tpublish:   %8.3f sec (%8.1f usec/op)\n", tpub, 1.0e6 * tpub / nkeys);
+        if (0 < nlookups) {
+            fprintf(stderr, "\tlookup:    %8.3f sec (%8.1f usec/op)\n", tlook, 1.0e6 * tlook / nlookups);
+        }
+        fprintf(stderr, "\twait:      %8.3f sec\n", twait);
+        fprintf(stderr, "\tunpublish: %8.3f sec (%8.1f usec/op)\n", tunpub, 1.0e6 * tunpub / nkeys);
+    }
+
+ done:
+    /* finalize us */
+    if (PMIX_SUCCESS != (rc = PMIx_Finalize(NULL, 0))) {
+        fprintf(stderr, "Client ns %s rank %d:PMIx_Finalize failed: %d\n", myproc.nspace, myproc.rank, rc);
+    }
+    fflush(stderr);
+    return(0);
+}
@@ -37,6 +37,7 @@ prte_hwloc_base_mbfa_t prte_hwloc_base_mbfa = PRTE_HWLOC_BASE_MBFA_WARN;
 prte_binding_policy_t prte_hwloc_default_binding_policy=0;
 char *prte_hwloc_default_cpu_list=NULL;
 char *prte_hwloc_base_topo_file = NULL;
+char *prte_hwloc_base_topo_cache_dir = NULL;
 int prte_hwloc_base_output = -1;
 bool prte_hwloc_default_use_hwthread_cpus = false;
 
@@ -193,6 +194,14 @@ int prte_hwloc_base_register(void)
                                  PRTE_MCA_BASE_VAR_TYPE_STRING, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
                                  PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_hwloc_base_topo_file);
 
+    prte_hwloc_base_topo_cache_dir = NULL;
+    (void) prte_mca_base_var_register("prte", "hwloc", "base", "topo_cache_dir",
+                                 "Node-local directory in which to cache the discovered topology so "
+                                 "that later daemon starts on this node can skip discovery (default: "
+                                 "no caching)",
+                                 PRTE_MCA_BASE_VAR_TYPE_STRING, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE, PRTE_INFO_LVL_9,
+                                 PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_hwloc_base_topo_cache_dir);
+
     /* register parameters */
     return PRTE_SUCCESS;
 }
@@ -47,6 +47,11 @@
 #if HAVE_FCNTL_H
 #include <fcntl.h>
 #endif
+#include <stdio.h>
+#include <errno.h>
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
 
 #include "src/runtime/prte_globals.h"
 #include "src/include/constants.h"
@@ -289,9 +294,241 @@ static void fill_cache_line_size(void)
     }
 }
 
+/* load a topology from an XML file or buffer */
+static int load_xml_topology(const char *topofile, const char *xmlbuf, int buflen)
+{
+    if (NULL != prte_hwloc_topology) {
+        hwloc_topology_destroy(prte_hwloc_topology);
+    }
+    if (0 != hwloc_topology_init(&prte_hwloc_topology)) {
+        return PRTE_ERR_NOT_SUPPORTED;
+    }
+    if ((NULL != topofile && 0 != hwloc_topology_set_xml(prte_hwloc_topology, topofile)) ||
+        (NULL == topofile && 0 != hwloc_topology_set_xmlbuffer(prte_hwloc_topology, xmlbuf, buflen))) {
+        hwloc_topology_destroy(prte_hwloc_topology);
+        PRTE_OUTPUT_VERBOSE((5, prte_hwloc_base_output,
+                             "hwloc:base:set_topology bad topo file"));
+        return PRTE_ERR_NOT_SUPPORTED;
+    }
+    /* since we are loading this from an external source, we have to
+     * explicitly set a flag so hwloc sets things up correctly
+     */
+    if (0 != prte_hwloc_base_topology_set_flags(prte_hwloc_topology,
+                                                HWLOC_TOPOLOGY_FLAG_IS_THISSYSTEM,
+                                                true)) {
+        hwloc_topology_destroy(prte_hwloc_topology);
+        return PRTE_ERR_NOT_SUPPORTED;
+    }
+    if (0 != hwloc_topology_load(prte_hwloc_topology)) {
+        hwloc_topology_destroy(prte_hwloc_topology);
+        PRTE_OUTPUT_VERBOSE((5, prte_hwloc_base_output,
+                             "hwloc:base:set_topology failed to load"));
+        return PRTE_ERR_NOT_SUPPORTED;
+    }
+    return PRTE_SUCCESS;
+}
+
+/*
+ * Topology cache
+ *
+ * Full discovery (particularly of I/O devices) can take a substantial
+ * amount of time on large nodes. If a cache directory was given, we
+ * save the XML of the discovered topology there and reuse it on later
+ * starts. The file name encodes everything that can change the
+ * result of discovery without the cache being notified: the host, the
+ * boot (so any hardware change requiring a reboot invalidates it), the
+ * hwloc version, and the cpus/mems this process is allowed to use (so
+ * a different cgroup gets its own entry). We only trust files owned
+ * by us that nobody else can write.
+ */
+#define PRTE_HWLOC_TOPO_CACHE_HDR "PRTE-TOPO-CACHE"
+
+static char *topo_cache_file(void)
+{
+    FILE *fp;
+    char line[1024], bootid[64], *file = NULL;
+    uint64_t hash = 14695981039346656037ULL;
+    size_t n;
+
+    /* without a boot id we cannot tell when the cache went stale */
+    if (NULL == (fp = fopen("/proc/sys/kernel/random/boot_id", "r"))) {
+        return NULL;
+    }
+    if (NULL == fgets(bootid, sizeof(bootid), fp)) {
+        fclose(fp);
+        return NULL;
+    }
+    fclose(fp);
+    bootid[strcspn(bootid, "\n")] = '\0';
+
+    /* hash the cpus and mems we are allowed to use */
+    if (NULL != (fp = fopen("/proc/self/status", "r"))) {
+        while (NULL != fgets(line, sizeof(line), fp)) {
+            if (0 == strncmp(line, "Cpus_allowed_list:", strlen("Cpus_allowed_list:")) ||
+                0 == strncmp(line, "Mems_allowed_list:", strlen("Mems_allowed_list:"))) {
+                for (n=0; '\0' != line[n]; n++) {
+                    hash ^= (unsigned char)line[n];
+                    hash *= 1099511628211ULL;
+                }
+            }
+        }
+        fclose(fp);
+    }
+
+    if (0 > asprintf(&file, "%s/prte-topo-%s-%s-%x-%lu-%016llx.xml",
+                     prte_hwloc_base_topo_cache_dir,
+                     prte_process_info.nodename, bootid,
+                     (unsigned)hwloc_get_api_version(),
+                     (unsigned long)getuid(), (unsigned long long)hash)) {
+        return NULL;
+    }
+    return file;
+}
+
+static double topo_cache_time(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec * 1000000.0 + (double)tv.tv_usec;
+}
+
+/* try to load the topology from the cache. The file holds a line
+ * with the discovery time and the binding support hwloc found -
+ * which is not part of the XML - followed by the XML itself */
+static bool topo_cache_load(char *file)
+{
+    struct stat buf;
+    struct hwloc_topology_support *support;
+    double start, usec;
+    char *data = NULL, *xml;
+    int pcpu, tcpu, pmem, tmem;
+    FILE *fp;
+
+    if (0 != stat(file, &buf)) {
+        return false;
+    }
+    if (buf.st_uid != getuid() || 0 != (buf.st_mode & (S_IWGRP | S_IWOTH)) ||
+        !S_ISREG(buf.st_mode) || 0 == buf.st_size) {
+        prte_output_verbose(1, prte_hwloc_base_output,
+                            "hwloc:base ignoring untrusted topology cache %s", file);
+        return false;
+    }
+
+    start = topo_cache_time();
+    if (NULL == (fp = fopen(file, "r"))) {
+        return false;
+    }
+    data = (char*)malloc(buf.st_size + 1);
+    if (NULL == data || buf.st_size != (off_t)fread(data, 1, buf.st_size, fp)) {
+        fclose(fp);
+        goto bad;
+    }
+    fclose(fp);
+    data[buf.st_size] = '\0';
+
+    if (5 != sscanf(data, PRTE_HWLOC_TOPO_CACHE_HDR " %lf %d %d %d %d",
+                    &usec, &pcpu, &tcpu, &pmem, &tmem) ||
+        NULL == (xml = strchr(data, '\n'))) {
+        goto bad;
+    }
+    xml++;
+    if (PRTE_SUCCESS != load_xml_topology(NULL, xml, (int)(buf.st_size - (xml - data)) + 1)) {
+        prte_hwloc_topology = NULL;
+        goto bad;
+    }
+    free(data);
+
+    /* restore what discovery found rather than assume binding works */
+    support = (struct hwloc_topology_support*)hwloc_topology_get_support(prte_hwloc_topology);
+    support->cpubind->set_thisproc_cpubind = pcpu;
+    support->cpubind->set_thisthread_cpubind = tcpu;
+    support->membind->set_thisproc_membind = pmem;
+    support->membind->set_thisthread_membind = tmem;
+
+    /* fill prte_cache_line_size global with the smallest L1 cache
+       line size */
+    fill_cache_line_size();
+
+    prte_output_verbose(1, prte_hwloc_base_output,
+                        "hwloc:base loaded topology from cache %s in %.0f usec (discovery took %.0f usec)",
+                        file, topo_cache_time() - start, usec);
+    return true;
+
+  bad:
+    /* corrupt - remove it so the next start rewrites it */
+    prte_output_verbose(1, prte_hwloc_base_output,
+                        "hwloc:base removing bad topology cache %s", file);
+    if (NULL != data) {
+        free(data);
+    }
+    unlink(file);
+    return false;
+}
+
+/* save the discovered topology to the cache */
+static void topo_cache_store(char *file, double usec)
+{
+    struct hwloc_topology_support *support;
+    char *tmp = NULL, *xml = NULL;
+    int fd, len;
+    FILE *fp;
+    bool ok;
+
+    if (PRTE_SUCCESS != prte_os_dirpath_create(prte_hwloc_base_topo_cache_dir, S_IRWXU)) {
+        return;
+    }
+#if HWLOC_API_VERSION < 0x20000
+    if (0 != hwloc_topology_export_xmlbuffer(prte_hwloc_topology, &xml, &len)) {
+#else
+    if (0 != hwloc_topology_export_xmlbuffer(prte_hwloc_topology, &xml, &len, 0)) {
+#endif
+        return;
+    }
+    /* write to a temp file and rename it into place so that
+     * concurrent starts never see a partial file */
+    if (0 > asprintf(&tmp, "%s.XXXXXX", file)) {
+        hwloc_free_xmlbuffer(prte_hwloc_topology, xml);
+        return;
+    }
+    if (0 > (fd = mkstemp(tmp))) {
+        hwloc_free_xmlbuffer(prte_hwloc_topology, xml);
+        free(tmp);
+        return;
+    }
+    if (NULL == (fp = fdopen(fd, "w"))) {
+        close(fd);
+        unlink(tmp);
+        hwloc_free_xmlbuffer(prte_hwloc_topology, xml);
+        free(tmp);
+        return;
+    }
+
+    support = (struct hwloc_topology_support*)hwloc_topology_get_support(prte_hwloc_topology);
+    ok = 0 < fprintf(fp, PRTE_HWLOC_TOPO_CACHE_HDR " %.0f %d %d %d %d\n", usec,
+                     (int)support->cpubind->set_thisproc_cpubind,
+                     (int)support->cpubind->set_thisthread_cpubind,
+                     (int)support->membind->set_thisproc_membind,
+                     (int)support->membind->set_thisthread_membind);
+    /* the length includes the terminating NUL */
+    ok = ok && (size_t)(len - 1) == fwrite(xml, 1, len - 1, fp);
+    ok = (0 == fclose(fp)) && ok;
+    hwloc_free_xmlbuffer(prte_hwloc_topology, xml);
+
+    if (!ok || 0 != rename(tmp, file)) {
+        unlink(tmp);
+    } else {
+        prte_output_verbose(1, prte_hwloc_base_output,
+                            "hwloc:base saved topology to cache %s", file);
+    }
+    free(tmp);
+}
+
 int prte_hwloc_base_get_topology(void)
 {
     int rc;
+    char *cache = NULL;
+    double start;
 
     prte_output_verbose(2, prte_hwloc_base_output,
                          "hwloc:base:get_topology");
@@ -301,15 +538,29 @@ int prte_hwloc_base_get_topology(void)
         return PRTE_SUCCESS;
     }
 
-    if (NULL == prte_hwloc_base_topo_file) {
+    if (NULL == prte_hwloc_base_topo_file && NULL != prte_hwloc_base_topo_cache_dir) {
+        cache = topo_cache_file();
+    }
+
+    if (NULL != cache && topo_cache_load(cache)) {
+        free(cache);
+    } else if (NULL == prte_hwloc_base_topo_file) {
         prte_output_verbose(1, prte_hwloc_base_output,
                             "hwloc:base discovering topology");
+        start = topo_cache_time();
         if (0 != hwloc_topology_init(&prte_hwloc_topology) ||
             0 != prte_hwloc_base_topology_set_flags(prte_hwloc_topology, 0, true) ||
             0 != hwloc_topology_load(prte_hwloc_topology)) {
             PRTE_ERROR_LOG(PRTE_ERR_NOT_SUPPORTED);
+            if (NULL != cache) {
+                free(cache);
+            }
             return PRTE_ERR_NOT_SUPPORTED;
         }
+        if (NULL != cache) {
+            topo_cache_store(cache, topo_cache_time() - start);
+            free(cache);
+        }
     } else {
         prte_output_verbose(1, prte_hwloc_base_output,
                             "hwloc:base loading topology from file %s",
@@ -340,36 +591,13 @@ int prte_hwloc_base_get_topology(void)
 int prte_hwloc_base_set_topology(char *topofile)
 {
     struct hwloc_topology_support *support;
+    int rc;
 
      PRTE_OUTPUT_VERBOSE((5, prte_hwloc_base_output,
                           "hwloc:base:set_topology %s", topofile));
 
-   if (NULL != prte_hwloc_topology) {
-        hwloc_topology_destroy(prte_hwloc_topology);
-    }
-    if (0 != hwloc_topology_init(&prte_hwloc_topology)) {
-        return PRTE_ERR_NOT_SUPPORTED;
-    }
-    if (0 != hwloc_topology_set_xml(prte_hwloc_topology, topofile)) {
-        hwloc_topology_destroy(prte_hwloc_topology);
-        PRTE_OUTPUT_VERBOSE((5, prte_hwloc_base_output,
-                             "hwloc:base:set_topology bad topo file"));
-        return PRTE_ERR_NOT_SUPPORTED;
-    }
-    /* since we are loading this from an external source, we have to
-     * explicitly set a flag so hwloc sets things up correctly
-     */
-    if (0 != prte_hwloc_base_topology_set_flags(prte_hwloc_topology,
-                                                HWLOC_TOPOLOGY_FLAG_IS_THISSYSTEM,
-                                                true)) {
-        hwloc_topology_destroy(prte_hwloc_topology);
-        return PRTE_ERR_NOT_SUPPORTED;
-    }
-    if (0 != hwloc_topology_load(prte_hwloc_topology)) {
-        hwloc_topology_destroy(prte_hwloc_topology);
-        PRTE_OUTPUT_VERBOSE((5, prte_hwloc_base_output,
-                             "hwloc:base:set_topology failed to load"));
-        return PRTE_ERR_NOT_SUPPORTED;
+    if (PRTE_SUCCESS != (rc = load_xml_topology(topofile, NULL, 0))) {
+        return rc;
     }
 
     /* unfortunately, hwloc does not include support info in its
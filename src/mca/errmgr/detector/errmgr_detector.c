@@ -41,6 +41,7 @@
 #include "src/mca/grpcomm/bmg/grpcomm_bmg.h"
 #include "src/mca/ess/ess.h"
 #include "src/mca/state/state.h"
+#include "src/mca/state/base/base.h"
 
 #include "src/prted/pmix/pmix_server_internal.h"
 #include "src/prted/pmix/pmix_server.h"
@@ -217,7 +218,9 @@ static void error_notify_cbfunc(size_t evhdlr_registration_id,
                     return;
                 }
 
-                /* send this process's info to hnp */
+                /* send this process's info to hnp - after any
+                 * queued state updates */
+                prte_state_base_flush_updates();
                 if (0 > (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, alert,
                                                       PRTE_RML_TAG_PLM,
                                                       prte_rml_send_callback, NULL))) {
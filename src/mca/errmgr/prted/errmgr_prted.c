@@ -46,6 +46,7 @@
 #include "src/mca/routed/routed.h"
 #include "src/mca/ess/ess.h"
 #include "src/mca/state/state.h"
+#include "src/mca/state/base/base.h"
 
 #include "src/runtime/prte_wait.h"
 #include "src/runtime/prte_quit.h"
@@ -214,6 +215,7 @@ static void prted_abort(int error_code, char *fmt, ...)
     }
 
     /* send it */
+    prte_state_base_flush_updates();
     if (0 > (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, alert,
                                           PRTE_RML_TAG_PLM,
                                           prte_rml_send_callback, NULL))) {
@@ -308,6 +310,7 @@ static void job_errors(int fd, short args, void *cbdata)
         goto cleanup;
     }
     /* send it */
+    prte_state_base_flush_updates();
     if (0 > (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, alert,
                                           PRTE_RML_TAG_PLM,
                                           prte_rml_send_callback, NULL))) {
@@ -518,6 +521,7 @@ static void proc_errors(int fd, short args, void *cbdata)
                                  PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                                  PRTE_NAME_PRINT(&child->name),
                                  jdata->num_local_procs));
+            prte_state_base_flush_updates();
             if (0 > (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, alert,
                                                   PRTE_RML_TAG_PLM,
                                                   prte_rml_send_callback, NULL))) {
@@ -630,6 +634,7 @@ static void proc_errors(int fd, short args, void *cbdata)
                                  PRTE_NAME_PRINT(&child->name),
                                  jdata->num_local_procs));
             /* send it */
+            prte_state_base_flush_updates();
             if (0 > (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, alert,
                                                   PRTE_RML_TAG_PLM,
                                                   prte_rml_send_callback, NULL))) {
@@ -688,6 +693,7 @@ static void proc_errors(int fd, short args, void *cbdata)
         PRTE_RELEASE(jdata);
 
         /* send it */
+        prte_state_base_flush_updates();
         if (0 > (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, alert,
                                               PRTE_RML_TAG_PLM,
                                               prte_rml_send_callback, NULL))) {
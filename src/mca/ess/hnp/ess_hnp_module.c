@@ -423,7 +423,7 @@ static int rte_init(int argc, char **argv)
     /* generate the signature */
     prte_topo_signature = prte_hwloc_base_get_topo_signature(prte_hwloc_topology);
     t->sig = strdup(prte_topo_signature);
-    prte_pointer_array_add(prte_node_topologies, t);
+    prte_add_topology(t);
     node->topology = t;
     if (15 < prte_output_get_verbosity(prte_ess_base_framework.framework_output)) {
         char *output = NULL;
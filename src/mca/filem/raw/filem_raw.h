@@ -18,6 +18,10 @@
 
 #include "prte_config.h"
 
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+
 #include "src/mca/mca.h"
 #include "src/class/prte_object.h"
 #include "src/event/event-internal.h"
@@ -30,8 +34,11 @@ PRTE_MODULE_EXPORT extern prte_filem_base_component_t prte_filem_raw_component;
 PRTE_EXPORT extern prte_filem_base_module_t prte_filem_raw_module;
 
 extern bool prte_filem_raw_flatten_trees;
+extern size_t prte_filem_raw_chunk_size;
+extern int prte_filem_raw_window;
 
-#define PRTE_FILEM_RAW_CHUNK_MAX 16384
+#define PRTE_FILEM_RAW_CHUNK_DEFAULT    (1024 * 1024)
+#define PRTE_FILEM_RAW_CHUNK_MIN        4096
 
 /* local classes */
 typedef struct {
@@ -49,12 +56,27 @@ typedef struct {
     prte_app_idx_t app_idx;
     prte_event_t ev;
     bool pending;
+    int fd;
+    int32_t id;
     char *src;
     char *file;
     int32_t type;
     int32_t nchunk;
     int status;
     pmix_rank_t nrecvd;
+    /* source data - mapped if possible, otherwise
+     * read into a bounce buffer one chunk at a time */
+    unsigned char *map;
+    size_t size;
+    size_t offset;
+    unsigned char *buf;
+    /* flow control - the daemons report progress every
+     * "credit" chunks, and we stall when the slowest of
+     * them falls "window" chunks behind */
+    bool stalled;
+    int32_t credit;
+    int32_t acked;
+    struct timeval start;
 } prte_filem_raw_xfer_t;
 PRTE_CLASS_DECLARATION(prte_filem_raw_xfer_t);
 
@@ -64,6 +86,9 @@ typedef struct {
     prte_event_t ev;
     bool pending;
     int fd;
+    int32_t id;
+    int32_t credit;
+    int status;
     char *file;
     char *top;
     char *fullpath;
@@ -73,10 +98,26 @@ typedef struct {
 } prte_filem_raw_incoming_t;
 PRTE_CLASS_DECLARATION(prte_filem_raw_incoming_t);
 
+/* progress reports for a file from a daemon and its children
+ * in the routing tree - a credit point is passed up to the
+ * parent once all of them have reached it */
 typedef struct {
     prte_list_item_t super;
-    int numbytes;
-    unsigned char data[PRTE_FILEM_RAW_CHUNK_MAX];
+    int32_t id;
+    /* lowest credit point not yet passed up */
+    int32_t mark;
+    /* reports received for mark, mark+1, ... */
+    int32_t nslots;
+    pmix_rank_t *counts;
+} prte_filem_raw_credit_t;
+PRTE_CLASS_DECLARATION(prte_filem_raw_credit_t);
+
+typedef struct {
+    prte_list_item_t super;
+    int32_t nchunk;
+    size_t numbytes;
+    unsigned char *data;
+    unsigned char *base;
 } prte_filem_raw_output_t;
 PRTE_CLASS_DECLARATION(prte_filem_raw_output_t);
 
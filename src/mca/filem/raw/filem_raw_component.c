@@ -38,6 +38,8 @@ static int filem_raw_close(void);
 static int filem_raw_query(prte_mca_base_module_t **module, int *priority);
 
 bool prte_filem_raw_flatten_trees=false;
+size_t prte_filem_raw_chunk_size = PRTE_FILEM_RAW_CHUNK_DEFAULT;
+int prte_filem_raw_window = 8;
 
 prte_filem_base_component_t prte_filem_raw_component = {
     .base_version = {
@@ -72,6 +74,30 @@ static int filem_raw_register(void)
                                            PRTE_MCA_BASE_VAR_SCOPE_READONLY,
                                            &prte_filem_raw_flatten_trees);
 
+    prte_filem_raw_chunk_size = PRTE_FILEM_RAW_CHUNK_DEFAULT;
+    (void) prte_mca_base_component_var_register(c, "chunk_size",
+                                           "Number of bytes of a file to send in each fragment of the broadcast to the daemons",
+                                           PRTE_MCA_BASE_VAR_TYPE_SIZE_T, NULL, 0,
+                                           PRTE_MCA_BASE_VAR_FLAG_NONE,
+                                           PRTE_INFO_LVL_9,
+                                           PRTE_MCA_BASE_VAR_SCOPE_READONLY,
+                                           &prte_filem_raw_chunk_size);
+    if (prte_filem_raw_chunk_size < PRTE_FILEM_RAW_CHUNK_MIN) {
+        prte_filem_raw_chunk_size = PRTE_FILEM_RAW_CHUNK_MIN;
+    }
+
+    prte_filem_raw_window = 8;
+    (void) prte_mca_base_component_var_register(c, "window",
+                                           "Max number of fragments of a file that can be in flight before the slowest daemon has written them out (0 => unlimited)",
+                                           PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0,
+                                           PRTE_MCA_BASE_VAR_FLAG_NONE,
+                                           PRTE_INFO_LVL_9,
+                                           PRTE_MCA_BASE_VAR_SCOPE_READONLY,
+                                           &prte_filem_raw_window);
+    if (prte_filem_raw_window < 0) {
+        prte_filem_raw_window = 0;
+    }
+
     return PRTE_SUCCESS;
 }
 
@@ -24,6 +24,7 @@
 #include <stdlib.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #ifdef HAVE_UNISTD_H
 #include <unistd.h>
 #endif  /* HAVE_UNISTD_H */
@@ -54,6 +55,7 @@
 #include "src/mca/errmgr/errmgr.h"
 #include "src/mca/grpcomm/base/base.h"
 #include "src/mca/rml/rml.h"
+#include "src/mca/routed/routed.h"
 
 #include "src/mca/filem/filem.h"
 #include "src/mca/filem/base/base.h"
@@ -88,6 +90,8 @@ prte_filem_base_module_t prte_filem_raw_module = {
 static prte_list_t outbound_files;
 static prte_list_t incoming_files;
 static prte_list_t positioned_files;
+static prte_list_t credit_points;
+static int32_t next_xfer_id = 0;
 
 static void send_chunk(int fd, short argc, void *cbdata);
 static void recv_files(int status, pmix_proc_t* sender,
@@ -96,7 +100,12 @@ static void recv_files(int status, pmix_proc_t* sender,
 static void recv_ack(int status, pmix_proc_t* sender,
                      pmix_data_buffer_t* buffer, prte_rml_tag_t tag,
                      void* cbdata);
+static void recv_credit(int status, pmix_proc_t* sender,
+                        pmix_data_buffer_t* buffer, prte_rml_tag_t tag,
+                        void* cbdata);
 static void write_handler(int fd, short event, void *cbdata);
+static void send_ack(pmix_proc_t *dest, prte_rml_tag_t tag,
+                     int32_t id, int status, int32_t mark);
 
 static char *filem_session_dir(void)
 {
@@ -112,6 +121,7 @@ static char *filem_session_dir(void)
 static int raw_init(void)
 {
     PRTE_CONSTRUCT(&incoming_files, prte_list_t);
+    PRTE_CONSTRUCT(&credit_points, prte_list_t);
 
     /* start a recv to catch any files sent to me */
     prte_rml.recv_buffer_nb(PRTE_NAME_WILDCARD,
@@ -120,6 +130,13 @@ static int raw_init(void)
                             recv_files,
                             NULL);
 
+    /* and one to catch progress reports from my children */
+    prte_rml.recv_buffer_nb(PRTE_NAME_WILDCARD,
+                            PRTE_RML_TAG_FILEM_CREDIT,
+                            PRTE_RML_PERSISTENT,
+                            recv_credit,
+                            NULL);
+
     /* if I'm the HNP, start a recv to catch acks sent to me */
     if (PRTE_PROC_IS_MASTER) {
         PRTE_CONSTRUCT(&outbound_files, prte_list_t);
@@ -142,6 +159,7 @@ static int raw_finalize(void)
         PRTE_RELEASE(item);
     }
     PRTE_DESTRUCT(&incoming_files);
+    PRTE_LIST_DESTRUCT(&credit_points);
 
     if (PRTE_PROC_IS_MASTER) {
         while (NULL != (item = prte_list_remove_first(&outbound_files))) {
@@ -183,6 +201,127 @@ static void xfer_complete(int status, prte_filem_raw_xfer_t *xfer)
     }
 }
 
+static void xfer_progress(int32_t id, int32_t mark)
+{
+    prte_filem_raw_outbound_t *outbound;
+    prte_filem_raw_xfer_t *xfer;
+
+    PRTE_LIST_FOREACH(outbound, &outbound_files, prte_filem_raw_outbound_t) {
+        PRTE_LIST_FOREACH(xfer, &outbound->xfers, prte_filem_raw_xfer_t) {
+            if (id != xfer->id) {
+                continue;
+            }
+            if (0 == xfer->credit) {
+                /* flow control is off for this file */
+                return;
+            }
+            /* every daemon has now reached this credit point */
+            xfer->acked = mark + 1;
+            PRTE_OUTPUT_VERBOSE((10, prte_filem_base_framework.framework_output,
+                                 "%s filem:raw: file %s acked through chunk %d",
+                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), xfer->file,
+                                 xfer->acked * xfer->credit));
+            /* restart the reader if the window has opened up */
+            if (xfer->stalled &&
+                xfer->nchunk < (xfer->acked * xfer->credit) + prte_filem_raw_window) {
+                xfer->stalled = false;
+                xfer->pending = true;
+                PRTE_POST_OBJECT(xfer);
+                prte_event_add(&xfer->ev, 0);
+            }
+            return;
+        }
+    }
+}
+
+/* record that we or one of our children in the routing tree have
+ * reached a credit point for a file. Each credit point is passed
+ * up to our parent only once all of us have reached it, so the HNP
+ * sees one report per child instead of one per daemon */
+static void report_progress(int32_t id, int32_t mark)
+{
+    prte_filem_raw_credit_t *cp = NULL, *ptr;
+    pmix_rank_t *tmp, nexpected;
+    int32_t n;
+
+    PRTE_LIST_FOREACH(ptr, &credit_points, prte_filem_raw_credit_t) {
+        if (id == ptr->id) {
+            cp = ptr;
+            break;
+        }
+    }
+    if (NULL == cp) {
+        cp = PRTE_NEW(prte_filem_raw_credit_t);
+        cp->id = id;
+        prte_list_append(&credit_points, &cp->super);
+    }
+    /* each of us reports its credit points in order, so nothing
+     * can arrive for a point we already passed up */
+    if (mark < cp->mark) {
+        PRTE_ERROR_LOG(PRTE_ERR_BAD_PARAM);
+        return;
+    }
+    if (cp->nslots <= mark - cp->mark) {
+        n = mark - cp->mark + 1;
+        tmp = (pmix_rank_t*)realloc(cp->counts, n * sizeof(pmix_rank_t));
+        if (NULL == tmp) {
+            PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+            return;
+        }
+        memset(&tmp[cp->nslots], 0, (n - cp->nslots) * sizeof(pmix_rank_t));
+        cp->counts = tmp;
+        cp->nslots = n;
+    }
+    cp->counts[mark - cp->mark]++;
+
+    nexpected = prte_routed.num_routes() + 1;
+    while (nexpected <= cp->counts[0]) {
+        if (PRTE_PROC_IS_MASTER) {
+            xfer_progress(id, cp->mark);
+        } else {
+            send_ack(PRTE_PROC_MY_PARENT, PRTE_RML_TAG_FILEM_CREDIT,
+                     id, PRTE_SUCCESS, cp->mark);
+        }
+        memmove(cp->counts, &cp->counts[1], (cp->nslots - 1) * sizeof(pmix_rank_t));
+        cp->counts[cp->nslots - 1] = 0;
+        cp->mark++;
+    }
+}
+
+static void recv_credit(int status, pmix_proc_t* sender,
+                        pmix_data_buffer_t* buffer, prte_rml_tag_t tag,
+                        void* cbdata)
+{
+    int32_t id, mark;
+    int st, n, rc;
+
+    n=1;
+    rc = PMIx_Data_unpack(NULL, buffer, &id, &n, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return;
+    }
+    n=1;
+    rc = PMIx_Data_unpack(NULL, buffer, &st, &n, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return;
+    }
+    n=1;
+    rc = PMIx_Data_unpack(NULL, buffer, &mark, &n, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return;
+    }
+
+    PRTE_OUTPUT_VERBOSE((10, prte_filem_base_framework.framework_output,
+                         "%s filem:raw: recvd credit point %d for xfer %d from %s",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                         mark, id, PRTE_NAME_PRINT(sender)));
+
+    report_progress(id, mark);
+}
+
 static void recv_ack(int status, pmix_proc_t* sender,
                      pmix_data_buffer_t* buffer, prte_rml_tag_t tag,
                      void* cbdata)
@@ -190,12 +329,14 @@ static void recv_ack(int status, pmix_proc_t* sender,
     prte_list_item_t *item, *itm;
     prte_filem_raw_outbound_t *outbound;
     prte_filem_raw_xfer_t *xfer;
-    char *file;
+    int32_t id, mark;
     int st, n, rc;
+    struct timeval now;
+    double elapsed;
 
-    /* unpack the file */
+    /* unpack the transfer id */
     n=1;
-    rc = PMIx_Data_unpack(NULL, buffer, &file, &n, PMIX_STRING);
+    rc = PMIx_Data_unpack(NULL, buffer, &id, &n, PMIX_INT32);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
         return;
@@ -209,10 +350,20 @@ static void recv_ack(int status, pmix_proc_t* sender,
         return;
     }
 
+    /* unpack the credit point - always negative here as the
+     * daemon is reporting it is done with the file
+     */
+    n=1;
+    rc = PMIx_Data_unpack(NULL, buffer, &mark, &n, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return;
+    }
+
     PRTE_OUTPUT_VERBOSE((1, prte_filem_base_framework.framework_output,
-                         "%s filem:raw: recvd ack from %s for file %s status %d",
+                         "%s filem:raw: recvd ack from %s for xfer %d mark %d status %d",
                          PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                         PRTE_NAME_PRINT(sender), file, st));
+                         PRTE_NAME_PRINT(sender), id, mark, st));
 
     /* find the corresponding outbound object */
     for (item = prte_list_get_first(&outbound_files);
@@ -223,24 +374,46 @@ static void recv_ack(int status, pmix_proc_t* sender,
              itm != prte_list_get_end(&outbound->xfers);
              itm = prte_list_get_next(itm)) {
             xfer = (prte_filem_raw_xfer_t*)itm;
-            if (0 == strcmp(file, xfer->file)) {
-                /* if the status isn't success, record it */
-                if (0 != st) {
-                    xfer->status = st;
+            if (id != xfer->id) {
+                continue;
+            }
+            /* if the status isn't success, record it */
+            if (0 != st) {
+                xfer->status = st;
+                /* the failed daemon won't report any further
+                 * progress, so stop waiting on it
+                 */
+                if (0 != xfer->credit) {
+                    xfer->credit = 0;
+                    if (xfer->stalled) {
+                        xfer->stalled = false;
+                        xfer->pending = true;
+                        PRTE_POST_OBJECT(xfer);
+                        prte_event_add(&xfer->ev, 0);
+                    }
                 }
-                /* track number of respondents */
-                xfer->nrecvd++;
-                /* if all daemons have responded, then this is complete */
-                if (xfer->nrecvd == prte_process_info.num_daemons) {
-                    PRTE_OUTPUT_VERBOSE((1, prte_filem_base_framework.framework_output,
-                                         "%s filem:raw: xfer complete for file %s status %d",
-                                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                         file, xfer->status));
-                    xfer_complete(xfer->status, xfer);
+            }
+            /* track number of respondents */
+            xfer->nrecvd++;
+            /* if all daemons have responded, then this is complete */
+            if (xfer->nrecvd == prte_process_info.num_daemons) {
+                if (0 < prte_output_get_verbosity(prte_filem_base_framework.framework_output)) {
+                    gettimeofday(&now, NULL);
+                    elapsed = (double)(now.tv_sec - xfer->start.tv_sec) +
+                              (double)(now.tv_usec - xfer->start.tv_usec) / 1000000.0;
+                    prte_output(0, "%s filem:raw: positioned %s (%lu bytes) on %lu daemons in %.3f sec (%.2f MB/sec)",
+                                PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), xfer->file,
+                                (unsigned long)xfer->offset,
+                                (unsigned long)prte_process_info.num_daemons, elapsed,
+                                (0.0 < elapsed) ? ((double)xfer->offset / (1024.0 * 1024.0)) / elapsed : 0.0);
                 }
-                free(file);
-                return;
+                PRTE_OUTPUT_VERBOSE((1, prte_filem_base_framework.framework_output,
+                                     "%s filem:raw: xfer complete for file %s status %d",
+                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                                     xfer->file, xfer->status));
+                xfer_complete(xfer->status, xfer);
             }
+            return;
         }
     }
 }
@@ -260,6 +433,7 @@ static int raw_preposition_files(prte_job_t *jdata,
     char *cptr, *nxt, *filestring;
     prte_list_t fsets;
     bool already_sent;
+    struct stat st;
 
     PRTE_OUTPUT_VERBOSE((1, prte_filem_base_framework.framework_output,
                          "%s filem:raw: preposition files for job %s",
@@ -497,6 +671,47 @@ static int raw_preposition_files(prte_job_t *jdata,
                              "%s filem:raw: setting up to position file %s",
                              PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), fs->local_target));
         xfer = PRTE_NEW(prte_filem_raw_xfer_t);
+        xfer->fd = fd;
+        xfer->id = next_xfer_id++;
+        /* map regular files so each chunk is packed straight from
+         * the page cache - fall back to reading into a bounce
+         * buffer if we can't
+         */
+        if (0 == fstat(fd, &st) && S_ISREG(st.st_mode) && 0 < st.st_size) {
+            xfer->map = (unsigned char*)mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (MAP_FAILED == xfer->map) {
+                xfer->map = NULL;
+            } else {
+                xfer->size = st.st_size;
+#ifdef MADV_SEQUENTIAL
+                (void)madvise(xfer->map, xfer->size, MADV_SEQUENTIAL);
+#endif
+            }
+        }
+        if (NULL == xfer->map) {
+            xfer->buf = (unsigned char*)malloc(prte_filem_raw_chunk_size);
+            if (NULL == xfer->buf) {
+                PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+                /* releasing the outbound also stops any transfers
+                 * we already started for it */
+                PRTE_RELEASE(xfer);
+                PRTE_RELEASE(item);
+                PRTE_LIST_DESTRUCT(&fsets);
+                prte_list_remove_item(&outbound_files, &outbound->super);
+                PRTE_RELEASE(outbound);
+                return PRTE_ERR_OUT_OF_RESOURCE;
+            }
+        }
+        /* setup flow control - the daemons report each time they
+         * have written half a window, which keeps a full window
+         * of chunks moving down the tree
+         */
+        if (0 < prte_filem_raw_window) {
+            xfer->credit = prte_filem_raw_window / 2;
+            if (0 == xfer->credit) {
+                xfer->credit = 1;
+            }
+        }
         /* save the source so we can avoid duplicate transfers */
         xfer->src = strdup(fs->local_target);
         /* strip any leading '.' directories to avoid
@@ -539,6 +754,7 @@ static int raw_preposition_files(prte_job_t *jdata,
         xfer->app_idx = fs->app_idx;
         xfer->outbound = outbound;
         prte_list_append(&outbound->xfers, &xfer->super);
+        gettimeofday(&xfer->start, NULL);
         prte_event_set(prte_event_base, &xfer->ev, fd, PRTE_EV_READ, send_chunk, xfer);
         prte_event_set_priority(&xfer->ev, PRTE_MSG_PRI);
         xfer->pending = true;
@@ -715,6 +931,10 @@ static int raw_link_local_files(prte_job_t *jdata,
              item != prte_list_get_end(&incoming_files);
              item = prte_list_get_next(item)) {
             inbnd = (prte_filem_raw_incoming_t*)item;
+            if (PRTE_SUCCESS != inbnd->status) {
+                /* failed and already reported */
+                continue;
+            }
             PRTE_OUTPUT_VERBOSE((1, prte_filem_base_framework.framework_output,
                                  "%s filem:raw: checking file %s",
                                  PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), inbnd->file));
@@ -754,8 +974,8 @@ static int raw_link_local_files(prte_job_t *jdata,
 static void send_chunk(int fd, short argc, void *cbdata)
 {
     prte_filem_raw_xfer_t *rev = (prte_filem_raw_xfer_t*)cbdata;
-    unsigned char data[PRTE_FILEM_RAW_CHUNK_MAX];
-    int32_t numbytes;
+    pmix_byte_object_t bo;
+    ssize_t numbytes;
     int rc;
     pmix_data_buffer_t chunk;
     prte_grpcomm_signature_t *sig;
@@ -765,29 +985,54 @@ static void send_chunk(int fd, short argc, void *cbdata)
     /* flag that event has fired */
     rev->pending = false;
 
-    /* read up to the fragment size */
-    numbytes = read(fd, data, sizeof(data));
-
-    if (numbytes < 0) {
-        /* either we have a connection error or it was a non-blocking read */
+    /* if the slowest daemon is a full window behind, then
+     * hold off until it catches up - the ack will restart us
+     */
+    if (0 < rev->credit &&
+        rev->nchunk >= (rev->acked * rev->credit) + prte_filem_raw_window) {
+        PRTE_OUTPUT_VERBOSE((10, prte_filem_base_framework.framework_output,
+                             "%s filem:raw: window full at chunk %d for file %s",
+                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                             rev->nchunk, rev->file));
+        rev->stalled = true;
+        return;
+    }
 
-        /* non-blocking, retry */
-        if (EAGAIN == errno || EINTR == errno) {
-            PRTE_POST_OBJECT(rev);
-            prte_event_add(&rev->ev, 0);
-            return;
+    if (NULL != rev->map) {
+        /* take the next fragment straight from the mapping */
+        numbytes = rev->size - rev->offset;
+        if ((size_t)numbytes > prte_filem_raw_chunk_size) {
+            numbytes = prte_filem_raw_chunk_size;
         }
+        bo.bytes = (char*)(rev->map + rev->offset);
+    } else {
+        /* read up to the fragment size */
+        numbytes = read(fd, rev->buf, prte_filem_raw_chunk_size);
 
-        PRTE_OUTPUT_VERBOSE((1, prte_filem_base_framework.framework_output,
-                             "%s filem:raw:read error on file %s",
-                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), rev->file));
+        if (numbytes < 0) {
+            /* either we have a connection error or it was a non-blocking read */
 
-        /* Un-recoverable error. Allow the code to flow as usual in order to
-         * to send the zero bytes message up the stream, and then close the
-         * file descriptor and delete the event.
-         */
-        numbytes = 0;
+            /* non-blocking, retry */
+            if (EAGAIN == errno || EINTR == errno) {
+                rev->pending = true;
+                PRTE_POST_OBJECT(rev);
+                prte_event_add(&rev->ev, 0);
+                return;
+            }
+
+            PRTE_OUTPUT_VERBOSE((1, prte_filem_base_framework.framework_output,
+                                 "%s filem:raw:read error on file %s",
+                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), rev->file));
+
+            /* Un-recoverable error. Allow the code to flow as usual in order to
+             * to send the zero bytes message up the stream, and then close the
+             * file descriptor and delete the event.
+             */
+            numbytes = 0;
+        }
+        bo.bytes = (char*)rev->buf;
     }
+    bo.size = numbytes;
 
     /* if job termination has been ordered, just ignore the
      * data and delete the read event
@@ -800,43 +1045,57 @@ static void send_chunk(int fd, short argc, void *cbdata)
     PRTE_OUTPUT_VERBOSE((1, prte_filem_base_framework.framework_output,
                          "%s filem:raw:read handler sending chunk %d of %d bytes for file %s",
                          PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                         rev->nchunk, numbytes, rev->file));
+                         rev->nchunk, (int)numbytes, rev->file));
 
-    /* package it for transmission */
+    /* package it for transmission - the name and other info about
+     * the file only go with the first chunk, after which the
+     * daemons identify it by the transfer id
+     */
     PMIX_DATA_BUFFER_CONSTRUCT(&chunk);
-    rc = PMIx_Data_pack(NULL, &chunk, &rev->file, 1, PMIX_STRING);
+    rc = PMIx_Data_pack(NULL, &chunk, &rev->id, 1, PMIX_INT32);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
-        close(fd);
         PMIX_DATA_BUFFER_DESTRUCT(&chunk);
         return;
     }
     rc = PMIx_Data_pack(NULL, &chunk, &rev->nchunk, 1, PMIX_INT32);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
-        close(fd);
         PMIX_DATA_BUFFER_DESTRUCT(&chunk);
         return;
     }
-    rc = PMIx_Data_pack(NULL, &chunk, data, numbytes, PMIX_BYTE);
-    if (PMIX_SUCCESS != rc) {
-        PMIX_ERROR_LOG(rc);
-        close(fd);
-        PMIX_DATA_BUFFER_DESTRUCT(&chunk);
-        return;
-    }
-    /* if it is the first chunk, then add file type and index of the app */
     if (0 == rev->nchunk) {
+        rc = PMIx_Data_pack(NULL, &chunk, &rev->file, 1, PMIX_STRING);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            PMIX_DATA_BUFFER_DESTRUCT(&chunk);
+            return;
+        }
         rc = PMIx_Data_pack(NULL, &chunk, &rev->type, 1, PMIX_INT32);
         if (PMIX_SUCCESS != rc) {
             PMIX_ERROR_LOG(rc);
-            close(fd);
+            PMIX_DATA_BUFFER_DESTRUCT(&chunk);
+            return;
+        }
+        /* tell the daemons how often to report progress */
+        rc = PMIx_Data_pack(NULL, &chunk, &rev->credit, 1, PMIX_INT32);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
             PMIX_DATA_BUFFER_DESTRUCT(&chunk);
             return;
         }
     }
+    rc = PMIx_Data_pack(NULL, &chunk, &bo, 1, PMIX_BYTE_OBJECT);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        PMIX_DATA_BUFFER_DESTRUCT(&chunk);
+        return;
+    }
 
-    /* goes to all daemons */
+    /* goes to all daemons - each chunk is relayed down the tree
+     * as it arrives, so the levels work on successive chunks
+     * in parallel while we read the next one
+     */
     sig = PRTE_NEW(prte_grpcomm_signature_t);
     sig->signature = (pmix_proc_t*)malloc(sizeof(pmix_proc_t));
     sig->sz = 1;
@@ -844,18 +1103,24 @@ static void send_chunk(int fd, short argc, void *cbdata)
     if (PRTE_SUCCESS != (rc = prte_grpcomm.xcast(sig, PRTE_RML_TAG_FILEM_BASE, &chunk))) {
         PRTE_ERROR_LOG(rc);
         PMIX_DATA_BUFFER_DESTRUCT(&chunk);
-        close(fd);
+        PRTE_RELEASE(sig);
         return;
     }
     PMIX_DATA_BUFFER_DESTRUCT(&chunk);
     PRTE_RELEASE(sig);
     rev->nchunk++;
+    rev->offset += numbytes;
 
     /* if num_bytes was zero, then we need to terminate the event
      * and close the file descriptor
      */
     if (0 == numbytes) {
+        if (NULL != rev->map) {
+            munmap(rev->map, rev->size);
+            rev->map = NULL;
+        }
         close(fd);
+        rev->fd = -1;
         return;
     } else {
         /* restart the read event */
@@ -865,13 +1130,14 @@ static void send_chunk(int fd, short argc, void *cbdata)
     }
 }
 
-static void send_complete(char *file, int status)
+static void send_ack(pmix_proc_t *dest, prte_rml_tag_t tag,
+                     int32_t id, int status, int32_t mark)
 {
     pmix_data_buffer_t *buf;
     int rc;
 
     PMIX_DATA_BUFFER_CREATE(buf);
-    rc = PMIx_Data_pack(NULL, buf, &file, 1, PMIX_STRING);
+    rc = PMIx_Data_pack(NULL, buf, &id, 1, PMIX_INT32);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
         PMIX_DATA_BUFFER_RELEASE(buf);
@@ -883,11 +1149,52 @@ static void send_complete(char *file, int status)
         PMIX_DATA_BUFFER_RELEASE(buf);
         return;
     }
-    if (0 > (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, buf,
-                                          PRTE_RML_TAG_FILEM_BASE_RESP,
+    rc = PMIx_Data_pack(NULL, buf, &mark, 1, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        PMIX_DATA_BUFFER_RELEASE(buf);
+        return;
+    }
+    if (0 > (rc = prte_rml.send_buffer_nb(dest, buf, tag,
                                           prte_rml_send_callback, NULL))) {
         PRTE_ERROR_LOG(rc);
-        PRTE_RELEASE(buf);
+        PMIX_DATA_BUFFER_RELEASE(buf);
+    }
+}
+
+static void send_complete(int32_t id, int status)
+{
+    send_ack(PRTE_PROC_MY_HNP, PRTE_RML_TAG_FILEM_BASE_RESP, id, status, -1);
+}
+
+/* report a failed incoming file exactly once. The entry stays on
+ * the list as a placeholder so the rest of its chunks are dropped
+ * without further reports, and is released with the last chunk */
+static void fail_incoming(prte_filem_raw_incoming_t *inbnd, int status, bool last)
+{
+    prte_list_item_t *item;
+    prte_filem_raw_output_t *output;
+
+    if (inbnd->pending) {
+        prte_event_del(&inbnd->ev);
+        inbnd->pending = false;
+    }
+    if (0 <= inbnd->fd) {
+        close(inbnd->fd);
+        inbnd->fd = -1;
+    }
+    while (NULL != (item = prte_list_remove_first(&inbnd->outputs))) {
+        output = (prte_filem_raw_output_t*)item;
+        if (0 == output->numbytes) {
+            last = true;
+        }
+        PRTE_RELEASE(output);
+    }
+    inbnd->status = status;
+    send_complete(inbnd->id, status);
+    if (last) {
+        prte_list_remove_item(&incoming_files, &inbnd->super);
+        PRTE_RELEASE(inbnd);
     }
 }
 
@@ -959,62 +1266,75 @@ static void recv_files(int status, pmix_proc_t* sender,
                        pmix_data_buffer_t* buffer, prte_rml_tag_t tag,
                        void* cbdata)
 {
-    char *file, *session_dir;
-    int32_t nchunk, n, nbytes;
-    unsigned char data[PRTE_FILEM_RAW_CHUNK_MAX];
+    char *file = NULL, *session_dir;
+    int32_t id, nchunk, n, credit = 0;
+    pmix_byte_object_t bo;
     int rc;
     prte_filem_raw_output_t *output;
     prte_filem_raw_incoming_t *ptr, *incoming;
     prte_list_item_t *item;
-    int32_t type;
+    int32_t type = PRTE_FILEM_TYPE_FILE;
     char *cptr;
 
     /* unpack the data */
     n=1;
-    rc = PMIx_Data_unpack(NULL, buffer, &file, &n, PMIX_STRING);
+    rc = PMIx_Data_unpack(NULL, buffer, &id, &n, PMIX_INT32);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
-        send_complete(NULL, rc);
+        send_complete(-1, rc);
         return;
     }
     n=1;
     rc = PMIx_Data_unpack(NULL, buffer, &nchunk, &n, PMIX_INT32);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
-        send_complete(file, rc);
-        free(file);
+        send_complete(id, rc);
         return;
     }
-    /* if the chunk number is < 0, then this is an EOF message */
-    if (nchunk < 0) {
-        /* just set nbytes to zero so we close the fd */
-        nbytes = 0;
-    } else {
-        nbytes=PRTE_FILEM_RAW_CHUNK_MAX;
-        rc = PMIx_Data_unpack(NULL, buffer, data, &nbytes, PMIX_BYTE);
+    /* if the chunk is 0, then additional info should be present */
+    if (0 == nchunk) {
+        n=1;
+        rc = PMIx_Data_unpack(NULL, buffer, &file, &n, PMIX_STRING);
         if (PMIX_SUCCESS != rc) {
             PMIX_ERROR_LOG(rc);
-            send_complete(file, rc);
-            free(file);
+            send_complete(id, rc);
             return;
         }
-    }
-    /* if the chunk is 0, then additional info should be present */
-    if (0 == nchunk) {
         n=1;
         rc = PMIx_Data_unpack(NULL, buffer, &type, &n, PMIX_INT32);
         if (PMIX_SUCCESS != rc) {
             PMIX_ERROR_LOG(rc);
-            send_complete(file, rc);
+            send_complete(id, rc);
+            free(file);
+            return;
+        }
+        n=1;
+        rc = PMIx_Data_unpack(NULL, buffer, &credit, &n, PMIX_INT32);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            send_complete(id, rc);
             free(file);
             return;
         }
     }
+    /* the data comes out in its own allocation, which we
+     * hand to the output object without copying it
+     */
+    n=1;
+    rc = PMIx_Data_unpack(NULL, buffer, &bo, &n, PMIX_BYTE_OBJECT);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        send_complete(id, rc);
+        if (NULL != file) {
+            free(file);
+        }
+        return;
+    }
 
     PRTE_OUTPUT_VERBOSE((1, prte_filem_base_framework.framework_output,
-                         "%s filem:raw: received chunk %d for file %s containing %d bytes",
+                         "%s filem:raw: received chunk %d for xfer %d containing %d bytes",
                          PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                         nchunk, file, nbytes));
+                         nchunk, id, (int)bo.size));
 
     /* do we already have this file on our list of incoming? */
     incoming = NULL;
@@ -1022,20 +1342,56 @@ static void recv_files(int status, pmix_proc_t* sender,
          item != prte_list_get_end(&incoming_files);
          item = prte_list_get_next(item)) {
         ptr = (prte_filem_raw_incoming_t*)item;
-        if (0 == strcmp(file, ptr->file)) {
+        if (id == ptr->id) {
             incoming = ptr;
             break;
         }
     }
     if (NULL == incoming) {
+        if (0 != nchunk) {
+            /* we missed the start of this file - nothing we can do
+             * but tell the HNP so it doesn't wait on us. Track the
+             * id as failed so we report it only once and quietly
+             * drop the rest of its chunks
+             */
+            PRTE_ERROR_LOG(PRTE_ERR_NOT_FOUND);
+            if (NULL != file) {
+                free(file);
+            }
+            incoming = PRTE_NEW(prte_filem_raw_incoming_t);
+            incoming->id = id;
+            prte_list_append(&incoming_files, &incoming->super);
+            fail_incoming(incoming, PRTE_ERR_NOT_FOUND, 0 == bo.size);
+            PMIX_BYTE_OBJECT_DESTRUCT(&bo);
+            return;
+        }
         /* nope - add it */
         PRTE_OUTPUT_VERBOSE((1, prte_filem_base_framework.framework_output,
                              "%s filem:raw: adding file %s to incoming list",
                              PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), file));
         incoming = PRTE_NEW(prte_filem_raw_incoming_t);
-        incoming->file = strdup(file);
+        incoming->id = id;
+        incoming->file = file;
         incoming->type = type;
+        incoming->credit = credit;
         prte_list_append(&incoming_files, &incoming->super);
+    } else if (PRTE_SUCCESS != incoming->status) {
+        /* we already failed this file and reported it - just
+         * drop the rest of it, and the placeholder once the
+         * last chunk arrives
+         */
+        if (0 == bo.size) {
+            prte_list_remove_item(&incoming_files, &incoming->super);
+            PRTE_RELEASE(incoming);
+        }
+        PMIX_BYTE_OBJECT_DESTRUCT(&bo);
+        return;
+    } else if (0 == nchunk) {
+        /* duplicate start of a file we are already receiving */
+        PRTE_ERROR_LOG(PRTE_ERR_BAD_PARAM);
+        PMIX_BYTE_OBJECT_DESTRUCT(&bo);
+        free(file);
+        return;
     }
 
     /* if this is the first chunk, we need to open the file descriptor */
@@ -1061,10 +1417,9 @@ static void recv_files(int status, pmix_proc_t* sender,
         tmp = prte_dirname(incoming->fullpath);
         if (PRTE_SUCCESS != (rc = prte_os_dirpath_create(tmp, S_IRWXU))) {
             PRTE_ERROR_LOG(rc);
-            send_complete(file, PRTE_ERR_FILE_WRITE_FAILURE);
-            free(file);
+            fail_incoming(incoming, PRTE_ERR_FILE_WRITE_FAILURE, 0 == bo.size);
             free(tmp);
-            PRTE_RELEASE(incoming);
+            PMIX_BYTE_OBJECT_DESTRUCT(&bo);
             return;
         }
         /* open the file descriptor for writing */
@@ -1073,9 +1428,9 @@ static void recv_files(int status, pmix_proc_t* sender,
                 prte_output(0, "%s CANNOT CREATE FILE %s",
                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                             incoming->fullpath);
-                send_complete(file, PRTE_ERR_FILE_WRITE_FAILURE);
-                free(file);
+                fail_incoming(incoming, PRTE_ERR_FILE_WRITE_FAILURE, 0 == bo.size);
                 free(tmp);
+                PMIX_BYTE_OBJECT_DESTRUCT(&bo);
                 return;
             }
         } else {
@@ -1083,9 +1438,9 @@ static void recv_files(int status, pmix_proc_t* sender,
                 prte_output(0, "%s CANNOT CREATE FILE %s",
                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                             incoming->fullpath);
-                send_complete(file, PRTE_ERR_FILE_WRITE_FAILURE);
-                free(file);
+                fail_incoming(incoming, PRTE_ERR_FILE_WRITE_FAILURE, 0 == bo.size);
                 free(tmp);
+                PMIX_BYTE_OBJECT_DESTRUCT(&bo);
                 return;
             }
         }
@@ -1094,16 +1449,17 @@ static void recv_files(int status, pmix_proc_t* sender,
                        PRTE_EV_WRITE, write_handler, incoming);
         prte_event_set_priority(&incoming->ev, PRTE_MSG_PRI);
     }
-    /* create an output object for this data */
+    /* create an output object for this data - zero bytes
+     * are passed along so the fd can be closed after
+     * it writes everything out
+     */
     output = PRTE_NEW(prte_filem_raw_output_t);
-    if (0 < nbytes) {
-        /* don't copy 0 bytes - we just need to pass
-         * the zero bytes so the fd can be closed
-         * after it writes everything out
-         */
-        memcpy(output->data, data, nbytes);
-    }
-    output->numbytes = nbytes;
+    output->nchunk = nchunk;
+    output->base = (unsigned char*)bo.bytes;
+    output->data = output->base;
+    output->numbytes = bo.size;
+    bo.bytes = NULL;
+    bo.size = 0;
 
     /* add this data to the write list for this fd */
     prte_list_append(&incoming->outputs, &output->super);
@@ -1114,9 +1470,6 @@ static void recv_files(int status, pmix_proc_t* sender,
         PRTE_POST_OBJECT(incoming);
         prte_event_add(&incoming->ev, 0);
     }
-
-    /* cleanup */
-    free(file);
 }
 
 
@@ -1125,7 +1478,8 @@ static void write_handler(int fd, short event, void *cbdata)
     prte_filem_raw_incoming_t *sink = (prte_filem_raw_incoming_t*)cbdata;
     prte_list_item_t *item;
     prte_filem_raw_output_t *output;
-    int num_written;
+    ssize_t num_written;
+    int32_t nchunk;
     char *dirname, *cmd;
     char homedir[MAXPATHLEN];
     int rc;
@@ -1157,7 +1511,7 @@ static void write_handler(int fd, short event, void *cbdata)
                  * name we will want in each proc's session dir
                  */
                 prte_argv_append_nosize(&sink->link_pts, sink->top);
-                send_complete(sink->file, PRTE_SUCCESS);
+                send_complete(sink->id, PRTE_SUCCESS);
             } else {
                 /* unarchive the file */
                 if (PRTE_FILEM_TYPE_TAR == sink->type) {
@@ -1168,18 +1522,18 @@ static void write_handler(int fd, short event, void *cbdata)
                     prte_asprintf(&cmd, "tar xzf %s", sink->file);
                 } else {
                     PRTE_ERROR_LOG(PRTE_ERR_BAD_PARAM);
-                    send_complete(sink->file, PRTE_ERR_FILE_WRITE_FAILURE);
+                    send_complete(sink->id, PRTE_ERR_FILE_WRITE_FAILURE);
                     return;
                 }
                 if (NULL == getcwd(homedir, sizeof(homedir))) {
                     PRTE_ERROR_LOG(PRTE_ERROR);
-                    send_complete(sink->file, PRTE_ERR_FILE_WRITE_FAILURE);
+                    send_complete(sink->id, PRTE_ERR_FILE_WRITE_FAILURE);
                     return;
                 }
                 dirname = prte_dirname(sink->fullpath);
                 if (0 != chdir(dirname)) {
                     PRTE_ERROR_LOG(PRTE_ERROR);
-                    send_complete(sink->file, PRTE_ERR_FILE_WRITE_FAILURE);
+                    send_complete(sink->id, PRTE_ERR_FILE_WRITE_FAILURE);
                     return;
                 }
                 PRTE_OUTPUT_VERBOSE((1, prte_filem_base_framework.framework_output,
@@ -1188,12 +1542,12 @@ static void write_handler(int fd, short event, void *cbdata)
                                      sink->file, cmd));
                 if (0 != system(cmd)) {
                     PRTE_ERROR_LOG(PRTE_ERROR);
-                    send_complete(sink->file, PRTE_ERR_FILE_WRITE_FAILURE);
+                    send_complete(sink->id, PRTE_ERR_FILE_WRITE_FAILURE);
                     return;
                 }
                 if (0 != chdir(homedir)) {
                     PRTE_ERROR_LOG(PRTE_ERROR);
-                    send_complete(sink->file, PRTE_ERR_FILE_WRITE_FAILURE);
+                    send_complete(sink->id, PRTE_ERR_FILE_WRITE_FAILURE);
                     return;
                 }
                 free(dirname);
@@ -1201,9 +1555,9 @@ static void write_handler(int fd, short event, void *cbdata)
                 /* setup the link points */
                 if (PRTE_SUCCESS != (rc = link_archive(sink))) {
                     PRTE_ERROR_LOG(rc);
-                    send_complete(sink->file, PRTE_ERR_FILE_WRITE_FAILURE);
+                    send_complete(sink->id, PRTE_ERR_FILE_WRITE_FAILURE);
                 } else {
-                    send_complete(sink->file, PRTE_SUCCESS);
+                    send_complete(sink->id, PRTE_SUCCESS);
                 }
             }
             return;
@@ -1212,7 +1566,7 @@ static void write_handler(int fd, short event, void *cbdata)
         PRTE_OUTPUT_VERBOSE((1, prte_filem_base_framework.framework_output,
                              "%s write:handler wrote %d bytes to file %s",
                              PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                             num_written, sink->file));
+                             (int)num_written, sink->file));
         if (num_written < 0) {
             if (EAGAIN == errno || EINTR == errno) {
                 /* push this item back on the front of the list */
@@ -1233,13 +1587,12 @@ static void write_handler(int fd, short event, void *cbdata)
                                  PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                                  sink->file, strerror(errno)));
             PRTE_RELEASE(output);
-            prte_list_remove_item(&incoming_files, &sink->super);
-            send_complete(sink->file, PRTE_ERR_FILE_WRITE_FAILURE);
-            PRTE_RELEASE(sink);
+            fail_incoming(sink, PRTE_ERR_FILE_WRITE_FAILURE, false);
             return;
-        } else if (num_written < output->numbytes) {
+        } else if ((size_t)num_written < output->numbytes) {
             /* incomplete write - adjust data to avoid duplicate output */
-            memmove(output->data, &output->data[num_written], output->numbytes - num_written);
+            output->data += num_written;
+            output->numbytes -= num_written;
             /* push this item back on the front of the list */
             prte_list_prepend(&sink->outputs, item);
             /* leave the write event running so it will call us again
@@ -1250,7 +1603,12 @@ static void write_handler(int fd, short event, void *cbdata)
             prte_event_add(&sink->ev, 0);
             return;
         }
+        nchunk = output->nchunk;
         PRTE_RELEASE(output);
+        /* let the HNP know if we have reached a credit point */
+        if (0 < sink->credit && 0 == ((nchunk + 1) % sink->credit)) {
+            report_progress(sink->id, nchunk / sink->credit);
+        }
     }
 }
 
@@ -1259,11 +1617,20 @@ static void xfer_construct(prte_filem_raw_xfer_t *ptr)
     ptr->outbound = NULL;
     ptr->app_idx = 0;
     ptr->pending = false;
+    ptr->fd = -1;
+    ptr->id = 0;
     ptr->src = NULL;
     ptr->file = NULL;
     ptr->nchunk = 0;
     ptr->status = PRTE_SUCCESS;
     ptr->nrecvd = 0;
+    ptr->map = NULL;
+    ptr->size = 0;
+    ptr->offset = 0;
+    ptr->buf = NULL;
+    ptr->stalled = false;
+    ptr->credit = 0;
+    ptr->acked = 0;
 }
 static void xfer_destruct(prte_filem_raw_xfer_t *ptr)
 {
@@ -1276,6 +1643,15 @@ static void xfer_destruct(prte_filem_raw_xfer_t *ptr)
     if (NULL != ptr->file) {
         free(ptr->file);
     }
+    if (NULL != ptr->map) {
+        munmap(ptr->map, ptr->size);
+    }
+    if (0 <= ptr->fd) {
+        close(ptr->fd);
+    }
+    if (NULL != ptr->buf) {
+        free(ptr->buf);
+    }
 }
 PRTE_CLASS_INSTANCE(prte_filem_raw_xfer_t,
                    prte_list_item_t,
@@ -1306,6 +1682,9 @@ static void in_construct(prte_filem_raw_incoming_t *ptr)
     ptr->app_idx = 0;
     ptr->pending = false;
     ptr->fd = -1;
+    ptr->id = 0;
+    ptr->credit = 0;
+    ptr->status = PRTE_SUCCESS;
     ptr->file = NULL;
     ptr->top = NULL;
     ptr->fullpath = NULL;
@@ -1341,10 +1720,36 @@ PRTE_CLASS_INSTANCE(prte_filem_raw_incoming_t,
                    prte_list_item_t,
                    in_construct, in_destruct);
 
+static void credit_construct(prte_filem_raw_credit_t *ptr)
+{
+    ptr->id = 0;
+    ptr->mark = 0;
+    ptr->nslots = 0;
+    ptr->counts = NULL;
+}
+static void credit_destruct(prte_filem_raw_credit_t *ptr)
+{
+    if (NULL != ptr->counts) {
+        free(ptr->counts);
+    }
+}
+PRTE_CLASS_INSTANCE(prte_filem_raw_credit_t,
+                   prte_list_item_t,
+                   credit_construct, credit_destruct);
+
 static void output_construct(prte_filem_raw_output_t *ptr)
 {
+    ptr->nchunk = 0;
     ptr->numbytes = 0;
+    ptr->data = NULL;
+    ptr->base = NULL;
+}
+static void output_destruct(prte_filem_raw_output_t *ptr)
+{
+    if (NULL != ptr->base) {
+        free(ptr->base);
+    }
 }
 PRTE_CLASS_INSTANCE(prte_filem_raw_output_t,
                    prte_list_item_t,
-                   output_construct, NULL);
+                   output_construct, output_destruct);
@@ -73,6 +73,8 @@ typedef struct {
     prte_list_t actives;
     prte_list_t ongoing;
     prte_hash_table_t sig_table;
+    /* ongoing collectives, indexed by signature */
+    prte_hash_table_t coll_table;
     char *transports;
     size_t context_id;
 } prte_grpcomm_base_t;
@@ -95,6 +97,7 @@ PRTE_EXPORT int prte_grpcomm_API_rbcast(prte_grpcomm_signature_t *sig,
 PRTE_EXPORT int prte_grpcomm_API_register_cb(prte_grpcomm_rbcast_cb_t callback);
 
 PRTE_EXPORT prte_grpcomm_coll_t* prte_grpcomm_base_get_tracker(prte_grpcomm_signature_t *sig, bool create);
+PRTE_EXPORT void prte_grpcomm_base_remove_tracker(prte_grpcomm_coll_t *coll);
 PRTE_EXPORT void prte_grpcomm_base_mark_distance_recv(prte_grpcomm_coll_t *coll, uint32_t distance);
 PRTE_EXPORT unsigned int prte_grpcomm_base_check_distance_recv(prte_grpcomm_coll_t *coll, uint32_t distance);
 
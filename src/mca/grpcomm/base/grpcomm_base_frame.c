@@ -88,6 +88,7 @@ static int prte_grpcomm_base_close(void)
         }
     }
     PRTE_LIST_DESTRUCT(&prte_grpcomm_base.actives);
+    PRTE_DESTRUCT(&prte_grpcomm_base.coll_table);
     PRTE_LIST_DESTRUCT(&prte_grpcomm_base.ongoing);
     for (void *_nptr=NULL;                                   \
          PRTE_SUCCESS == prte_hash_table_get_next_key_ptr(&prte_grpcomm_base.sig_table, &key, &size, (void **)&seq_number, _nptr, &_nptr);) {
@@ -108,6 +109,8 @@ static int prte_grpcomm_base_open(prte_mca_base_open_flag_t flags)
     PRTE_CONSTRUCT(&prte_grpcomm_base.ongoing, prte_list_t);
     PRTE_CONSTRUCT(&prte_grpcomm_base.sig_table, prte_hash_table_t);
     prte_hash_table_init(&prte_grpcomm_base.sig_table, 128);
+    PRTE_CONSTRUCT(&prte_grpcomm_base.coll_table, prte_hash_table_t);
+    prte_hash_table_init(&prte_grpcomm_base.coll_table, 128);
 
     return prte_mca_base_framework_components_open(&prte_grpcomm_base_framework, flags);
 }
@@ -53,7 +53,13 @@ static int pack_xcast(prte_grpcomm_signature_t *sig,
                       prte_rml_tag_t tag);
 
 static int create_dmns(prte_grpcomm_signature_t *sig,
-                       pmix_rank_t **dmns, size_t *ndmns);
+                       pmix_rank_t **dmns, size_t *ndmns,
+                       prte_bitmap_t *members);
+
+/* trackers are indexed by the raw bytes of their signature - a
+ * NULL signature (i.e., all procs) is a zero-length key */
+#define PRTE_GRPCOMM_SIG_KEYSIZE(s) \
+    ((NULL == (s)->signature) ? 0 : (s)->sz * sizeof(pmix_proc_t))
 
 typedef struct {
     prte_object_t super;
@@ -102,7 +108,7 @@ int prte_grpcomm_API_xcast(prte_grpcomm_signature_t *sig,
     PMIX_DATA_BUFFER_CREATE(buf);
 
     /* create the array of participating daemons */
-    if (PRTE_SUCCESS != (rc = create_dmns(sig, &dmns, &ndmns))) {
+    if (PRTE_SUCCESS != (rc = create_dmns(sig, &dmns, &ndmns, NULL))) {
         PRTE_ERROR_LOG(rc);
         PMIX_DATA_BUFFER_RELEASE(buf);
         return rc;
@@ -155,7 +161,7 @@ int prte_grpcomm_API_rbcast(prte_grpcomm_signature_t *sig,
     /* setup the payload */
     if (PRTE_SUCCESS != (rc = pack_xcast(sig, buf, msg, tag))) {
         PRTE_ERROR_LOG(rc);
-        PRTE_RELEASE(buf);
+        PMIX_DATA_BUFFER_RELEASE(buf);
         return rc;
     }
     /* cycle thru the actives and see who can send it */
@@ -166,6 +172,7 @@ int prte_grpcomm_API_rbcast(prte_grpcomm_signature_t *sig,
             }
         }
     }
+    PMIX_DATA_BUFFER_RELEASE(buf);  // the module copies what it needs to send
 
     return rc;
 }
@@ -284,30 +291,21 @@ int prte_grpcomm_API_allgather(prte_grpcomm_signature_t *sig,
 
 prte_grpcomm_coll_t* prte_grpcomm_base_get_tracker(prte_grpcomm_signature_t *sig, bool create)
 {
-    prte_grpcomm_coll_t *coll;
+    prte_grpcomm_coll_t *coll = NULL;
     int rc;
     prte_namelist_t *nm;
     prte_list_t children;
-    size_t n;
+    prte_bitmap_t members;
+    bool all;
 
-    /* search the existing tracker list to see if this already exists */
-    PRTE_LIST_FOREACH(coll, &prte_grpcomm_base.ongoing, prte_grpcomm_coll_t) {
-        if (NULL == sig->signature) {
-            if (NULL == coll->sig->signature) {
-                /* only one collective can operate at a time
-                 * across every process in the system */
-                return coll;
-            }
-            /* if only one is NULL, then we can't possibly match */
-            break;
-        }
-        if (sig->sz == coll->sig->sz &&
-            0 == memcmp(sig->signature, coll->sig->signature, sig->sz * sizeof(pmix_proc_t))) {
-            PRTE_OUTPUT_VERBOSE((1, prte_grpcomm_base_framework.framework_output,
-                                 "%s grpcomm:base:returning existing collective",
-                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME)));
-            return coll;
-        }
+    /* see if this collective already exists */
+    rc = prte_hash_table_get_value_ptr(&prte_grpcomm_base.coll_table, sig->signature,
+                                       PRTE_GRPCOMM_SIG_KEYSIZE(sig), (void**)&coll);
+    if (PRTE_SUCCESS == rc && NULL != coll) {
+        PRTE_OUTPUT_VERBOSE((1, prte_grpcomm_base_framework.framework_output,
+                             "%s grpcomm:base:returning existing collective",
+                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME)));
+        return coll;
     }
     /* if we get here, then this is a new collective - so create
      * the tracker for it */
@@ -321,28 +319,30 @@ prte_grpcomm_coll_t* prte_grpcomm_base_get_tracker(prte_grpcomm_signature_t *sig
     coll = PRTE_NEW(prte_grpcomm_coll_t);
     coll->sig = PRTE_NEW(prte_grpcomm_signature_t);
     coll->sig->sz = sig->sz;
-    coll->sig->signature = (pmix_proc_t*)malloc(coll->sig->sz * sizeof(pmix_proc_t));
-    memcpy(coll->sig->signature, sig->signature, coll->sig->sz * sizeof(pmix_proc_t));
-
-    prte_list_append(&prte_grpcomm_base.ongoing, &coll->super);
+    if (NULL != sig->signature) {
+        coll->sig->signature = (pmix_proc_t*)malloc(coll->sig->sz * sizeof(pmix_proc_t));
+        memcpy(coll->sig->signature, sig->signature, coll->sig->sz * sizeof(pmix_proc_t));
+    }
 
     /* now get the daemons involved */
-    if (PRTE_SUCCESS != (rc = create_dmns(sig, &coll->dmns, &coll->ndmns))) {
+    PRTE_CONSTRUCT(&members, prte_bitmap_t);
+    if (PRTE_SUCCESS != (rc = create_dmns(sig, &coll->dmns, &coll->ndmns, &members))) {
         PRTE_ERROR_LOG(rc);
+        PRTE_DESTRUCT(&members);
+        PRTE_RELEASE(coll);
         return NULL;
     }
 
-    /* cycle thru the array of daemons and compare them to our
-     * children in the routing tree, counting the ones that match
-     * so we know how many daemons we should receive contributions from */
+    /* count the children in the routing tree that are participating
+     * so we know how many daemons we should receive contributions from.
+     * A NULL array with a non-zero count means that every daemon is
+     * participating */
+    all = (NULL == coll->dmns && 0 < coll->ndmns);
     PRTE_CONSTRUCT(&children, prte_list_t);
     prte_routed.get_routing_list(&children);
     while (NULL != (nm = (prte_namelist_t*)prte_list_remove_first(&children))) {
-        for (n=0; n < coll->ndmns; n++) {
-            if (nm->name.rank == coll->dmns[n]) {
-                coll->nexpected++;
-                break;
-            }
+        if (all || prte_bitmap_is_set_bit(&members, nm->name.rank)) {
+            coll->nexpected++;
         }
         PRTE_RELEASE(nm);
     }
@@ -351,29 +351,52 @@ prte_grpcomm_coll_t* prte_grpcomm_base_get_tracker(prte_grpcomm_signature_t *sig
     /* see if I am in the array of participants - note that I may
      * be in the rollup tree even though I'm not participating
      * in the collective itself */
-    for (n=0; n < coll->ndmns; n++) {
-        if (coll->dmns[n] == PRTE_PROC_MY_NAME->rank) {
-            coll->nexpected++;
-            break;
-        }
+    if (all || prte_bitmap_is_set_bit(&members, PRTE_PROC_MY_NAME->rank)) {
+        coll->nexpected++;
+    }
+    PRTE_DESTRUCT(&members);
+
+    prte_list_append(&prte_grpcomm_base.ongoing, &coll->super);
+    rc = prte_hash_table_set_value_ptr(&prte_grpcomm_base.coll_table, coll->sig->signature,
+                                       PRTE_GRPCOMM_SIG_KEYSIZE(coll->sig), coll);
+    if (PRTE_SUCCESS != rc) {
+        PRTE_ERROR_LOG(rc);
     }
 
     return coll;
 }
 
+void prte_grpcomm_base_remove_tracker(prte_grpcomm_coll_t *coll)
+{
+    prte_grpcomm_coll_t *cptr = NULL;
+    int rc;
+
+    /* only drop the index entry if it still points at this tracker */
+    rc = prte_hash_table_get_value_ptr(&prte_grpcomm_base.coll_table, coll->sig->signature,
+                                       PRTE_GRPCOMM_SIG_KEYSIZE(coll->sig), (void**)&cptr);
+    if (PRTE_SUCCESS == rc && cptr == coll) {
+        prte_hash_table_remove_value_ptr(&prte_grpcomm_base.coll_table, coll->sig->signature,
+                                         PRTE_GRPCOMM_SIG_KEYSIZE(coll->sig));
+    }
+    prte_list_remove_item(&prte_grpcomm_base.ongoing, &coll->super);
+}
+
+/* compute the array of daemons hosting the procs in the signature. The
+ * optional members bitmap is left with a bit set for each participating
+ * daemon so the caller can test membership in constant time */
 static int create_dmns(prte_grpcomm_signature_t *sig,
-                       pmix_rank_t **dmns, size_t *ndmns)
+                       pmix_rank_t **dmns, size_t *ndmns,
+                       prte_bitmap_t *members)
 {
     size_t n;
     prte_job_t *jdata;
     prte_proc_t *proc;
     prte_node_t *node;
     int i;
-    prte_list_t ds;
-    prte_namelist_t *nm;
+    prte_bitmap_t local;
+    prte_bitmap_t *ds;
     pmix_rank_t vpid;
-    bool found;
-    size_t nds=0;
+    size_t nds=0, size=0;
     pmix_rank_t *dns=NULL;
     int rc = PRTE_SUCCESS;
 
@@ -391,7 +414,17 @@ static int create_dmns(prte_grpcomm_signature_t *sig,
         return PRTE_SUCCESS;
     }
 
-    PRTE_CONSTRUCT(&ds, prte_list_t);
+    /* track the daemons we have already added in a bitmap
+     * indexed by daemon vpid so that checking for duplicates
+     * doesn't require a search */
+    if (NULL == members) {
+        PRTE_CONSTRUCT(&local, prte_bitmap_t);
+        ds = &local;
+    } else {
+        ds = members;
+    }
+    prte_bitmap_init(ds, prte_process_info.num_daemons);
+
     for (n=0; n < sig->sz; n++) {
         if (NULL == (jdata = prte_get_job_data_object(sig->signature[n].nspace))) {
             PRTE_ERROR_LOG(PRTE_ERR_NOT_FOUND);
@@ -425,22 +458,20 @@ static int create_dmns(prte_grpcomm_signature_t *sig,
                     rc = PRTE_ERR_NOT_FOUND;
                     goto done;
                 }
-                found = false;
-                PRTE_LIST_FOREACH(nm, &ds, prte_namelist_t) {
-                    if (nm->name.rank == node->daemon->name.rank) {
-                        found = true;
-                        break;
-                    }
+                vpid = node->daemon->name.rank;
+                if (prte_bitmap_is_set_bit(ds, vpid)) {
+                    continue;
                 }
-                if (!found) {
-                    PRTE_OUTPUT_VERBOSE((5, prte_grpcomm_base_framework.framework_output,
-                                         "%s grpcomm:base:create_dmns adding daemon %s to list",
-                                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                         PRTE_NAME_PRINT(&node->daemon->name)));
-                    nm = PRTE_NEW(prte_namelist_t);
-                    PMIX_LOAD_PROCID(&nm->name, PRTE_PROC_MY_NAME->nspace, node->daemon->name.rank);
-                    prte_list_append(&ds, &nm->super);
+                PRTE_OUTPUT_VERBOSE((5, prte_grpcomm_base_framework.framework_output,
+                                     "%s grpcomm:base:create_dmns adding daemon %s to list",
+                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                                     PRTE_NAME_PRINT(&node->daemon->name)));
+                prte_bitmap_set_bit(ds, vpid);
+                if (nds == size) {
+                    size = (0 == size) ? 16 : 2 * size;
+                    dns = (pmix_rank_t*)realloc(dns, size * sizeof(pmix_rank_t));
                 }
+                dns[nds++] = vpid;
             }
         } else {
             /* lookup the daemon for this proc and add it to the list */
@@ -459,35 +490,26 @@ static int create_dmns(prte_grpcomm_signature_t *sig,
                 goto done;
             }
             vpid = proc->node->daemon->name.rank;
-            found = false;
-            PRTE_LIST_FOREACH(nm, &ds, prte_namelist_t) {
-                if (nm->name.rank == vpid) {
-                    found = true;
-                    break;
-                }
+            if (prte_bitmap_is_set_bit(ds, vpid)) {
+                continue;
             }
-            if (!found) {
-                nm = PRTE_NEW(prte_namelist_t);
-                PMIX_LOAD_PROCID(&nm->name, PRTE_PROC_MY_NAME->nspace, vpid);
-                prte_list_append(&ds, &nm->super);
+            prte_bitmap_set_bit(ds, vpid);
+            if (nds == size) {
+                size = (0 == size) ? 16 : 2 * size;
+                dns = (pmix_rank_t*)realloc(dns, size * sizeof(pmix_rank_t));
             }
+            dns[nds++] = vpid;
         }
     }
 
   done:
-    if (0 < prte_list_get_size(&ds)) {
-        dns = (pmix_rank_t*)malloc(prte_list_get_size(&ds) * sizeof(pmix_rank_t));
-        nds = 0;
-        while (NULL != (nm = (prte_namelist_t*)prte_list_remove_first(&ds))) {
-            PRTE_OUTPUT_VERBOSE((5, prte_grpcomm_base_framework.framework_output,
-                                 "%s grpcomm:base:create_dmns adding daemon %s to array",
-                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                 PRTE_NAME_PRINT(&nm->name)));
-            dns[nds++] = nm->name.rank;
-            PRTE_RELEASE(nm);
-        }
+    if (ds == &local) {
+        PRTE_DESTRUCT(&local);
+    }
+    if (0 == nds && NULL != dns) {
+        free(dns);
+        dns = NULL;
     }
-    PRTE_LIST_DESTRUCT(&ds);
     *dmns = dns;
     *ndmns = nds;
     return rc;
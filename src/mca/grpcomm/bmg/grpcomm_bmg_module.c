@@ -58,8 +58,23 @@ prte_grpcomm_base_module_t prte_grpcomm_bmg_module = {
 static void rbcast_recv(int status, pmix_proc_t* sender,
                        pmix_data_buffer_t* buffer, prte_rml_tag_t tag,
                        void* cbdata);
+
+/* each broadcast carries its origin and a sequence number assigned
+ * by the origin. The receiver tracks the most recent sequence
+ * numbers seen from each origin in a sliding window, with one bit
+ * per sequence number, so duplicates arriving over the redundant
+ * paths are dropped without being unpacked any further. Messages
+ * that fall behind the window are treated as duplicates */
+#define RBCAST_WINDOW 64
+typedef struct {
+    uint32_t base;      // first sequence number in the window
+    uint64_t seen;      // bit i is set if base+i has been seen
+} rbcast_window_t;
+
 /* internal variables */
-static prte_list_t tracker;
+static uint32_t my_seq = 0;
+static rbcast_window_t *windows = NULL;
+static pmix_rank_t nwindows = 0;
 
 /*
  * registration of callbacks
@@ -92,7 +107,9 @@ static int unregister_cb_type(int type) {
  */
 static int bmg_init(void)
 {
-    PRTE_CONSTRUCT(&tracker, prte_list_t);
+    my_seq = 0;
+    windows = NULL;
+    nwindows = 0;
 
     prte_rml.recv_buffer_nb(PRTE_NAME_WILDCARD,
                             PRTE_RML_TAG_RBCAST,
@@ -108,13 +125,65 @@ static void bmg_finalize(void)
 {
     /* cancel the rbcast recv */
     prte_rml.recv_cancel(PRTE_NAME_WILDCARD, PRTE_RML_TAG_RBCAST);
-    PRTE_LIST_DESTRUCT(&tracker);
+    if (NULL != windows) {
+        free(windows);
+        windows = NULL;
+    }
+    nwindows = 0;
     return;
 }
 
-static int rbcast(pmix_data_buffer_t *buf)
+/* record the given message as seen - returns false if
+ * it was already seen */
+static bool check_seen(pmix_rank_t origin, uint32_t seq)
+{
+    rbcast_window_t *w;
+    uint32_t shift;
+    pmix_rank_t n;
+
+    if (origin >= nwindows) {
+        /* the DVM can grow, so size to the current daemon count */
+        n = prte_process_info.num_daemons;
+        if (n <= origin) {
+            n = origin + 1;
+        }
+        w = (rbcast_window_t*)realloc(windows, n * sizeof(rbcast_window_t));
+        if (NULL == w) {
+            PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+            /* better to pass a duplicate than lose a message */
+            return true;
+        }
+        memset(&w[nwindows], 0, (n - nwindows) * sizeof(rbcast_window_t));
+        windows = w;
+        nwindows = n;
+    }
+    w = &windows[origin];
+
+    if (seq < w->base) {
+        return false;
+    }
+    if (seq >= w->base + RBCAST_WINDOW) {
+        /* slide the window so this is its last entry */
+        shift = seq - (w->base + RBCAST_WINDOW) + 1;
+        if (RBCAST_WINDOW <= shift) {
+            w->seen = 0;
+        } else {
+            w->seen >>= shift;
+        }
+        w->base += shift;
+    }
+    if (w->seen & ((uint64_t)1 << (seq - w->base))) {
+        return false;
+    }
+    w->seen |= (uint64_t)1 << (seq - w->base);
+    return true;
+}
+
+/* send the message to our peers in the broadcast graph - every
+ * send shares the same payload */
+static int send_to_peers(prte_rml_payload_t *msg)
 {
-    int rc = false;
+    int rc = PRTE_SUCCESS;
 
     /* number of "daemons" equal 1hnp + num of daemons, so here pass ndmns -1 */
     int nprocs = prte_process_info.num_daemons;// -1;
@@ -142,16 +211,19 @@ static int rbcast(pmix_data_buffer_t *buf)
             /*if (idx ==0 ){
                 idx = nprocs;
             }*/
+            if (idx == vpid) {
+                /* we already have it */
+                continue;
+            }
             PMIX_LOAD_PROCID(&daemon, prte_process_info.myproc.nspace, idx);
-            PRTE_RETAIN(buf);
 
             PRTE_OUTPUT_VERBOSE((1, prte_grpcomm_base_framework.framework_output,
                                  "%s grpcomm:bmg: broadcast message in %d daemons to %s",
                                  PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), nprocs,
                                  PRTE_NAME_PRINT(&daemon)));
-            if (0 > (rc = prte_rml.send_buffer_nb(&daemon, buf,
-                                                  PRTE_RML_TAG_RBCAST,
-                                                  prte_rml_send_callback, NULL))) {
+            if (PRTE_SUCCESS != (rc = prte_rml.send_payload_nb(&daemon, msg,
+                                                               PRTE_RML_TAG_RBCAST,
+                                                               prte_rml_send_callback, NULL))) {
                 PRTE_ERROR_LOG(rc);
             }
         }
@@ -160,57 +232,131 @@ static int rbcast(pmix_data_buffer_t *buf)
     return rc;
 }
 
+static int rbcast(pmix_data_buffer_t *buf)
+{
+    int rc;
+    prte_rml_payload_t *msg;
+    uint32_t seq;
+
+    /* stamp the message with our name and the next sequence
+     * number - mark it as seen so we don't forward it again
+     * when our peers pass it back to us */
+    seq = ++my_seq;
+    check_seen(PRTE_PROC_MY_NAME->rank, seq);
+
+    msg = PRTE_NEW(prte_rml_payload_t);
+    rc = PMIx_Data_pack(NULL, &msg->data, &PRTE_PROC_MY_NAME->rank, 1, PMIX_PROC_RANK);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        PRTE_RELEASE(msg);
+        return prte_pmix_convert_status(rc);
+    }
+    rc = PMIx_Data_pack(NULL, &msg->data, &seq, 1, PMIX_UINT32);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        PRTE_RELEASE(msg);
+        return prte_pmix_convert_status(rc);
+    }
+    rc = PMIx_Data_copy_payload(&msg->data, buf);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        PRTE_RELEASE(msg);
+        return prte_pmix_convert_status(rc);
+    }
+
+    rc = send_to_peers(msg);
+    PRTE_RELEASE(msg);  // the sends hold their own references
+    return rc;
+}
+
 static void rbcast_recv(int status, pmix_proc_t* sender,
                        pmix_data_buffer_t* buffer, prte_rml_tag_t tg,
                        void* cbdata)
 {
     int ret, cnt;
-    pmix_data_buffer_t datbuf,*relay, *rly, *data;
+    pmix_data_buffer_t datbuf, *relay, *data;
+    prte_rml_payload_t *rly;
     prte_grpcomm_signature_t sig;
     prte_rml_tag_t tag;
     int cbtype;
-    size_t inlen, cmplen;
-    uint8_t *packed_data, *cmpdata;
-    int8_t flag;
+    pmix_rank_t origin;
+    uint32_t seq;
+    bool compressed;
     pmix_byte_object_t bo, pbo;
 
     PRTE_OUTPUT_VERBOSE((1, prte_grpcomm_base_framework.framework_output,
                          "%s grpcomm:bmg:rbcast:recv: with %d bytes",
                          PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                          (int)buffer->bytes_used));
-    /* we need a passthru buffer to forward and to the callback */
-    PMIX_DATA_BUFFER_CREATE(rly);
-    PMIX_DATA_BUFFER_CREATE(relay);
-    ret = PMIx_Data_copy_payload(rly, buffer);
+
+    /* we need a passthru payload to forward - we leave it as
+     * it arrived, compressed or not. Since nothing has been
+     * unpacked yet, we can take the incoming data over without
+     * copying it, and the payload is then shared by all the
+     * forwarding sends */
+    rly = PRTE_NEW(prte_rml_payload_t);
+    ret = PMIx_Data_unload(buffer, &bo);
+    if (PMIX_SUCCESS != ret) {
+        PMIX_ERROR_LOG(ret);
+        PRTE_RELEASE(rly);
+        return;
+    }
+    ret = PMIx_Data_load(&rly->data, &bo);
     if (PMIX_SUCCESS != ret) {
-        PMIX_DATA_BUFFER_RELEASE(rly);
-        PMIX_DATA_BUFFER_RELEASE(relay);
+        PMIX_ERROR_LOG(ret);
+        PMIX_BYTE_OBJECT_DESTRUCT(&bo);
+        PRTE_RELEASE(rly);
+        return;
+    }
+
+    /* see if we have already seen this message - the forwarding
+     * sends always transmit the entire payload, so unpacking from
+     * it here does not affect them */
+    cnt = 1;
+    ret = PMIx_Data_unpack(NULL, &rly->data, &origin, &cnt, PMIX_PROC_RANK);
+    if (PMIX_SUCCESS != ret) {
+        PMIX_ERROR_LOG(ret);
+        PRTE_RELEASE(rly);
+        return;
+    }
+    cnt = 1;
+    ret = PMIx_Data_unpack(NULL, &rly->data, &seq, &cnt, PMIX_UINT32);
+    if (PMIX_SUCCESS != ret) {
+        PMIX_ERROR_LOG(ret);
+        PRTE_RELEASE(rly);
+        return;
+    }
+    if (!check_seen(origin, seq)) {
+        PRTE_OUTPUT_VERBOSE((5, prte_grpcomm_base_framework.framework_output,
+                             "%s grpcomm:bmg:rbcast:recv: dropping duplicate %u from %u",
+                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), seq, origin));
+        PRTE_RELEASE(rly);
         return;
     }
 
     PMIX_DATA_BUFFER_CONSTRUCT(&datbuf);
     /* unpack the flag to see if this payload is compressed */
     cnt=1;
-    ret = PMIx_Data_unpack(NULL, buffer, &flag, &cnt, PMIX_INT8);
+    ret = PMIx_Data_unpack(NULL, &rly->data, &compressed, &cnt, PMIX_BOOL);
     if (PMIX_SUCCESS != ret) {
         PMIX_ERROR_LOG(ret);
-        PMIX_DATA_BUFFER_RELEASE(rly);
-        PMIX_DATA_BUFFER_RELEASE(relay);
+        PRTE_RELEASE(rly);
         PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
         PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
         return;
      }
     /* unpack the data blob */
     cnt = 1;
-    ret = PMIx_Data_unpack(NULL, buffer, &pbo, &cnt, PMIX_BYTE_OBJECT);
+    ret = PMIx_Data_unpack(NULL, &rly->data, &pbo, &cnt, PMIX_BYTE_OBJECT);
     if (PMIX_SUCCESS != ret) {
         PMIX_ERROR_LOG(ret);
         PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
-        PMIX_DATA_BUFFER_RELEASE(rly);
+        PRTE_RELEASE(rly);
         return;
     }
-    if (flag) {
-        /* decompress the data */
+    if (compressed) {
+        /* decompress the data - this is solely for our own
+         * use, the forwarded payload stays compressed */
         if (PMIx_Data_decompress((uint8_t**)&bo.bytes, &bo.size,
                                  (uint8_t*)pbo.bytes, pbo.size)) {
             /* the data has been uncompressed */
@@ -219,7 +365,7 @@ static void rbcast_recv(int status, pmix_proc_t* sender,
                 PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
                 PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
                 PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
-                PMIX_DATA_BUFFER_RELEASE(rly);
+                PRTE_RELEASE(rly);
                 return;
             }
         } else {
@@ -227,28 +373,29 @@ static void rbcast_recv(int status, pmix_proc_t* sender,
             PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
             PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
             PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
-            PMIX_DATA_BUFFER_RELEASE(rly);
+            PRTE_RELEASE(rly);
             return;
         }
+        PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
     } else {
+        /* the blob is ours - hand it over without copying */
         ret = PMIx_Data_load(&datbuf, &pbo);
         if (PMIX_SUCCESS != ret) {
             PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
             PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
             PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
-            PMIX_DATA_BUFFER_RELEASE(rly);
+            PRTE_RELEASE(rly);
             return;
         }
     }
-    PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
     data = &datbuf;
+    PMIX_DATA_BUFFER_CREATE(relay);
 
     /* get the signature that we need to create the dmns*/
     cnt=1;
     ret = PMIx_Data_unpack(NULL, data, &sig.sz, &cnt, PMIX_SIZE);
     if (PMIX_SUCCESS != ret) {
         PMIX_ERROR_LOG(ret);
-        PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
         PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
         goto CLEANUP;
     }
@@ -257,7 +404,6 @@ static void rbcast_recv(int status, pmix_proc_t* sender,
     ret = PMIx_Data_unpack(NULL, data, sig.signature, &cnt, PMIX_PROC);
     if (PMIX_SUCCESS != ret) {
         PMIX_ERROR_LOG(ret);
-        PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
         PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
         PMIX_PROC_FREE(sig.signature, sig.sz);
         goto CLEANUP;
@@ -267,10 +413,9 @@ static void rbcast_recv(int status, pmix_proc_t* sender,
 
     /* get the target tag */
     cnt=1;
-    ret = PMIx_Data_unpack(NULL, data, &tag, &cnt, PMIX_UINT32);
+    ret = PMIx_Data_unpack(NULL, data, &tag, &cnt, PRTE_RML_TAG);
     if (PMIX_SUCCESS != ret) {
         PMIX_ERROR_LOG(ret);
-        PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
         PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
         goto CLEANUP;
     }
@@ -279,7 +424,6 @@ static void rbcast_recv(int status, pmix_proc_t* sender,
     ret = PMIx_Data_copy_payload(relay, data);
     if (PMIX_SUCCESS != ret) {
         PMIX_ERROR_LOG(ret);
-        PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
         PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
         goto CLEANUP;
     }
@@ -289,18 +433,22 @@ static void rbcast_recv(int status, pmix_proc_t* sender,
     ret = PMIx_Data_unpack(NULL, data, &cbtype, &cnt, PMIX_INT32);
     if (PMIX_SUCCESS != ret) {
         PMIX_ERROR_LOG(ret);
-        PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
         PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
         goto CLEANUP;
     }
+    if (0 > cbtype || RBCAST_CB_TYPE_MAX < cbtype ||
+        NULL == prte_grpcomm_rbcast_cb[cbtype]) {
+        PRTE_ERROR_LOG(PRTE_ERR_BAD_PARAM);
+        goto CLEANUP;
+    }
+    /* the callback tells us if the message carried anything
+     * new - if so, pass it along exactly as we received it */
     if( prte_grpcomm_rbcast_cb[cbtype](relay) ) {
-        /* forward the rbcast */
-        if (PRTE_SUCCESS == (ret = rbcast(rly))) {
-        }
+        send_to_peers(rly);
     }
 
 CLEANUP:
-    PMIX_DATA_BUFFER_RELEASE(rly);
+    PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
     PMIX_DATA_BUFFER_RELEASE(relay);
+    PRTE_RELEASE(rly);  // the sends hold their own references
 }
-
@@ -112,11 +112,12 @@ static int xcast(pmix_rank_t *vpids,
 {
     int rc;
 
-    /* send it to the HNP (could be myself) for relay */
-    if (0 > (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, buf, PRTE_RML_TAG_XCAST,
-                                          prte_rml_send_callback, NULL))) {
+    /* send it to the HNP (could be myself) for relay - the
+     * data is handed to the RML, and the caller releases the
+     * emptied buffer */
+    if (0 > (rc = prte_rml.send_transfer_nb(PRTE_PROC_MY_HNP, buf, PRTE_RML_TAG_XCAST,
+                                            prte_rml_send_callback, NULL))) {
         PRTE_ERROR_LOG(rc);
-        PMIX_DATA_BUFFER_RELEASE(buf);
         return rc;
     }
     return PRTE_SUCCESS;
@@ -355,7 +356,8 @@ static void xcast_recv(int status, pmix_proc_t* sender,
     prte_list_item_t *item;
     prte_namelist_t *nm;
     int ret, cnt;
-    pmix_data_buffer_t *relay=NULL, *rly, *rlycopy;
+    prte_rml_payload_t *rly;
+    prte_rml_recv_t *msg;
     pmix_data_buffer_t datbuf, *data;
     bool compressed;
     prte_job_t *jdata, *daemons;
@@ -372,42 +374,54 @@ static void xcast_recv(int status, pmix_proc_t* sender,
                          PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                          (int)buffer->bytes_used));
 
-    /* we need a passthru buffer to send to our children - we leave it
-     * as compressed data */
-    PMIX_DATA_BUFFER_CREATE(rly);
-    ret = PMIx_Data_copy_payload(rly, buffer);
+    /* we need a passthru payload to send to our children - we leave it
+     * as compressed data. Since nothing has been unpacked yet, we can
+     * take the incoming data over without copying it, and the payload
+     * is then shared by all the relay sends */
+    rly = PRTE_NEW(prte_rml_payload_t);
+    ret = PMIx_Data_unload(buffer, &bo);
     if (PMIX_SUCCESS != ret) {
         PMIX_ERROR_LOG(ret);
-        PMIX_DATA_BUFFER_RELEASE(rly);
+        PRTE_RELEASE(rly);
+        return;
+    }
+    ret = PMIx_Data_load(&rly->data, &bo);
+    if (PMIX_SUCCESS != ret) {
+        PMIX_ERROR_LOG(ret);
+        PMIX_BYTE_OBJECT_DESTRUCT(&bo);
+        PRTE_RELEASE(rly);
         return;
     }
     PMIX_DATA_BUFFER_CONSTRUCT(&datbuf);
     /* setup the relay list */
     PRTE_CONSTRUCT(&coll, prte_list_t);
 
-    /* unpack the flag to see if this payload is compressed */
+    /* unpack the flag to see if this payload is compressed - the relay
+     * sends always transmit the entire payload, so unpacking from it
+     * here does not affect them */
     cnt=1;
-    ret = PMIx_Data_unpack(NULL, buffer, &compressed, &cnt, PMIX_BOOL);
+    ret = PMIx_Data_unpack(NULL, &rly->data, &compressed, &cnt, PMIX_BOOL);
     if (PMIX_SUCCESS != ret) {
         PMIX_ERROR_LOG(ret);
         PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
         PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
         PRTE_DESTRUCT(&coll);
-        PMIX_DATA_BUFFER_RELEASE(rly);
+        PRTE_RELEASE(rly);
         return;
     }
     /* unpack the data blob */
     cnt = 1;
-    ret = PMIx_Data_unpack(NULL, buffer, &pbo, &cnt, PMIX_BYTE_OBJECT);
+    ret = PMIx_Data_unpack(NULL, &rly->data, &pbo, &cnt, PMIX_BYTE_OBJECT);
     if (PMIX_SUCCESS != ret) {
         PMIX_ERROR_LOG(ret);
         PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
         PRTE_DESTRUCT(&coll);
-        PMIX_DATA_BUFFER_RELEASE(rly);
+        PRTE_RELEASE(rly);
         return;
     }
     if (compressed) {
-        /* decompress the data */
+        /* decompress the data - this is the only decompression
+         * done on this hop, and it is solely for our own use */
         if (PMIx_Data_decompress((uint8_t**)&bo.bytes, &bo.size,
                                 (uint8_t*)pbo.bytes, pbo.size)) {
             /* the data has been uncompressed */
@@ -417,7 +431,7 @@ static void xcast_recv(int status, pmix_proc_t* sender,
                 PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
                 PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
                 PRTE_DESTRUCT(&coll);
-                PMIX_DATA_BUFFER_RELEASE(rly);
+                PRTE_RELEASE(rly);
                 return;
             }
         } else {
@@ -426,21 +440,22 @@ static void xcast_recv(int status, pmix_proc_t* sender,
             PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
             PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
             PRTE_DESTRUCT(&coll);
-            PMIX_DATA_BUFFER_RELEASE(rly);
+            PRTE_RELEASE(rly);
             return;
         }
+        PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
     } else {
+        /* the buffer takes ownership of the blob */
         ret = PMIx_Data_load(&datbuf, &pbo);
         if (PMIX_SUCCESS != ret) {
             PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
             PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
             PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
             PRTE_DESTRUCT(&coll);
-            PMIX_DATA_BUFFER_RELEASE(rly);
+            PRTE_RELEASE(rly);
             return;
         }
     }
-    PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
     data = &datbuf;
 
     /* get the signature that we do not need */
@@ -451,7 +466,7 @@ static void xcast_recv(int status, pmix_proc_t* sender,
         PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
         PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
         PRTE_DESTRUCT(&coll);
-        PMIX_DATA_BUFFER_RELEASE(rly);
+        PRTE_RELEASE(rly);
         return;
     }
     PMIX_PROC_CREATE(sig.signature, sig.sz);
@@ -462,7 +477,7 @@ static void xcast_recv(int status, pmix_proc_t* sender,
         PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
         PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
         PRTE_DESTRUCT(&coll);
-        PMIX_DATA_BUFFER_RELEASE(rly);
+        PRTE_RELEASE(rly);
         PMIX_PROC_FREE(sig.signature, sig.sz);
         return;
     }
@@ -476,20 +491,7 @@ static void xcast_recv(int status, pmix_proc_t* sender,
         PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
         PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
         PRTE_DESTRUCT(&coll);
-        PMIX_DATA_BUFFER_RELEASE(rly);
-        return;
-    }
-
-    /* copy the msg for relay to ourselves */
-    PMIX_DATA_BUFFER_CREATE(relay);
-    ret = PMIx_Data_copy_payload(relay, data);
-    if (PMIX_SUCCESS != ret) {
-        PMIX_ERROR_LOG(ret);
-        PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
-        PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
-        PRTE_DESTRUCT(&coll);
-        PMIX_DATA_BUFFER_RELEASE(rly);
-        PMIX_DATA_BUFFER_RELEASE(relay);
+        PRTE_RELEASE(rly);
         return;
     }
 
@@ -499,8 +501,7 @@ static void xcast_recv(int status, pmix_proc_t* sender,
             PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
             PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
             PRTE_DESTRUCT(&coll);
-            PMIX_DATA_BUFFER_RELEASE(rly);
-            PMIX_DATA_BUFFER_RELEASE(relay);
+            PRTE_RELEASE(rly);
             return;
         }
         if (PRTE_SUCCESS != (ret = prte_util_parse_node_info(data))) {
@@ -508,8 +509,7 @@ static void xcast_recv(int status, pmix_proc_t* sender,
             PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
             PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
             PRTE_DESTRUCT(&coll);
-            PMIX_DATA_BUFFER_RELEASE(rly);
-            PMIX_DATA_BUFFER_RELEASE(relay);
+            PRTE_RELEASE(rly);
             return;
         }
         /* unpack the wireup info */
@@ -524,8 +524,7 @@ static void xcast_recv(int status, pmix_proc_t* sender,
                 PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
                 PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
                 PRTE_DESTRUCT(&coll);
-                PMIX_DATA_BUFFER_RELEASE(rly);
-                PMIX_DATA_BUFFER_RELEASE(relay);
+                PRTE_RELEASE(rly);
                 return;
             }
 
@@ -537,8 +536,7 @@ static void xcast_recv(int status, pmix_proc_t* sender,
                 PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
                 PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
                 PRTE_DESTRUCT(&coll);
-                PMIX_DATA_BUFFER_RELEASE(rly);
-                PMIX_DATA_BUFFER_RELEASE(relay);
+                PRTE_RELEASE(rly);
                 return;
             }
         }
@@ -568,7 +566,7 @@ static void xcast_recv(int status, pmix_proc_t* sender,
 
             PRTE_OUTPUT_VERBOSE((5, prte_grpcomm_base_framework.framework_output,
                                  "%s grpcomm:direct:send_relay sending relay msg of %d bytes to %s",
-                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), (int)rly->bytes_used,
+                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), (int)rly->data.bytes_used,
                                  PRTE_NAME_PRINT(&nm->name)));
             /* check the state of the recipient - no point
              * sending to someone not alive
@@ -595,20 +593,10 @@ static void xcast_recv(int status, pmix_proc_t* sender,
                 PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
                 continue;
             }
-            /* copy the buffer for send */
-            PMIX_DATA_BUFFER_CREATE(rlycopy);
-            ret = PMIx_Data_copy_payload(rlycopy, rly);
-            if (PMIX_SUCCESS != ret) {
+            /* each send retains the shared payload */
+            if (PRTE_SUCCESS != (ret = prte_rml.send_payload_nb(&nm->name, rly, PRTE_RML_TAG_XCAST,
+                                                                prte_rml_send_callback, NULL))) {
                 PRTE_ERROR_LOG(ret);
-                PMIX_DATA_BUFFER_RELEASE(rlycopy);
-                PRTE_RELEASE(item);
-                PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
-                continue;
-            }
-            if (PRTE_SUCCESS != (ret = prte_rml.send_buffer_nb(&nm->name, rlycopy, PRTE_RML_TAG_XCAST,
-                                                               prte_rml_send_callback, NULL))) {
-                PRTE_ERROR_LOG(ret);
-                PMIX_DATA_BUFFER_RELEASE(rlycopy);
                 PRTE_RELEASE(item);
                 PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_FORCED_EXIT);
                 continue;
@@ -620,21 +608,27 @@ static void xcast_recv(int status, pmix_proc_t* sender,
  CLEANUP:
     /* cleanup */
     PRTE_LIST_DESTRUCT(&coll);
-    PMIX_DATA_BUFFER_RELEASE(rly);  // retain accounting
+    PRTE_RELEASE(rly);  // the sends hold their own references
 
-    /* now pass the relay buffer to myself for processing IFF it
+    /* now pass the remaining data to myself for processing IFF it
      * wasn't just a wireup message - don't
      * inject it into the RML system via send as that will compete
      * with the relay messages down in the OOB. Instead, pass it
-     * directly to the RML message processor */
+     * directly to the RML message processor. The decompressed buffer
+     * is handed over as-is, already positioned past the header we
+     * consumed, so the message itself is not copied */
     if (PRTE_RML_TAG_WIREUP != tag) {
-        PRTE_RML_POST_MESSAGE(PRTE_PROC_MY_NAME, tag, 1,
-                              relay->base_ptr, relay->bytes_used);
-        relay->base_ptr = NULL;
-        relay->bytes_used = 0;
-    }
-    if (NULL != relay) {
-        PMIX_DATA_BUFFER_RELEASE(relay);
+        prte_output_verbose(5, prte_rml_base_framework.framework_output,
+                            "%s Message posted at %s:%d for tag %d",
+                            PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                            __FILE__, __LINE__, tag);
+        msg = PRTE_NEW(prte_rml_recv_t);
+        PMIX_XFER_PROCID(&msg->sender, PRTE_PROC_MY_NAME);
+        msg->tag = tag;
+        msg->seq_num = 1;
+        msg->dbuf = datbuf;
+        PMIX_DATA_BUFFER_CONSTRUCT(&datbuf);
+        PRTE_RML_ACTIVATE_MESSAGE(msg);
     }
     PMIX_DATA_BUFFER_DESTRUCT(&datbuf);
 }
@@ -695,7 +689,7 @@ static void barrier_release(int status, pmix_proc_t* sender,
     if (NULL != coll->cbfunc) {
         coll->cbfunc(ret, buffer, coll->cbdata);
     }
-    prte_list_remove_item(&prte_grpcomm_base.ongoing, &coll->super);
+    prte_grpcomm_base_remove_tracker(coll);
     PRTE_RELEASE(coll);
     PMIX_PROC_FREE(sig.signature, sig.sz);
 }
@@ -62,6 +62,100 @@ static void lkcbfunc(pmix_status_t status, void *cbdata)
     PRTE_PMIX_WAKEUP_THREAD(lk);
 }
 
+/* deliver output forwarded by a daemon to any subscribed tools
+ * and to our own stdout/stderr */
+static void deliver_output(pmix_proc_t *origin, prte_iof_tag_t stream,
+                           unsigned char *data, int32_t numbytes)
+{
+    prte_iof_sink_t *sink;
+    bool exclusive;
+    prte_iof_proc_t *proct;
+
+    /* do we already have this process in our list? */
+    PRTE_LIST_FOREACH(proct, &prte_iof_hnp_component.procs, prte_iof_proc_t) {
+        if (PMIX_CHECK_PROCID(&proct->name, origin)) {
+            /* found it */
+            goto NSTEP;
+        }
+    }
+
+    /* if we get here, then we don't yet have this proc in our list */
+    proct = PRTE_NEW(prte_iof_proc_t);
+    PMIX_XFER_PROCID(&proct->name, origin);
+    prte_list_append(&prte_iof_hnp_component.procs, &proct->super);
+    prte_iof_base_check_target(proct);
+
+  NSTEP:
+    /* cycle through the endpoints to see if someone else wants a copy */
+    exclusive = false;
+    if (NULL != proct->subscribers) {
+        PRTE_LIST_FOREACH(sink, proct->subscribers, prte_iof_sink_t) {
+            /* if the target isn't set, then this sink is for another purpose - ignore it */
+            if (PMIX_NSPACE_INVALID(sink->daemon.nspace)) {
+                continue;
+            }
+            if ((stream & sink->tag) &&
+                PMIX_CHECK_PROCID(&sink->name, origin)) {
+                /* send the data to the tool */
+                    /* don't pass along zero byte blobs */
+                if (0 < numbytes) {
+                    PRTE_OUTPUT_VERBOSE((1, prte_iof_base_framework.framework_output,
+                                         "%s sending data from proc %s of size %d via PMIx to tool %s",
+                                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                                         PRTE_NAME_PRINT(origin), (int)numbytes,
+                                         PRTE_NAME_PRINT(&sink->daemon)));
+                    pmix_byte_object_t bo;
+                    pmix_iof_channel_t pchan;
+                    prte_pmix_lock_t lock;
+                    pmix_status_t prc;
+                    pchan = 0;
+                    if (PRTE_IOF_STDIN & stream) {
+                        pchan |= PMIX_FWD_STDIN_CHANNEL;
+                    }
+                    if (PRTE_IOF_STDOUT & stream) {
+                        pchan |= PMIX_FWD_STDOUT_CHANNEL;
+                    }
+                    if (PRTE_IOF_STDERR & stream) {
+                        pchan |= PMIX_FWD_STDERR_CHANNEL;
+                    }
+                    if (PRTE_IOF_STDDIAG & stream) {
+                        pchan |= PMIX_FWD_STDDIAG_CHANNEL;
+                    }
+                    /* setup the byte object */
+                    PMIX_BYTE_OBJECT_CONSTRUCT(&bo);
+                    bo.bytes = (char*)data;
+                    bo.size = numbytes;
+                    PRTE_PMIX_CONSTRUCT_LOCK(&lock);
+                    prc = PMIx_server_IOF_deliver(origin, pchan, &bo, NULL, 0, lkcbfunc, (void*)&lock);
+                    if (PMIX_SUCCESS != prc) {
+                        PMIX_ERROR_LOG(prc);
+                    } else {
+                        /* wait for completion */
+                        PRTE_PMIX_WAIT_THREAD(&lock);
+                    }
+                    PRTE_PMIX_DESTRUCT_LOCK(&lock);
+                }
+                if (sink->exclusive) {
+                    exclusive = true;
+                }
+            }
+        }
+    }
+    /* if the user doesn't want a copy written to the screen, then we are done */
+    if (!proct->copy) {
+        return;
+    }
+
+    /* output this to our local output unless one of the sinks was exclusive */
+    if (!exclusive) {
+        if (PRTE_IOF_STDOUT & stream) {
+            prte_iof_base_write_output(origin, stream, data, numbytes, prte_iof_base.iof_write_stdout->wev);
+        } else {
+            prte_iof_base_write_output(origin, stream, data, numbytes, prte_iof_base.iof_write_stderr->wev);
+        }
+    }
+}
+
 void prte_iof_hnp_recv(int status, pmix_proc_t* sender,
                        pmix_data_buffer_t* buffer, prte_rml_tag_t tag,
                        void* cbdata)
@@ -69,7 +163,7 @@ void prte_iof_hnp_recv(int status, pmix_proc_t* sender,
     pmix_proc_t origin, requestor;
     unsigned char data[PRTE_IOF_BASE_MSG_MAX];
     prte_iof_tag_t stream;
-    int32_t count, numbytes;
+    int32_t count, numbytes, nrecs, n;
     prte_iof_sink_t *sink, *next;
     int rc;
     bool exclusive;
@@ -105,6 +199,37 @@ void prte_iof_hnp_recv(int status, pmix_proc_t* sender,
             prte_iof_hnp_component.stdinev->active = false;
         }
         goto CLEAN_RETURN;
+    } else if (PRTE_IOF_BATCH & stream) {
+        /* a daemon aggregated output from its local procs - deliver
+         * the records in the order they were read */
+        count = 1;
+        rc = PMIx_Data_unpack(NULL, buffer, &nrecs, &count, PMIX_INT32);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            goto CLEAN_RETURN;
+        }
+        for (n=0; n < nrecs; n++) {
+            count = 1;
+            rc = PMIx_Data_unpack(NULL, buffer, &stream, &count, PMIX_UINT16);
+            if (PMIX_SUCCESS != rc) {
+                PMIX_ERROR_LOG(rc);
+                goto CLEAN_RETURN;
+            }
+            count = 1;
+            rc = PMIx_Data_unpack(NULL, buffer, &origin, &count, PMIX_PROC);
+            if (PMIX_SUCCESS != rc) {
+                PMIX_ERROR_LOG(rc);
+                goto CLEAN_RETURN;
+            }
+            numbytes = PRTE_IOF_BASE_MSG_MAX;
+            rc = PMIx_Data_unpack(NULL, buffer, data, &numbytes, PMIX_BYTE);
+            if (PMIX_SUCCESS != rc) {
+                PMIX_ERROR_LOG(rc);
+                goto CLEAN_RETURN;
+            }
+            deliver_output(&origin, stream, data, numbytes);
+        }
+        goto CLEAN_RETURN;
     }
 
     /* get name of the process whose io we are discussing */
@@ -230,89 +355,7 @@ void prte_iof_hnp_recv(int status, pmix_proc_t* sender,
                          PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), numbytes,
                          PRTE_NAME_PRINT(&origin)));
 
-    /* do we already have this process in our list? */
-    PRTE_LIST_FOREACH(proct, &prte_iof_hnp_component.procs, prte_iof_proc_t) {
-        if (PMIX_CHECK_PROCID(&proct->name, &origin)) {
-            /* found it */
-            goto NSTEP;
-        }
-    }
-
-    /* if we get here, then we don't yet have this proc in our list */
-    proct = PRTE_NEW(prte_iof_proc_t);
-    PMIX_XFER_PROCID(&proct->name, &origin);
-    prte_list_append(&prte_iof_hnp_component.procs, &proct->super);
-    prte_iof_base_check_target(proct);
-
-  NSTEP:
-    /* cycle through the endpoints to see if someone else wants a copy */
-    exclusive = false;
-    if (NULL != proct->subscribers) {
-        PRTE_LIST_FOREACH(sink, proct->subscribers, prte_iof_sink_t) {
-            /* if the target isn't set, then this sink is for another purpose - ignore it */
-            if (PMIX_NSPACE_INVALID(sink->daemon.nspace)) {
-                continue;
-            }
-            if ((stream & sink->tag) &&
-                PMIX_CHECK_PROCID(&sink->name, &origin)) {
-                /* send the data to the tool */
-                    /* don't pass along zero byte blobs */
-                if (0 < numbytes) {
-                    PRTE_OUTPUT_VERBOSE((1, prte_iof_base_framework.framework_output,
-                                         "%s sending data from proc %s of size %d via PMIx to tool %s",
-                                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                         PRTE_NAME_PRINT(&origin), (int)numbytes,
-                                         PRTE_NAME_PRINT(&sink->daemon)));
-                    pmix_byte_object_t bo;
-                    pmix_iof_channel_t pchan;
-                    prte_pmix_lock_t lock;
-                    pmix_status_t prc;
-                    pchan = 0;
-                    if (PRTE_IOF_STDIN & stream) {
-                        pchan |= PMIX_FWD_STDIN_CHANNEL;
-                    }
-                    if (PRTE_IOF_STDOUT & stream) {
-                        pchan |= PMIX_FWD_STDOUT_CHANNEL;
-                    }
-                    if (PRTE_IOF_STDERR & stream) {
-                        pchan |= PMIX_FWD_STDERR_CHANNEL;
-                    }
-                    if (PRTE_IOF_STDDIAG & stream) {
-                        pchan |= PMIX_FWD_STDDIAG_CHANNEL;
-                    }
-                    /* setup the byte object */
-                    PMIX_BYTE_OBJECT_CONSTRUCT(&bo);
-                    bo.bytes = (char*)data;
-                    bo.size = numbytes;
-                    PRTE_PMIX_CONSTRUCT_LOCK(&lock);
-                    prc = PMIx_server_IOF_deliver(&origin, pchan, &bo, NULL, 0, lkcbfunc, (void*)&lock);
-                    if (PMIX_SUCCESS != prc) {
-                        PMIX_ERROR_LOG(prc);
-                    } else {
-                        /* wait for completion */
-                        PRTE_PMIX_WAIT_THREAD(&lock);
-                    }
-                    PRTE_PMIX_DESTRUCT_LOCK(&lock);
-                }
-                if (sink->exclusive) {
-                    exclusive = true;
-                }
-            }
-        }
-    }
-    /* if the user doesn't want a copy written to the screen, then we are done */
-    if (!proct->copy) {
-        return;
-    }
-
-    /* output this to our local output unless one of the sinks was exclusive */
-    if (!exclusive) {
-        if (PRTE_IOF_STDOUT & stream) {
-            prte_iof_base_write_output(&origin, stream, data, numbytes, prte_iof_base.iof_write_stdout->wev);
-        } else {
-            prte_iof_base_write_output(&origin, stream, data, numbytes, prte_iof_base.iof_write_stderr->wev);
-        }
-    }
+    deliver_output(&origin, stream, data, numbytes);
 
  CLEAN_RETURN:
     return;
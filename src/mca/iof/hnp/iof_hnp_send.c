@@ -112,8 +112,10 @@ int prte_iof_hnp_send_data_to_endpoint(pmix_proc_t *host,
     /* send the buffer to the host - this is either a daemon or
      * a tool that requested IOF
      */
-    if (0 > (rc = prte_rml.send_buffer_nb(host, buf, PRTE_RML_TAG_IOF_PROXY,
-                                          prte_rml_send_callback, NULL))) {
+    rc = prte_rml.send_transfer_nb(host, buf, PRTE_RML_TAG_IOF_PROXY,
+                                   prte_rml_send_callback, NULL);
+    PMIX_DATA_BUFFER_RELEASE(buf);
+    if (0 > rc) {
         PRTE_ERROR_LOG(rc);
         return rc;
     }
@@ -42,6 +42,8 @@ typedef uint16_t prte_iof_tag_t;
 #define PRTE_IOF_STDOUTALL  0x000e
 #define PRTE_IOF_STDALL     0x000f
 #define PRTE_IOF_EXCLUSIVE  0x0100
+/* aggregated output records from a daemon */
+#define PRTE_IOF_BATCH      0x0800
 
 /* flow control flags */
 #define PRTE_IOF_XON        0x1000
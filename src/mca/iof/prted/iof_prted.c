@@ -101,6 +101,12 @@ prte_iof_base_module_t prte_iof_prted_module = {
     .finalize = finalize,
 };
 
+static void batch_timeout(int fd, short args, void *cbdata)
+{
+    prte_iof_prted_component.batch_timer_active = false;
+    prte_iof_prted_flush_batch();
+}
+
 static int init(void)
 {
     /* post a non-blocking RML receive to get messages
@@ -114,6 +120,12 @@ static int init(void)
     /* setup the local global variables */
     PRTE_CONSTRUCT(&prte_iof_prted_component.procs, prte_list_t);
     prte_iof_prted_component.xoff = false;
+    prte_iof_prted_component.batch = NULL;
+    prte_iof_prted_component.batch_count = 0;
+    prte_iof_prted_component.batch_bytes = 0;
+    prte_iof_prted_component.batch_timer_active = false;
+    prte_event_evtimer_set(prte_event_base, &prte_iof_prted_component.batch_ev,
+                           batch_timeout, NULL);
 
     return PRTE_SUCCESS;
 }
@@ -317,6 +329,9 @@ static int finalize(void)
 {
     prte_iof_proc_t *proct;
 
+    /* push out anything still being aggregated */
+    prte_iof_prted_flush_batch();
+
     /* cycle thru the procs and ensure all their output was delivered
      * if they were writing to files */
     while (NULL != (proct = (prte_iof_proc_t*)prte_list_remove_first(&prte_iof_prted_component.procs))) {
@@ -438,6 +453,9 @@ static int prted_output(const pmix_proc_t* peer,
     pmix_data_buffer_t *buf;
     int rc;
 
+    /* keep this in order with any aggregated output */
+    prte_iof_prted_flush_batch();
+
     /* prep the buffer */
     PMIX_DATA_BUFFER_CREATE(buf);
 
@@ -473,8 +491,9 @@ static int prted_output(const pmix_proc_t* peer,
                          "%s iof:prted:output sending %d bytes to HNP",
                          PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), (int)strlen(msg)+1));
 
-    prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, buf, PRTE_RML_TAG_IOF_HNP,
-                            prte_rml_send_callback, NULL);
+    prte_rml.send_transfer_nb(PRTE_PROC_MY_HNP, buf, PRTE_RML_TAG_IOF_HNP,
+                              prte_rml_send_callback, NULL);
+    PMIX_DATA_BUFFER_RELEASE(buf);
 
     return PRTE_SUCCESS;
 }
@@ -66,6 +66,14 @@ struct prte_iof_prted_component_t {
     prte_iof_base_component_t super;
     prte_list_t procs;
     bool xoff;
+    /* output aggregation */
+    int batch_size;                 /**< flush once this many bytes are pending (0 => no batching) */
+    int batch_usec;                 /**< max time output may wait before being flushed */
+    pmix_data_buffer_t *batch;      /**< pending (stream, proc, bytes) records */
+    int32_t batch_count;            /**< number of records in the batch */
+    size_t batch_bytes;             /**< number of output bytes in the batch */
+    prte_event_t batch_ev;          /**< latency timer */
+    bool batch_timer_active;
 };
 typedef struct prte_iof_prted_component_t prte_iof_prted_component_t;
 
@@ -78,6 +86,7 @@ void prte_iof_prted_recv(int status, pmix_proc_t* sender,
 
 void prte_iof_prted_read_handler(int fd, short event, void *data);
 void prte_iof_prted_send_xonxoff(prte_iof_tag_t tag);
+void prte_iof_prted_flush_batch(void);
 
 END_C_DECLS
 
@@ -37,6 +37,7 @@
 static int prte_iof_prted_open(void);
 static int prte_iof_prted_close(void);
 static int prte_iof_prted_query(prte_mca_base_module_t **module, int *priority);
+static int prte_iof_prted_register(void);
 
 
 /*
@@ -59,6 +60,7 @@ prte_iof_prted_component_t prte_iof_prted_component = {
             .mca_open_component = prte_iof_prted_open,
             .mca_close_component = prte_iof_prted_close,
             .mca_query_component = prte_iof_prted_query,
+            .mca_register_component_params = prte_iof_prted_register,
         },
         .iof_data = {
             /* The component is checkpoint ready */
@@ -67,6 +69,31 @@ prte_iof_prted_component_t prte_iof_prted_component = {
     }
 };
 
+static int prte_iof_prted_register(void)
+{
+    prte_iof_prted_component.batch_size = 16384;
+    (void) prte_mca_base_component_var_register(&prte_iof_prted_component.super.iof_version,
+                                           "batch_size",
+                                           "Aggregate output from local procs into messages of up to this many bytes before forwarding it to the HNP (0 => forward every read immediately)",
+                                           PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0,
+                                           PRTE_MCA_BASE_VAR_FLAG_NONE,
+                                           PRTE_INFO_LVL_5,
+                                           PRTE_MCA_BASE_VAR_SCOPE_READONLY,
+                                           &prte_iof_prted_component.batch_size);
+
+    prte_iof_prted_component.batch_usec = 10000;
+    (void) prte_mca_base_component_var_register(&prte_iof_prted_component.super.iof_version,
+                                           "batch_usec",
+                                           "Maximum time (in microseconds) aggregated output may be held before it is forwarded to the HNP",
+                                           PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0,
+                                           PRTE_MCA_BASE_VAR_FLAG_NONE,
+                                           PRTE_INFO_LVL_5,
+                                           PRTE_MCA_BASE_VAR_SCOPE_READONLY,
+                                           &prte_iof_prted_component.batch_usec);
+
+    return PRTE_SUCCESS;
+}
+
 /**
   * component open/close/init function
   */
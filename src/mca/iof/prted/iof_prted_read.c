@@ -45,6 +45,99 @@
 
 #include "iof_prted.h"
 
+/* forward all aggregated output to the HNP in a single message. The
+ * records are shipped in the order they were read, so output from
+ * any given proc remains in sequence */
+void prte_iof_prted_flush_batch(void)
+{
+    pmix_data_buffer_t *buf;
+    prte_iof_tag_t stream = PRTE_IOF_BATCH;
+    int rc;
+
+    if (prte_iof_prted_component.batch_timer_active) {
+        prte_event_evtimer_del(&prte_iof_prted_component.batch_ev);
+        prte_iof_prted_component.batch_timer_active = false;
+    }
+    if (NULL == prte_iof_prted_component.batch) {
+        return;
+    }
+
+    PMIX_DATA_BUFFER_CREATE(buf);
+    rc = PMIx_Data_pack(NULL, buf, &stream, 1, PMIX_UINT16);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        goto cleanup;
+    }
+    rc = PMIx_Data_pack(NULL, buf, &prte_iof_prted_component.batch_count, 1, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        goto cleanup;
+    }
+    rc = PMIx_Data_copy_payload(buf, prte_iof_prted_component.batch);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        goto cleanup;
+    }
+
+    PRTE_OUTPUT_VERBOSE((1, prte_iof_base_framework.framework_output,
+                         "%s iof:prted:flush sending %d records of %lu bytes to HNP",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                         prte_iof_prted_component.batch_count,
+                         (unsigned long)prte_iof_prted_component.batch_bytes));
+
+    /* hand the data to the RML - the emptied buffer is released below */
+    prte_rml.send_transfer_nb(PRTE_PROC_MY_HNP, buf, PRTE_RML_TAG_IOF_HNP,
+                              prte_rml_send_callback, NULL);
+
+  cleanup:
+    if (NULL != buf) {
+        PMIX_DATA_BUFFER_RELEASE(buf);
+    }
+    PMIX_DATA_BUFFER_RELEASE(prte_iof_prted_component.batch);
+    prte_iof_prted_component.batch = NULL;
+    prte_iof_prted_component.batch_count = 0;
+    prte_iof_prted_component.batch_bytes = 0;
+}
+
+static int batch_output(prte_iof_tag_t stream, pmix_proc_t *name,
+                        unsigned char *data, int32_t numbytes)
+{
+    struct timeval tv;
+    int rc;
+
+    if (NULL == prte_iof_prted_component.batch) {
+        PMIX_DATA_BUFFER_CREATE(prte_iof_prted_component.batch);
+    }
+    rc = PMIx_Data_pack(NULL, prte_iof_prted_component.batch, &stream, 1, PMIX_UINT16);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return prte_pmix_convert_status(rc);
+    }
+    rc = PMIx_Data_pack(NULL, prte_iof_prted_component.batch, name, 1, PMIX_PROC);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return prte_pmix_convert_status(rc);
+    }
+    rc = PMIx_Data_pack(NULL, prte_iof_prted_component.batch, data, numbytes, PMIX_BYTE);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return prte_pmix_convert_status(rc);
+    }
+    prte_iof_prted_component.batch_count++;
+    prte_iof_prted_component.batch_bytes += numbytes;
+
+    if (prte_iof_prted_component.batch_bytes >= (size_t)prte_iof_prted_component.batch_size) {
+        prte_iof_prted_flush_batch();
+    } else if (!prte_iof_prted_component.batch_timer_active) {
+        /* bound the time this output can sit here */
+        tv.tv_sec = prte_iof_prted_component.batch_usec / 1000000;
+        tv.tv_usec = prte_iof_prted_component.batch_usec % 1000000;
+        prte_event_evtimer_add(&prte_iof_prted_component.batch_ev, &tv);
+        prte_iof_prted_component.batch_timer_active = true;
+    }
+    return PRTE_SUCCESS;
+}
+
 void prte_iof_prted_read_handler(int fd, short event, void *cbdata)
 {
     prte_iof_read_event_t *rev = (prte_iof_read_event_t*)cbdata;
@@ -104,6 +197,16 @@ void prte_iof_prted_read_handler(int fd, short event, void *cbdata)
         return;
     }
 
+    if (0 < prte_iof_prted_component.batch_size) {
+        /* add it to the pending batch */
+        if (PRTE_SUCCESS != batch_output(rev->tag, &proct->name, data, numbytes)) {
+            goto CLEAN_RETURN;
+        }
+        /* re-add the event */
+        PRTE_IOF_READ_ACTIVATE(rev);
+        return;
+    }
+
     /* prep the buffer */
     PMIX_DATA_BUFFER_CREATE(buf);
 
@@ -135,8 +238,9 @@ void prte_iof_prted_read_handler(int fd, short event, void *cbdata)
                          "%s iof:prted:read handler sending %d bytes to HNP",
                          PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), numbytes));
 
-    prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, buf, PRTE_RML_TAG_IOF_HNP,
-                            prte_rml_send_callback, NULL);
+    prte_rml.send_transfer_nb(PRTE_PROC_MY_HNP, buf, PRTE_RML_TAG_IOF_HNP,
+                              prte_rml_send_callback, NULL);
+    PMIX_DATA_BUFFER_RELEASE(buf);
 
     /* re-add the event */
     PRTE_IOF_READ_ACTIVATE(rev);
@@ -162,6 +266,9 @@ void prte_iof_prted_read_handler(int fd, short event, void *cbdata)
     /* check to see if they are all done */
     if (NULL == proct->revstdout &&
         NULL == proct->revstderr) {
+        /* any of its output still being aggregated must reach
+         * the HNP before we declare the proc's iof complete */
+        prte_iof_prted_flush_batch();
         /* this proc's iof is complete */
         PRTE_ACTIVATE_PROC_STATE(&proct->name, PRTE_PROC_STATE_IOF_COMPLETE);
     }
@@ -155,18 +155,449 @@ static void setup_cbfunc(pmix_status_t status,
 
 }
 
+/* launches held until we have caught up on the jobs they may
+ * depend upon */
+typedef struct {
+    prte_list_item_t super;
+    pmix_data_buffer_t *buf;
+} prte_odls_held_launch_t;
+static void hl_con(prte_odls_held_launch_t *p)
+{
+    p->buf = NULL;
+}
+static void hl_des(prte_odls_held_launch_t *p)
+{
+    if (NULL != p->buf) {
+        PMIX_DATA_BUFFER_RELEASE(p->buf);
+    }
+}
+static PRTE_CLASS_INSTANCE(prte_odls_held_launch_t,
+                           prte_list_item_t,
+                           hl_con, hl_des);
+
+/* number of times we ask the HNP for a catalog before giving up */
+#define PRTE_ODLS_CATALOG_MAX_TRIES  3
+
+static void catalog_recv(int status, pmix_proc_t *sender,
+                         pmix_data_buffer_t *buffer,
+                         prte_rml_tag_t tag, void *cbdata);
+
+static prte_list_t held_launches;
+static bool held_init = false;
+static bool catalog_pending = false;
+static bool catalog_synced = false;
+static uint32_t catalog_lo = 0;
+static uint32_t catalog_hi = 0;
+static int catalog_tries = 0;
+
+/* pack the jobs launched with a catalog version in (lo, hi] so a
+ * daemon that missed those launches can add them to its job data.
+ * A daemon starting from scratch (lo == 0) also gets the jobs that
+ * were never launched, e.g., those of connected tools */
+int prte_odls_base_pack_job_catalog(pmix_data_buffer_t *buffer,
+                                    uint32_t lo, uint32_t hi)
+{
+    int rc, n, i;
+    prte_job_t *jptr;
+    pmix_data_buffer_t jobdata, priorjob;
+    prte_proc_t *proc;
+    pmix_byte_object_t pbo;
+    uint32_t version, *vptr = &version;
+
+    /* tell the requestor which range this is */
+    rc = PMIx_Data_pack(NULL, buffer, &lo, 1, PMIX_UINT32);
+    if (PMIX_SUCCESS == rc) {
+        rc = PMIx_Data_pack(NULL, buffer, &hi, 1, PMIX_UINT32);
+    }
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return rc;
+    }
+
+    PMIX_DATA_BUFFER_CONSTRUCT(&jobdata);
+    for (i=1; i < prte_job_data->size; i++) {
+        jptr = prte_pointer_array_get_item(prte_job_data, i);
+        if (NULL == jptr) {
+            continue;
+        }
+        if (prte_get_attribute(&jptr->attributes, PRTE_JOB_CATALOG_VERSION,
+                               (void**)&vptr, PMIX_UINT32)) {
+            if (version <= lo || hi < version) {
+                continue;
+            }
+        } else if (0 != lo) {
+            continue;
+        }
+        PMIX_DATA_BUFFER_CONSTRUCT(&priorjob);
+        /* pack the job struct */
+        rc = prte_job_pack(&priorjob, jptr);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            PMIX_DATA_BUFFER_DESTRUCT(&jobdata);
+            PMIX_DATA_BUFFER_DESTRUCT(&priorjob);
+            return rc;
+        }
+        /* pack the location of each proc */
+        for (n=0; n < jptr->procs->size; n++) {
+            if (NULL == (proc = (prte_proc_t*)prte_pointer_array_get_item(jptr->procs, n))) {
+                continue;
+            }
+            rc = PMIx_Data_pack(NULL, &priorjob, &proc->parent, 1, PMIX_PROC_RANK);
+            if (PMIX_SUCCESS != rc) {
+                PMIX_ERROR_LOG(rc);
+                PMIX_DATA_BUFFER_DESTRUCT(&jobdata);
+                PMIX_DATA_BUFFER_DESTRUCT(&priorjob);
+                return rc;
+            }
+        }
+        /* unload the buffer */
+        rc = PMIx_Data_unload(&priorjob, &pbo);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            PMIX_DATA_BUFFER_DESTRUCT(&priorjob);
+            PMIX_DATA_BUFFER_DESTRUCT(&jobdata);
+            return rc;
+        }
+        /* add it to the jobdata buffer */
+        rc = PMIx_Data_pack(NULL, &jobdata, &pbo, 1, PMIX_BYTE_OBJECT);
+        PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            PMIX_DATA_BUFFER_DESTRUCT(&jobdata);
+            return rc;
+        }
+    }
+    /* unload the buffer */
+    rc = PMIx_Data_unload(&jobdata, &pbo);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        PMIX_DATA_BUFFER_DESTRUCT(&jobdata);
+        return rc;
+    }
+    /* add it to the message */
+    rc = PMIx_Data_pack(NULL, buffer, &pbo, 1, PMIX_BYTE_OBJECT);
+    PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+    }
+    return rc;
+}
+
+/* add the jobs in a catalog to our job data. A job is only kept
+ * once all of its procs have been located so that a retry will
+ * pick up anything we failed to complete */
+static int unpack_catalog(pmix_data_buffer_t *buffer)
+{
+    prte_job_t *jdata, *daemons;
+    prte_proc_t *pptr, *dmn;
+    pmix_data_buffer_t dbuf, jdbuf;
+    pmix_byte_object_t bo, pbo;
+    pmix_rank_t dmnvpid, v;
+    int32_t cnt;
+    int rc;
+
+    daemons = prte_get_job_data_object(PRTE_PROC_MY_NAME->nspace);
+
+    /* unpack the buffer containing the info */
+    cnt=1;
+    rc = PMIx_Data_unpack(NULL, buffer, &bo, &cnt, PMIX_BYTE_OBJECT);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return prte_pmix_convert_status(rc);
+    }
+    PMIX_DATA_BUFFER_CONSTRUCT(&dbuf);
+    rc = PMIx_Data_load(&dbuf, &bo);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        PMIX_BYTE_OBJECT_DESTRUCT(&bo);
+        return prte_pmix_convert_status(rc);
+    }
+    cnt=1;
+    rc = PMIx_Data_unpack(NULL, &dbuf, &pbo, &cnt, PMIX_BYTE_OBJECT);
+    while (PMIX_SUCCESS == rc) {
+        PMIX_DATA_BUFFER_CONSTRUCT(&jdbuf);
+        rc = PMIx_Data_load(&jdbuf, &pbo);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
+            break;
+        }
+        /* unpack each job and add it to the local prte_job_data array */
+        rc = prte_job_unpack(&jdbuf, &jdata);
+        if (PRTE_SUCCESS != rc) {
+            PRTE_ERROR_LOG(rc);
+            PMIX_DATA_BUFFER_DESTRUCT(&jdbuf);
+            break;
+        }
+        /* check to see if we already have this one */
+        if (NULL != prte_get_job_data_object(jdata->nspace)) {
+            /* yep - so we can drop this copy */
+            jdata->index = -1;
+            PRTE_RELEASE(jdata);
+        } else {
+            /* nope - add it */
+            prte_set_job_data_object(jdata);
+            /* unpack the location of each proc in this job */
+            for (v=0; v < jdata->num_procs; v++) {
+                if (NULL == (pptr = (prte_proc_t*)prte_pointer_array_get_item(jdata->procs, v))) {
+                    pptr = PRTE_NEW(prte_proc_t);
+                    PMIX_LOAD_PROCID(&pptr->name, jdata->nspace, v);
+                    prte_pointer_array_set_item(jdata->procs, v, pptr);
+                }
+                cnt=1;
+                rc = PMIx_Data_unpack(NULL, &jdbuf, &dmnvpid, &cnt, PMIX_PROC_RANK);
+                if (PMIX_SUCCESS != rc) {
+                    PMIX_ERROR_LOG(rc);
+                    break;
+                }
+                /* lookup the daemon */
+                if (NULL == (dmn = (prte_proc_t*)prte_pointer_array_get_item(daemons->procs, dmnvpid))) {
+                    PRTE_ERROR_LOG(PRTE_ERR_NOT_FOUND);
+                    rc = PRTE_ERR_NOT_FOUND;
+                    break;
+                }
+                /* connect the two */
+                PRTE_RETAIN(dmn->node);
+                pptr->node = dmn->node;
+            }
+            if (PMIX_SUCCESS != rc) {
+                /* don't keep a partial job - releasing it
+                 * also removes it from the job data array */
+                PRTE_RELEASE(jdata);
+            }
+        }
+        /* release the buffer */
+        PMIX_DATA_BUFFER_DESTRUCT(&jdbuf);
+        if (PMIX_SUCCESS != rc) {
+            break;
+        }
+        cnt = 1;
+        rc = PMIx_Data_unpack(NULL, &dbuf, &pbo, &cnt, PMIX_BYTE_OBJECT);
+    }
+    PMIX_DATA_BUFFER_DESTRUCT(&dbuf);
+    if (PMIX_ERR_UNPACK_READ_PAST_END_OF_BUFFER == rc) {
+        return PRTE_SUCCESS;
+    }
+    return prte_pmix_convert_status(rc);
+}
+
+/* ask the HNP for the jobs launched with a catalog version
+ * in (lo, hi] - these are the launches we missed */
+static int request_catalog(uint32_t lo, uint32_t hi)
+{
+    static bool recv_posted = false;
+    pmix_data_buffer_t *buf;
+    prte_daemon_cmd_flag_t command = PRTE_DAEMON_JOB_CATALOG_CMD;
+    int rc;
+
+    PRTE_OUTPUT_VERBOSE((5, prte_odls_base_framework.framework_output,
+                         "%s odls:requesting job catalog versions %u-%u",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), lo + 1, hi));
+
+    if (!recv_posted) {
+        prte_rml.recv_buffer_nb(PRTE_PROC_MY_HNP, PRTE_RML_TAG_JOB_CATALOG,
+                                PRTE_RML_PERSISTENT, catalog_recv, NULL);
+        recv_posted = true;
+    }
+
+    PMIX_DATA_BUFFER_CREATE(buf);
+    rc = PMIx_Data_pack(NULL, buf, &command, 1, PRTE_DAEMON_CMD);
+    if (PMIX_SUCCESS == rc) {
+        rc = PMIx_Data_pack(NULL, buf, &lo, 1, PMIX_UINT32);
+    }
+    if (PMIX_SUCCESS == rc) {
+        rc = PMIx_Data_pack(NULL, buf, &hi, 1, PMIX_UINT32);
+    }
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        PMIX_DATA_BUFFER_RELEASE(buf);
+        return prte_pmix_convert_status(rc);
+    }
+    if (0 > (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, buf, PRTE_RML_TAG_DAEMON,
+                                          prte_rml_send_callback, NULL))) {
+        PRTE_ERROR_LOG(rc);
+        PMIX_DATA_BUFFER_RELEASE(buf);
+        return rc;
+    }
+    catalog_pending = true;
+    catalog_lo = lo;
+    catalog_hi = hi;
+    return PRTE_SUCCESS;
+}
+
+/* we could not obtain the jobs this launch depends upon, so
+ * report it as never launched rather than hang */
+static void fail_held_launch(pmix_data_buffer_t *buffer)
+{
+    prte_job_t *jdata;
+    uint32_t version;
+    int8_t flag;
+    int32_t cnt;
+    int rc;
+
+    cnt = 1;
+    rc = PMIx_Data_unpack(NULL, buffer, &version, &cnt, PMIX_UINT32);
+    if (PMIX_SUCCESS == rc) {
+        cnt = 1;
+        rc = PMIx_Data_unpack(NULL, buffer, &flag, &cnt, PMIX_INT8);
+    }
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return;
+    }
+    if (PRTE_SUCCESS != (rc = prte_job_unpack(buffer, &jdata))) {
+        PRTE_ERROR_LOG(rc);
+        return;
+    }
+    if (NULL == prte_get_job_data_object(jdata->nspace)) {
+        prte_set_job_data_object(jdata);
+    } else {
+        jdata->index = -1;
+        PRTE_RELEASE(jdata);
+        jdata = prte_get_job_data_object(jdata->nspace);
+    }
+    PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_NEVER_LAUNCHED);
+}
+
+/* release the held launches - they are either launched now or, if
+ * they still depend on jobs we lack, held again */
+static void release_held_launches(bool failed)
+{
+    prte_list_t held;
+    prte_odls_held_launch_t *hl;
+    int rc;
+
+    PRTE_CONSTRUCT(&held, prte_list_t);
+    prte_list_join(&held, prte_list_get_end(&held), &held_launches);
+    while (NULL != (hl = (prte_odls_held_launch_t*)prte_list_remove_first(&held))) {
+        if (failed) {
+            fail_held_launch(hl->buf);
+        } else if (!prte_odls_base_hold_launch(hl->buf) &&
+                   PRTE_SUCCESS != (rc = prte_odls.launch_local_procs(hl->buf))) {
+            PRTE_OUTPUT_VERBOSE((1, prte_odls_base_framework.framework_output,
+                                 "%s odls:held launch failed on error %s",
+                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_ERROR_NAME(rc)));
+        }
+        PRTE_RELEASE(hl);
+    }
+    PRTE_DESTRUCT(&held);
+}
+
+static void catalog_recv(int status, pmix_proc_t *sender,
+                         pmix_data_buffer_t *buffer,
+                         prte_rml_tag_t tag, void *cbdata)
+{
+    uint32_t lo, hi;
+    int32_t cnt;
+    int rc;
+
+    cnt=1;
+    rc = PMIx_Data_unpack(NULL, buffer, &lo, &cnt, PMIX_UINT32);
+    if (PMIX_SUCCESS == rc) {
+        cnt=1;
+        rc = PMIx_Data_unpack(NULL, buffer, &hi, &cnt, PMIX_UINT32);
+    }
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        rc = prte_pmix_convert_status(rc);
+    } else if (!catalog_pending || lo != catalog_lo || hi != catalog_hi) {
+        /* stale answer to a request we already retried */
+        return;
+    } else {
+        rc = unpack_catalog(buffer);
+    }
+    catalog_pending = false;
+
+    if (PRTE_SUCCESS == rc) {
+        catalog_tries = 0;
+        catalog_synced = true;
+        if (prte_odls_globals.catalog_version < catalog_hi) {
+            prte_odls_globals.catalog_version = catalog_hi;
+        }
+        release_held_launches(false);
+        return;
+    }
+
+    /* try again - anything we already added will be ignored */
+    if (++catalog_tries < PRTE_ODLS_CATALOG_MAX_TRIES &&
+        PRTE_SUCCESS == request_catalog(catalog_lo, catalog_hi)) {
+        return;
+    }
+    PRTE_ERROR_LOG(rc);
+    catalog_tries = 0;
+    release_held_launches(true);
+}
+
+/* check if the launch in the buffer depends on jobs we missed
+ * and, if so, hold a copy of it until we have fetched them. The
+ * provided buffer is not modified */
+bool prte_odls_base_hold_launch(pmix_data_buffer_t *buffer)
+{
+    pmix_data_buffer_t peek;
+    prte_odls_held_launch_t *hl;
+    uint32_t version, lo;
+    int8_t flag;
+    int32_t cnt;
+    int rc;
+
+    if (PRTE_PROC_IS_MASTER) {
+        return false;
+    }
+    if (!held_init) {
+        PRTE_CONSTRUCT(&held_launches, prte_list_t);
+        held_init = true;
+    }
+
+    PMIX_DATA_BUFFER_CONSTRUCT(&peek);
+    rc = PMIx_Data_copy_payload(&peek, buffer);
+    if (PMIX_SUCCESS == rc) {
+        cnt = 1;
+        rc = PMIx_Data_unpack(NULL, &peek, &version, &cnt, PMIX_UINT32);
+    }
+    if (PMIX_SUCCESS == rc) {
+        cnt = 1;
+        rc = PMIx_Data_unpack(NULL, &peek, &flag, &cnt, PMIX_INT8);
+    }
+    PMIX_DATA_BUFFER_DESTRUCT(&peek);
+    if (PMIX_SUCCESS != rc) {
+        /* let the launch report it */
+        return false;
+    }
+
+    /* launches must be processed in order */
+    if (!catalog_pending) {
+        lo = prte_odls_globals.catalog_version;
+        if (lo + 1 >= version && (0 == flag || catalog_synced || 0 != lo)) {
+            /* we have everything this launch needs */
+            return false;
+        }
+        if (PRTE_SUCCESS != request_catalog(lo, version - 1)) {
+            return false;
+        }
+    }
+
+    hl = PRTE_NEW(prte_odls_held_launch_t);
+    PMIX_DATA_BUFFER_CREATE(hl->buf);
+    rc = PMIx_Data_copy_payload(hl->buf, buffer);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        PRTE_RELEASE(hl);
+        return false;
+    }
+    prte_list_append(&held_launches, &hl->super);
+    return true;
+}
+
 /* IT IS CRITICAL THAT ANY CHANGE IN THE ORDER OF THE INFO PACKED IN
  * THIS FUNCTION BE REFLECTED IN THE CONSTRUCT_CHILD_LIST PARSER BELOW
 */
 int prte_odls_base_default_get_add_procs_data(pmix_data_buffer_t *buffer,
                                               pmix_nspace_t job)
 {
-    int rc, n;
+    int rc;
     prte_job_t *jdata=NULL, *jptr;
     prte_job_map_t *map=NULL;
-    pmix_data_buffer_t jobdata, priorjob;
     int8_t flag;
-    prte_proc_t *proc;
     pmix_info_t *info;
     pmix_status_t ret;
     prte_node_t *node;
@@ -176,7 +607,7 @@ int prte_odls_base_default_get_add_procs_data(pmix_data_buffer_t *buffer,
     prte_proc_t *pptr;
     uint32_t uid;
     uint32_t gid;
-    pmix_byte_object_t pbo;
+    uint32_t version;
 
     /* get the job data pointer */
     if (NULL == (jdata = prte_get_job_data_object(job))) {
@@ -191,86 +622,36 @@ int prte_odls_base_default_get_add_procs_data(pmix_data_buffer_t *buffer,
         return PRTE_SUCCESS;
     }
 
-    /* we need to ensure that any new daemons get a complete
-     * copy of all active jobs so the grpcomm collectives can
-     * properly work should a proc from one of the other jobs
-     * interact with this one */
+    /* stamp the job with the next catalog version and include it
+     * so that any daemon that missed earlier launches - e.g., one
+     * that was just added to the DVM - can fetch the jobs it lacks
+     * from us. This keeps the launch message independent of how
+     * many jobs the DVM has already run */
+    version = ++prte_odls_globals.catalog_version;
+    prte_set_attribute(&jdata->attributes, PRTE_JOB_CATALOG_VERSION, PRTE_ATTR_LOCAL,
+                       &version, PMIX_UINT32);
+    rc = PMIx_Data_pack(NULL, buffer, &version, 1, PMIX_UINT32);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return rc;
+    }
+    /* any daemons we just started know nothing of the jobs that
+     * were never launched, so flag that they need to ask for them
+     * if there are any other jobs at all */
+    flag = 0;
     if (prte_get_attribute(&jdata->attributes, PRTE_JOB_LAUNCHED_DAEMONS, NULL, PMIX_BOOL)) {
-        flag = 1;
-        rc = PMIx_Data_pack(NULL, buffer, &flag, 1, PMIX_INT8);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
-            return rc;
-        }
-        PMIX_DATA_BUFFER_CONSTRUCT(&jobdata);
         for (i=1; i < prte_job_data->size; i++) {
             jptr = prte_pointer_array_get_item(prte_job_data, i);
-            if (NULL == jptr) {
-                continue;
-            }
-            /* skip the one we are launching now */
-            if (jptr != jdata) {
-                PMIX_DATA_BUFFER_CONSTRUCT(&priorjob);
-                /* pack the job struct */
-                rc = prte_job_pack(&priorjob, jptr);
-                if (PMIX_SUCCESS != rc) {
-                    PMIX_ERROR_LOG(rc);
-                    PMIX_DATA_BUFFER_DESTRUCT(&jobdata);
-                    PMIX_DATA_BUFFER_DESTRUCT(&priorjob);
-                    return rc;
-                }
-                /* pack the location of each proc */
-                for (n=0; n < jptr->procs->size; n++) {
-                    if (NULL == (proc = (prte_proc_t*)prte_pointer_array_get_item(jptr->procs, n))) {
-                        continue;
-                    }
-                    rc = PMIx_Data_pack(NULL, &priorjob, &proc->parent, 1, PMIX_PROC_RANK);
-                    if (PMIX_SUCCESS != rc) {
-                        PMIX_ERROR_LOG(rc);
-                        PMIX_DATA_BUFFER_DESTRUCT(&jobdata);
-                        PMIX_DATA_BUFFER_DESTRUCT(&priorjob);
-                        return rc;
-                    }
-                }
-                /* unload the buffer */
-                rc = PMIx_Data_unload(&priorjob, &pbo);
-                if (PMIX_SUCCESS != rc) {
-                    PMIX_ERROR_LOG(rc);
-                    PMIX_DATA_BUFFER_DESTRUCT(&priorjob);
-                    PMIX_DATA_BUFFER_DESTRUCT(&jobdata);
-                    return rc;
-                }
-                /* add it to the jobdata buffer */
-                rc = PMIx_Data_pack(NULL, &jobdata, &pbo, 1, PMIX_BYTE_OBJECT);
-                PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
-                if (PMIX_SUCCESS != rc) {
-                    PMIX_ERROR_LOG(rc);
-                    PMIX_DATA_BUFFER_DESTRUCT(&jobdata);
-                    return rc;
-                }
+            if (NULL != jptr && jptr != jdata) {
+                flag = 1;
+                break;
             }
         }
-        /* unload the buffer */
-        rc = PMIx_Data_unload(&jobdata, &pbo);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
-            PMIX_DATA_BUFFER_DESTRUCT(&jobdata);
-            return rc;
-        }
-        /* add it to the message */
-        rc = PMIx_Data_pack(NULL, buffer, &pbo, 1, PMIX_BYTE_OBJECT);
-        PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
-            return rc;
-        }
-    } else {
-        flag = 0;
-        rc = PMIx_Data_pack(NULL, buffer, &flag, 1, PMIX_INT8);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
-            return rc;
-        }
+    }
+    rc = PMIx_Data_pack(NULL, buffer, &flag, 1, PMIX_INT8);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return rc;
     }
 
     /* pack the job struct */
@@ -395,18 +776,17 @@ int prte_odls_base_default_construct_child_list(pmix_data_buffer_t *buffer,
     int32_t cnt;
     prte_job_t *jdata=NULL, *daemons;
     prte_node_t *node;
-    pmix_rank_t dmnvpid, v;
     int32_t n;
-    pmix_data_buffer_t dbuf, jdbuf;
     prte_proc_t *pptr, *dmn;
     prte_app_context_t *app;
+    uint32_t version;
     int8_t flag;
     prte_pmix_lock_t lock;
     pmix_info_t *info = NULL;
     size_t ninfo=0;
     pmix_status_t ret;
     pmix_data_buffer_t pbuf;
-    pmix_byte_object_t bo, pbo;
+    pmix_byte_object_t bo;
     size_t m;
     pmix_envar_t envt;
 
@@ -421,7 +801,14 @@ int prte_odls_base_default_construct_child_list(pmix_data_buffer_t *buffer,
     daemons = prte_get_job_data_object(PRTE_PROC_MY_NAME->nspace);
     PRTE_PMIX_CONSTRUCT_LOCK(&lock);
 
-    /* unpack the flag to see if new daemons were launched */
+    /* unpack the catalog version of this job */
+    cnt=1;
+    rc = PMIx_Data_unpack(NULL, buffer, &version, &cnt, PMIX_UINT32);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        rc = prte_pmix_convert_status(rc);
+        goto REPORT_ERROR;
+    }
     cnt=1;
     rc = PMIx_Data_unpack(NULL, buffer, &flag, &cnt, PMIX_INT8);
     if (PMIX_SUCCESS != rc) {
@@ -429,97 +816,14 @@ int prte_odls_base_default_construct_child_list(pmix_data_buffer_t *buffer,
         rc = prte_pmix_convert_status(rc);
         goto REPORT_ERROR;
     }
-
-    if (0 != flag) {
-        /* unpack the buffer containing the info */
-        cnt=1;
-        rc = PMIx_Data_unpack(NULL, buffer, &bo, &cnt, PMIX_BYTE_OBJECT);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
-            rc = prte_pmix_convert_status(rc);
-            goto REPORT_ERROR;
-        }
-        if (PRTE_PROC_IS_MASTER) {
-            /* we don't need this */
-            PMIX_BYTE_OBJECT_DESTRUCT(&bo);
-            goto next;
-        }
-        PMIX_DATA_BUFFER_CONSTRUCT(&dbuf);
-        rc = PMIx_Data_load(&dbuf, &bo);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
-            rc = prte_pmix_convert_status(rc);
-            goto REPORT_ERROR;
-        }
-        cnt=1;
-        rc = PMIx_Data_unpack(NULL, &dbuf, &pbo, &cnt, PMIX_BYTE_OBJECT);
-        while (PMIX_SUCCESS == rc) {
-            PMIX_DATA_BUFFER_CONSTRUCT(&jdbuf);
-            rc = PMIx_Data_load(&jdbuf, &pbo);
-            if (PMIX_SUCCESS != rc) {
-                PMIX_ERROR_LOG(rc);
-                rc = prte_pmix_convert_status(rc);
-                goto REPORT_ERROR;
-            }
-            /* unpack each job and add it to the local prte_job_data array */
-            cnt=1;
-            rc = prte_job_unpack(&jdbuf, &jdata);
-            if (PRTE_SUCCESS != rc) {
-                PRTE_ERROR_LOG(rc);
-                PMIX_DATA_BUFFER_DESTRUCT(&dbuf);
-                PMIX_DATA_BUFFER_DESTRUCT(&jdbuf);
-                goto REPORT_ERROR;
-            }
-            /* check to see if we already have this one */
-            if (NULL != prte_get_job_data_object(jdata->nspace)) {
-                /* yep - so we can drop this copy */
-                jdata->index = -1;
-                PRTE_RELEASE(jdata);
-            } else {
-                /* nope - add it */
-                prte_set_job_data_object(jdata);
-                /* unpack the location of each proc in this job */
-                for (v=0; v < jdata->num_procs; v++) {
-                    if (NULL == (pptr = (prte_proc_t*)prte_pointer_array_get_item(jdata->procs, v))) {
-                        pptr = PRTE_NEW(prte_proc_t);
-                        PMIX_LOAD_PROCID(&pptr->name, jdata->nspace, v);
-                        prte_pointer_array_set_item(jdata->procs, v, pptr);
-                    }
-                    cnt=1;
-                    rc = PMIx_Data_unpack(NULL, &jdbuf, &dmnvpid, &cnt, PMIX_PROC_RANK);
-                    if (PMIX_SUCCESS != rc) {
-                        PMIX_ERROR_LOG(rc);
-                        PMIX_DATA_BUFFER_DESTRUCT(&dbuf);
-                        PMIX_DATA_BUFFER_DESTRUCT(&jdbuf);
-                        goto REPORT_ERROR;
-                    }
-                    /* lookup the daemon */
-                    if (NULL == (dmn = (prte_proc_t*)prte_pointer_array_get_item(daemons->procs, dmnvpid))) {
-                        PRTE_ERROR_LOG(PRTE_ERR_NOT_FOUND);
-                        rc = PRTE_ERR_NOT_FOUND;
-                        PMIX_DATA_BUFFER_DESTRUCT(&dbuf);
-                        PMIX_DATA_BUFFER_DESTRUCT(&jdbuf);
-                        goto REPORT_ERROR;
-                    }
-                    /* connect the two */
-                    PRTE_RETAIN(dmn->node);
-                    pptr->node = dmn->node;
-                }
-            }
-            /* release the buffer */
-            PMIX_DATA_BUFFER_DESTRUCT(&jdbuf);
-            cnt = 1;
-            rc = PMIx_Data_unpack(NULL, &dbuf, &pbo, &cnt, PMIX_BYTE_OBJECT);
-        }
-        PMIX_DATA_BUFFER_DESTRUCT(&dbuf);
-        if (PMIX_SUCCESS != rc && PMIX_ERR_UNPACK_READ_PAST_END_OF_BUFFER != rc) {
-            PMIX_ERROR_LOG(rc);
-            rc = prte_pmix_convert_status(rc);
-            goto REPORT_ERROR;
-        }
+    /* any jobs launched before this one that we need so the grpcomm
+     * collectives can properly work should a proc from one of them
+     * interact with this one were fetched before we got here - see
+     * prte_odls_base_hold_launch */
+    if (!PRTE_PROC_IS_MASTER && prte_odls_globals.catalog_version < version) {
+        prte_odls_globals.catalog_version = version;
     }
 
-next:
     /* unpack the job we are to launch */
     rc = prte_job_unpack(buffer, &jdata);
     if (PMIX_SUCCESS != rc) {
@@ -900,35 +1204,40 @@ static int compute_num_procs_alive(pmix_nspace_t job)
     return num_procs_alive;
 }
 
-void prte_odls_base_spawn_proc(int fd, short sd, void *cbdata)
+/* spawn a single child - on error, the child is flagged and the
+ * state to be reported is left in the caddy. This executes in the
+ * context of an odls progress thread, so it must not touch anything
+ * other than the child, the caddy and the (read-only) prep */
+static int spawn_child(prte_odls_spawn_caddy_t *cd)
 {
-    prte_odls_spawn_caddy_t *cd = (prte_odls_spawn_caddy_t*)cbdata;
     prte_job_t *jobdat = cd->jdata;
     prte_app_context_t *app = cd->app;
     prte_proc_t *child = cd->child;
     int rc, i;
-    bool found;
-    prte_proc_state_t state;
+    bool found, xterm;
     pmix_proc_t pproc;
     pmix_status_t ret;
     char *ptr;
 
-    PRTE_ACQUIRE_OBJECT(cd);
-
     /* thread-protect common values */
-    cd->env = prte_argv_copy(prte_launch_environ);
-    if (NULL != app->env) {
-        for (i=0; NULL != app->env[i]; i++) {
-            /* find the '=' sign.
-             * strdup the env string to a tmp variable,
-             * since it is shared among apps.
-             */
-            char *tmp = strdup(app->env[i]);
-            ptr = strchr(tmp, '=');
-            *ptr = '\0';
-            ++ptr;
-            prte_setenv(tmp, ptr, true, &cd->env);
-            free(tmp);
+    if (NULL != cd->prep) {
+        /* the app's environment was merged when the launch was prepared */
+        cd->env = prte_argv_copy(cd->prep->env);
+    } else {
+        cd->env = prte_argv_copy(prte_launch_environ);
+        if (NULL != app->env) {
+            for (i=0; NULL != app->env[i]; i++) {
+                /* find the '=' sign.
+                 * strdup the env string to a tmp variable,
+                 * since it is shared among apps.
+                 */
+                char *tmp = strdup(app->env[i]);
+                ptr = strchr(tmp, '=');
+                *ptr = '\0';
+                ++ptr;
+                prte_setenv(tmp, ptr, true, &cd->env);
+                free(tmp);
+            }
         }
     }
 
@@ -943,7 +1252,7 @@ void prte_odls_base_spawn_proc(int fd, short sd, void *cbdata)
     if (PMIX_SUCCESS != (ret = PMIx_server_setup_fork(&pproc, &cd->env))) {
         PMIX_ERROR_LOG(ret);
         rc = PRTE_ERROR;
-        state = PRTE_PROC_STATE_FAILED_TO_LAUNCH;
+        cd->state = PRTE_PROC_STATE_FAILED_TO_LAUNCH;
         goto errorout;
     }
 
@@ -966,18 +1275,23 @@ void prte_odls_base_spawn_proc(int fd, short sd, void *cbdata)
      */
     if (PRTE_SUCCESS != (rc = prte_schizo.setup_child(jobdat, child, app, &cd->env))) {
         PRTE_ERROR_LOG(rc);
-        state = PRTE_PROC_STATE_FAILED_TO_LAUNCH;
+        cd->state = PRTE_PROC_STATE_FAILED_TO_LAUNCH;
         goto errorout;
     }
 
     /* did the user request we display output in xterms? */
-    if (NULL != prte_xterm &&
-        !PRTE_FLAG_TEST(jobdat, PRTE_JOB_FLAG_DEBUGGER_DAEMON) &&
-        !PRTE_FLAG_TEST(jobdat, PRTE_JOB_FLAG_TOOL)) {
+    if (NULL != cd->prep) {
+        xterm = cd->prep->xterm;
+    } else {
+        xterm = (NULL != prte_xterm &&
+                 !PRTE_FLAG_TEST(jobdat, PRTE_JOB_FLAG_DEBUGGER_DAEMON) &&
+                 !PRTE_FLAG_TEST(jobdat, PRTE_JOB_FLAG_TOOL));
+    }
+    found = false;
+    if (xterm) {
         prte_list_item_t *nmitem;
         prte_namelist_t *nm;
         /* see if this rank is one of those requested */
-        found = false;
         for (nmitem = prte_list_get_first(&prte_odls_globals.xterm_ranks);
              nmitem != prte_list_get_end(&prte_odls_globals.xterm_ranks);
              nmitem = prte_list_get_next(nmitem)) {
@@ -1004,32 +1318,36 @@ void prte_odls_base_spawn_proc(int fd, short sd, void *cbdata)
                                "prte-odls-base:xterm-rank-out-of-bounds",
                                true, prte_process_info.nodename,
                                nm->name.rank, jobdat->num_procs);
-                state = PRTE_PROC_STATE_FAILED_TO_LAUNCH;
+                rc = PRTE_ERR_SILENT;
+                cd->state = PRTE_PROC_STATE_FAILED_TO_LAUNCH;
                 goto errorout;
             }
         }
-        if (!found) {
+    }
+    if (!found) {
+        if (NULL != cd->prep) {
+            cd->cmd = strdup(cd->prep->cmd);
+            cd->argv = prte_argv_copy(cd->prep->argv);
+        } else if (!xterm && NULL != prte_fork_agent) {
+            /* we were given a fork agent - use it */
+            cd->argv = prte_argv_copy(prte_fork_agent);
+            /* add in the argv from the app */
+            for (i=0; NULL != app->argv[i]; i++) {
+                prte_argv_append_nosize(&cd->argv, app->argv[i]);
+            }
+            cd->cmd = prte_path_findv(prte_fork_agent[0], X_OK, prte_launch_environ, NULL);
+            if (NULL == cd->cmd) {
+                prte_show_help("help-prte-odls-base.txt",
+                               "prte-odls-base:fork-agent-not-found",
+                               true, prte_process_info.nodename, prte_fork_agent[0]);
+                rc = PRTE_ERR_SILENT;
+                cd->state = PRTE_PROC_STATE_FAILED_TO_LAUNCH;
+                goto errorout;
+            }
+        } else {
             cd->cmd = strdup(app->app);
             cd->argv = prte_argv_copy(app->argv);
         }
-    } else if (NULL != prte_fork_agent) {
-        /* we were given a fork agent - use it */
-        cd->argv = prte_argv_copy(prte_fork_agent);
-        /* add in the argv from the app */
-        for (i=0; NULL != app->argv[i]; i++) {
-            prte_argv_append_nosize(&cd->argv, app->argv[i]);
-        }
-        cd->cmd = prte_path_findv(prte_fork_agent[0], X_OK, prte_launch_environ, NULL);
-        if (NULL == cd->cmd) {
-            prte_show_help("help-prte-odls-base.txt",
-                           "prte-odls-base:fork-agent-not-found",
-                           true, prte_process_info.nodename, prte_fork_agent[0]);
-            state = PRTE_PROC_STATE_FAILED_TO_LAUNCH;
-            goto errorout;
-        }
-    } else {
-        cd->cmd = strdup(app->app);
-        cd->argv = prte_argv_copy(app->argv);
     }
 
     /* if we are indexing the argv by rank, do so now */
@@ -1057,21 +1375,160 @@ void prte_odls_base_spawn_proc(int fd, short sd, void *cbdata)
 
     if (PRTE_SUCCESS != (rc = cd->fork_local(cd))) {
         /* error message already output */
-        state = PRTE_PROC_STATE_FAILED_TO_START;
+        cd->state = PRTE_PROC_STATE_FAILED_TO_START;
         goto errorout;
     }
+    /* the waitpid callback was registered before we had a pid */
+    prte_wait_cb_started(child);
 
-    PRTE_ACTIVATE_PROC_STATE(&child->name, PRTE_PROC_STATE_RUNNING);
-    PRTE_RELEASE(cd);
-    return;
+    cd->rc = PRTE_SUCCESS;
+    cd->state = PRTE_PROC_STATE_RUNNING;
+    return PRTE_SUCCESS;
 
   errorout:
     PRTE_FLAG_UNSET(child, PRTE_PROC_FLAG_ALIVE);
     child->exit_code = rc;
-    PRTE_ACTIVATE_PROC_STATE(&child->name, state);
+    cd->rc = rc;
+    return rc;
+}
+
+void prte_odls_base_spawn_proc(int fd, short sd, void *cbdata)
+{
+    prte_odls_spawn_caddy_t *cd = (prte_odls_spawn_caddy_t*)cbdata;
+
+    PRTE_ACQUIRE_OBJECT(cd);
+
+    spawn_child(cd);
+    PRTE_ACTIVATE_PROC_STATE(&cd->child->name, cd->state);
     PRTE_RELEASE(cd);
 }
 
+static double launch_delta(struct timeval *from, struct timeval *to)
+{
+    return (double)(to->tv_sec - from->tv_sec) +
+           (double)(to->tv_usec - from->tv_usec) / 1000000.0;
+}
+
+/* report the outcome of a batch of spawns - executes in
+ * the main event base so the state machine sees one event
+ * per batch instead of one cross-thread event per proc */
+static void report_batch(int fd, short sd, void *cbdata)
+{
+    prte_odls_spawn_batch_t *batch = (prte_odls_spawn_batch_t*)cbdata;
+    prte_odls_launch_tracker_t *trk = batch->trk;
+    prte_odls_spawn_caddy_t *cd;
+    struct timeval now;
+    int n;
+
+    PRTE_ACQUIRE_OBJECT(batch);
+
+    for (n=0; n < batch->cds.size; n++) {
+        if (NULL == (cd = (prte_odls_spawn_caddy_t*)prte_pointer_array_get_item(&batch->cds, n))) {
+            continue;
+        }
+        PRTE_ACTIVATE_PROC_STATE(&cd->child->name, cd->state);
+    }
+
+    /* the fork stage ends when the slowest worker finishes */
+    if (timercmp(&batch->forked, &trk->forked, >)) {
+        trk->forked = batch->forked;
+    }
+    --trk->nbatches;
+    if (0 == trk->nbatches && prte_odls_globals.report_timing) {
+        gettimeofday(&now, NULL);
+        prte_output(0, "%s odls:base:timing job=%s procs=%d threads=%d "
+                    "prep=%.6f fork=%.6f report=%.6f total=%.6f",
+                    PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                    PRTE_JOBID_PRINT(trk->job), trk->nprocs,
+                    prte_odls_globals.num_threads,
+                    launch_delta(&trk->start, &trk->prepped),
+                    launch_delta(&trk->prepped, &trk->forked),
+                    launch_delta(&trk->forked, &now),
+                    launch_delta(&trk->start, &now));
+    }
+    PRTE_RELEASE(batch);
+}
+
+/* spawn a batch of children - executes in an odls progress
+ * thread, and hands the results back to the main event base */
+static void spawn_batch(int fd, short sd, void *cbdata)
+{
+    prte_odls_spawn_batch_t *batch = (prte_odls_spawn_batch_t*)cbdata;
+    prte_odls_spawn_caddy_t *cd;
+    int n;
+
+    PRTE_ACQUIRE_OBJECT(batch);
+
+    for (n=0; n < batch->cds.size; n++) {
+        if (NULL == (cd = (prte_odls_spawn_caddy_t*)prte_pointer_array_get_item(&batch->cds, n))) {
+            continue;
+        }
+        spawn_child(cd);
+    }
+    if (prte_odls_globals.report_timing) {
+        gettimeofday(&batch->forked, NULL);
+    }
+
+    prte_event_set(prte_event_base, &batch->ev, -1,
+                   PRTE_EV_WRITE, report_batch, batch);
+    prte_event_set_priority(&batch->ev, PRTE_MSG_PRI);
+    PRTE_POST_OBJECT(batch);
+    prte_event_active(&batch->ev, PRTE_EV_WRITE, 1);
+}
+
+/* compute the launch items that are common to all procs
+ * of an app so the workers only need to copy them */
+static int prep_app(prte_job_t *jobdat, prte_app_context_t *app,
+                    prte_odls_app_prep_t **prepout)
+{
+    prte_odls_app_prep_t *prep;
+    char *tmp, *ptr;
+    int i;
+
+    prep = PRTE_NEW(prte_odls_app_prep_t);
+    prep->env = prte_argv_copy(prte_launch_environ);
+    if (NULL != app->env) {
+        for (i=0; NULL != app->env[i]; i++) {
+            /* find the '=' sign - strdup the env string
+             * since it is shared among apps */
+            tmp = strdup(app->env[i]);
+            ptr = strchr(tmp, '=');
+            *ptr = '\0';
+            ++ptr;
+            prte_setenv(tmp, ptr, true, &prep->env);
+            free(tmp);
+        }
+    }
+
+    prep->xterm = (NULL != prte_xterm &&
+                   !PRTE_FLAG_TEST(jobdat, PRTE_JOB_FLAG_DEBUGGER_DAEMON) &&
+                   !PRTE_FLAG_TEST(jobdat, PRTE_JOB_FLAG_TOOL));
+
+    if (!prep->xterm && NULL != prte_fork_agent) {
+        /* we were given a fork agent - use it */
+        prep->cmd = prte_path_findv(prte_fork_agent[0], X_OK, prte_launch_environ, NULL);
+        if (NULL == prep->cmd) {
+            prte_show_help("help-prte-odls-base.txt",
+                           "prte-odls-base:fork-agent-not-found",
+                           true, prte_process_info.nodename, prte_fork_agent[0]);
+            PRTE_RELEASE(prep);
+            return PRTE_ERR_SILENT;
+        }
+        prep->argv = prte_argv_copy(prte_fork_agent);
+        /* add in the argv from the app */
+        for (i=0; NULL != app->argv[i]; i++) {
+            prte_argv_append_nosize(&prep->argv, app->argv[i]);
+        }
+    } else {
+        /* ranks that aren't displayed in an xterm get the app itself */
+        prep->cmd = strdup(app->app);
+        prep->argv = prte_argv_copy(app->argv);
+    }
+
+    *prepout = prep;
+    return PRTE_SUCCESS;
+}
+
 void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
 {
     prte_app_context_t *app;
@@ -1088,6 +1545,10 @@ void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
     char *msg;
     prte_odls_spawn_caddy_t *cd;
     prte_event_base_t *evb;
+    prte_odls_app_prep_t *prep = NULL;
+    prte_odls_spawn_batch_t **batches = NULL;
+    prte_odls_launch_tracker_t *trk = NULL;
+    int nbases;
     char **argvptr;
     char *pathenv = NULL, *mpiexec_pathenv = NULL;
     char *full_search;
@@ -1188,6 +1649,18 @@ void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
         }
     }
 
+    /* the launch proceeds in stages: the items common to all procs
+     * of an app are prepared here, the procs are collected into one
+     * batch per worker thread which forks them, and each batch then
+     * reports its results back to us as a single event */
+    trk = PRTE_NEW(prte_odls_launch_tracker_t);
+    PMIX_LOAD_NSPACE(trk->job, job);
+    if (prte_odls_globals.report_timing) {
+        gettimeofday(&trk->start, NULL);
+    }
+    nbases = (0 < prte_odls_globals.num_threads) ? prte_odls_globals.num_threads : 1;
+    batches = (prte_odls_spawn_batch_t**)calloc(nbases, sizeof(prte_odls_spawn_batch_t*));
+
     for (j=0; j < jobdat->apps->size; j++) {
         if (NULL == (app = (prte_app_context_t*)prte_pointer_array_get_item(jobdat->apps, j))) {
             continue;
@@ -1355,6 +1828,22 @@ void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
             goto GETOUT;
         }
 
+        /* setup the env and cmd line that all procs of this app share */
+        if (PRTE_SUCCESS != (rc = prep_app(jobdat, app, &prep))) {
+            /* cycle through children to find those for this jobid */
+            for (idx=0; idx < prte_local_children->size; idx++) {
+                if (NULL == (child = (prte_proc_t*)prte_pointer_array_get_item(prte_local_children, idx))) {
+                    continue;
+                }
+                if (PMIX_CHECK_NSPACE(job, child->name.nspace) &&
+                    j == (int)child->app_idx) {
+                    child->exit_code = rc;
+                    PRTE_ACTIVATE_PROC_STATE(&child->name, PRTE_PROC_STATE_FAILED_TO_LAUNCH);
+                }
+            }
+            goto GETOUT;
+        }
+
         /* okay, now let's launch all the local procs for this app using the provided fork_local fn */
         for (idx=0; idx < prte_local_children->size; idx++) {
             if (NULL == (child = (prte_proc_t*)prte_pointer_array_get_item(prte_local_children, idx))) {
@@ -1421,6 +1910,8 @@ void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
             cd = PRTE_NEW(prte_odls_spawn_caddy_t);
             cd->jdata = jobdat;
             cd->app = app;
+            PRTE_RETAIN(prep);
+            cd->prep = prep;
             cd->wdir = strdup(app->cwd);
             cd->child = child;
             cd->fork_local = fork_local;
@@ -1452,20 +1943,52 @@ void prte_odls_base_default_launch_local(int fd, short sd, void *cbdata)
                     goto GETOUT;
                 }
             }
-            prte_output_verbose(1, prte_odls_base_framework.framework_output,
-                                "%s odls:dispatch %s to thread %d",
-                                PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                PRTE_NAME_PRINT(&child->name),
-                                prte_odls_globals.next_base);
-            prte_event_set(evb, &cd->ev, -1,
-                           PRTE_EV_WRITE, prte_odls_base_spawn_proc, cd);
-            prte_event_set_priority(&cd->ev, PRTE_MSG_PRI);
-            prte_event_active(&cd->ev, PRTE_EV_WRITE, 1);
-
+            /* add it to the batch for this thread */
+            if (NULL == batches[prte_odls_globals.next_base]) {
+                batches[prte_odls_globals.next_base] = PRTE_NEW(prte_odls_spawn_batch_t);
+            }
+            prte_pointer_array_add(&batches[prte_odls_globals.next_base]->cds, cd);
+            ++trk->nprocs;
         }
+        PRTE_RELEASE(prep);
+        prep = NULL;
     }
 
   GETOUT:
+    if (NULL != prep) {
+        PRTE_RELEASE(prep);
+    }
+    if (NULL != batches) {
+        /* dispatch the batches to their threads - anything we queued
+         * before hitting an error still gets launched */
+        if (prte_odls_globals.report_timing) {
+            gettimeofday(&trk->prepped, NULL);
+        }
+        for (idx=0; idx < nbases; idx++) {
+            if (NULL != batches[idx]) {
+                ++trk->nbatches;
+            }
+        }
+        for (idx=0; idx < nbases; idx++) {
+            if (NULL == batches[idx]) {
+                continue;
+            }
+            PRTE_RETAIN(trk);
+            batches[idx]->trk = trk;
+            prte_output_verbose(1, prte_odls_base_framework.framework_output,
+                                "%s odls:dispatch batch to thread %d",
+                                PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), idx);
+            prte_event_set(prte_odls_globals.ev_bases[idx], &batches[idx]->ev, -1,
+                           PRTE_EV_WRITE, spawn_batch, batches[idx]);
+            prte_event_set_priority(&batches[idx]->ev, PRTE_MSG_PRI);
+            PRTE_POST_OBJECT(batches[idx]);
+            prte_event_active(&batches[idx]->ev, PRTE_EV_WRITE, 1);
+        }
+        free(batches);
+    }
+    if (NULL != trk) {
+        PRTE_RELEASE(trk);
+    }
 
   ERROR_OUT:
     /* ensure we reset our working directory back to our default location  */
@@ -112,6 +112,15 @@ static int prte_odls_base_register(prte_mca_base_register_flag_t flags)
                                        PRTE_MCA_BASE_VAR_SCOPE_READONLY,
                                        &prte_odls_globals.cutoff);
 
+    prte_odls_globals.report_timing = false;
+    (void) prte_mca_base_var_register("prte", "odls", "base", "report_timing",
+                                       "Report the time spent in each stage (prep, fork, report) of launching local procs",
+                                       PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0,
+                                       PRTE_MCA_BASE_VAR_FLAG_NONE,
+                                       PRTE_INFO_LVL_9,
+                                       PRTE_MCA_BASE_VAR_SCOPE_READONLY,
+                                       &prte_odls_globals.report_timing);
+
     prte_odls_globals.signal_direct_children_only = false;
     (void) prte_mca_base_var_register("prte", "odls", "base", "signal_direct_children_only",
                                        "Whether to restrict signals (e.g., SIGTERM) to direct children, or "
@@ -150,6 +159,20 @@ void prte_odls_base_harvest_threads(void)
     PRTE_RELEASE_THREAD(&prte_odls_globals.lock);
 }
 
+static int num_local_cores(void)
+{
+    int ncores = 0;
+
+    if (NULL != prte_hwloc_topology) {
+        ncores = (int)prte_hwloc_base_get_nbobjs_by_type(prte_hwloc_topology,
+                                                         HWLOC_OBJ_CORE, 0);
+    }
+    if (0 >= ncores) {
+        ncores = 1;
+    }
+    return ncores;
+}
+
 void prte_odls_base_start_threads(prte_job_t *jdata)
 {
     int i;
@@ -165,7 +188,10 @@ void prte_odls_base_start_threads(prte_job_t *jdata)
     /* if we are a persistent DVM, expect to service lots
      * of clients */
     if (prte_persistent) {
-        prte_odls_globals.num_threads = prte_odls_globals.max_threads;
+        prte_odls_globals.num_threads = num_local_cores();
+        if (prte_odls_globals.max_threads < prte_odls_globals.num_threads) {
+            prte_odls_globals.num_threads = prte_odls_globals.max_threads;
+        }
         goto startup;
     }
 
@@ -177,14 +203,20 @@ void prte_odls_base_start_threads(prte_job_t *jdata)
             /* do not use any dedicated odls thread */
             prte_odls_globals.num_threads = 0;
         } else {
-            /* user didn't specify anything, so default to some fraction of
-             * the number of local procs, capping it at the max num threads
-             * parameter value. */
-            prte_odls_globals.num_threads = jdata->num_local_procs / 8;
+            /* user didn't specify anything, so default to one thread
+             * per local core - fork is limited by the kernel, so more
+             * threads than cores only adds contention. Don't start more
+             * threads than we have procs to spawn, and cap it at the
+             * max num threads parameter value. */
+            prte_odls_globals.num_threads = num_local_cores();
+            if ((int)jdata->num_local_procs < prte_odls_globals.num_threads) {
+                prte_odls_globals.num_threads = jdata->num_local_procs;
+            }
+            if (prte_odls_globals.max_threads < prte_odls_globals.num_threads) {
+                prte_odls_globals.num_threads = prte_odls_globals.max_threads;
+            }
             if (0 == prte_odls_globals.num_threads) {
                 prte_odls_globals.num_threads = 1;
-            } else if (prte_odls_globals.max_threads < prte_odls_globals.num_threads) {
-                prte_odls_globals.num_threads = prte_odls_globals.max_threads;
             }
         }
     }
@@ -354,9 +386,15 @@ static void sccon(prte_odls_spawn_caddy_t *p)
     p->wdir = NULL;
     p->argv = NULL;
     p->env = NULL;
+    p->prep = NULL;
+    p->rc = PRTE_SUCCESS;
+    p->state = PRTE_PROC_STATE_RUNNING;
 }
 static void scdes(prte_odls_spawn_caddy_t *p)
 {
+    if (NULL != p->prep) {
+        PRTE_RELEASE(p->prep);
+    }
     if (NULL != p->cmd) {
         free(p->cmd);
     }
@@ -373,3 +411,65 @@ static void scdes(prte_odls_spawn_caddy_t *p)
 PRTE_CLASS_INSTANCE(prte_odls_spawn_caddy_t,
                    prte_object_t,
                    sccon, scdes);
+
+static void apcon(prte_odls_app_prep_t *p)
+{
+    p->env = NULL;
+    p->cmd = NULL;
+    p->argv = NULL;
+    p->xterm = false;
+}
+static void apdes(prte_odls_app_prep_t *p)
+{
+    if (NULL != p->env) {
+        prte_argv_free(p->env);
+    }
+    if (NULL != p->cmd) {
+        free(p->cmd);
+    }
+    if (NULL != p->argv) {
+        prte_argv_free(p->argv);
+    }
+}
+PRTE_CLASS_INSTANCE(prte_odls_app_prep_t,
+                   prte_object_t,
+                   apcon, apdes);
+
+static void ltcon(prte_odls_launch_tracker_t *p)
+{
+    PMIX_LOAD_NSPACE(p->job, NULL);
+    p->nprocs = 0;
+    p->nbatches = 0;
+    memset(&p->start, 0, sizeof(struct timeval));
+    memset(&p->prepped, 0, sizeof(struct timeval));
+    memset(&p->forked, 0, sizeof(struct timeval));
+}
+PRTE_CLASS_INSTANCE(prte_odls_launch_tracker_t,
+                   prte_object_t,
+                   ltcon, NULL);
+
+static void sbcon(prte_odls_spawn_batch_t *p)
+{
+    PRTE_CONSTRUCT(&p->cds, prte_pointer_array_t);
+    prte_pointer_array_init(&p->cds, 8, PRTE_GLOBAL_ARRAY_MAX_SIZE, 8);
+    p->trk = NULL;
+    memset(&p->forked, 0, sizeof(struct timeval));
+}
+static void sbdes(prte_odls_spawn_batch_t *p)
+{
+    int n;
+    prte_odls_spawn_caddy_t *cd;
+
+    for (n=0; n < p->cds.size; n++) {
+        if (NULL != (cd = (prte_odls_spawn_caddy_t*)prte_pointer_array_get_item(&p->cds, n))) {
+            PRTE_RELEASE(cd);
+        }
+    }
+    PRTE_DESTRUCT(&p->cds);
+    if (NULL != p->trk) {
+        PRTE_RELEASE(p->trk);
+    }
+}
+PRTE_CLASS_INSTANCE(prte_odls_spawn_batch_t,
+                   prte_object_t,
+                   sbcon, sbdes);
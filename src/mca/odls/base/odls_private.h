@@ -35,6 +35,10 @@
 #include "prte_config.h"
 #include "types.h"
 
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+
 #include "src/class/prte_list.h"
 #include "src/class/prte_pointer_array.h"
 #include "src/class/prte_bitmap.h"
@@ -68,7 +72,11 @@ typedef struct {
     char** ev_threads;              // event progress thread names
     int next_base;                  // counter to load-level thread use
     bool signal_direct_children_only;
+    bool report_timing;
     prte_lock_t lock;
+    /* on the HNP, the catalog version given to the most recently
+     * launched job - on a daemon, the most recent version it holds */
+    uint32_t catalog_version;
 } prte_odls_globals_t;
 
 PRTE_EXPORT extern prte_odls_globals_t prte_odls_globals;
@@ -86,15 +94,35 @@ PRTE_EXPORT int
 prte_odls_base_default_construct_child_list(pmix_data_buffer_t *data,
                                             pmix_nspace_t *job);
 
+PRTE_EXPORT int
+prte_odls_base_pack_job_catalog(pmix_data_buffer_t *buffer,
+                                uint32_t lo, uint32_t hi);
+
+PRTE_EXPORT bool
+prte_odls_base_hold_launch(pmix_data_buffer_t *buffer);
+
 PRTE_EXPORT void prte_odls_base_spawn_proc(int fd, short sd, void *cbdata);
 
 /* define a function that will fork a local proc */
 typedef int (*prte_odls_base_fork_local_proc_fn_t)(void *cd);
 
+/* define an object holding the launch items that are common to
+ * all procs from a given app_context - these are computed once
+ * on the main thread and shared (read-only) by the spawn workers */
+typedef struct {
+    prte_object_t super;
+    char **env;     // launch environment merged with the app's env
+    char *cmd;      // default cmd - fork agent or the app itself
+    char **argv;    // default argv to go with the cmd
+    bool xterm;     // check each rank against the xterm list
+} prte_odls_app_prep_t;
+PRTE_CLASS_DECLARATION(prte_odls_app_prep_t);
+
 /* define an object for fork/exec the local proc */
 typedef struct {
     prte_object_t super;
     prte_event_t ev;
+    prte_odls_app_prep_t *prep;
     char *cmd;
     char *wdir;
     char **argv;
@@ -105,9 +133,36 @@ typedef struct {
     bool index_argv;
     prte_iof_base_io_conf_t opts;
     prte_odls_base_fork_local_proc_fn_t fork_local;
+    /* outcome, for reporting back to the main thread */
+    int rc;
+    prte_proc_state_t state;
 } prte_odls_spawn_caddy_t;
 PRTE_CLASS_DECLARATION(prte_odls_spawn_caddy_t);
 
+/* define an object for tracking the stages of a local launch */
+typedef struct {
+    prte_object_t super;
+    pmix_nspace_t job;
+    int nprocs;
+    int nbatches;       // number of batches yet to report
+    struct timeval start;
+    struct timeval prepped;
+    struct timeval forked;
+} prte_odls_launch_tracker_t;
+PRTE_CLASS_DECLARATION(prte_odls_launch_tracker_t);
+
+/* define an object containing the procs to be spawned by
+ * a single worker thread - the results are returned to the
+ * main thread in one event once the batch is done */
+typedef struct {
+    prte_object_t super;
+    prte_event_t ev;
+    prte_pointer_array_t cds;
+    prte_odls_launch_tracker_t *trk;
+    struct timeval forked;
+} prte_odls_spawn_batch_t;
+PRTE_CLASS_DECLARATION(prte_odls_spawn_batch_t);
+
 /* define an object for starting local launch */
 typedef struct {
     prte_object_t object;
@@ -45,6 +45,7 @@ int prte_odls_default_component_query(prte_mca_base_module_t **module, int *prio
  * ODLS Default module
  */
 extern prte_odls_base_module_t prte_odls_default_module;
+extern bool prte_odls_default_use_vfork;
 PRTE_MODULE_EXPORT extern prte_odls_base_component_t prte_odls_default_component;
 
 END_C_DECLS
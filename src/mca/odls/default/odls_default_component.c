@@ -45,6 +45,10 @@
 #include "src/mca/odls/base/odls_private.h"
 #include "src/mca/odls/default/odls_default.h"
 
+static int odls_default_register(void);
+
+bool prte_odls_default_use_vfork = false;
+
 /*
  * Instantiate the public struct with all of our public information
  * and pointers to our public functions in it
@@ -64,6 +68,7 @@ prte_odls_base_component_t prte_odls_default_component = {
         .mca_open_component = prte_odls_default_component_open,
         .mca_close_component = prte_odls_default_component_close,
         .mca_query_component = prte_odls_default_component_query,
+        .mca_register_component_params = odls_default_register,
     },
     .base_data = {
         /* The component is checkpoint ready */
@@ -72,6 +77,20 @@ prte_odls_base_component_t prte_odls_default_component = {
 };
 
 
+static int odls_default_register(void)
+{
+    prte_mca_base_component_t *c = &prte_odls_default_component.version;
+
+    prte_odls_default_use_vfork = false;
+    (void) prte_mca_base_component_var_register(c, "use_vfork",
+                                           "Launch local procs with vfork so the cost of starting each proc does not grow with the memory footprint of the daemon. Procs whose setup cannot be done safely in a vfork child (e.g., stop-on-exec or binding reports) are still launched with fork",
+                                           PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0,
+                                           PRTE_MCA_BASE_VAR_FLAG_NONE,
+                                           PRTE_INFO_LVL_9,
+                                           PRTE_MCA_BASE_VAR_SCOPE_READONLY,
+                                           &prte_odls_default_use_vfork);
+    return PRTE_SUCCESS;
+}
 
 int prte_odls_default_component_open(void)
 {
@@ -113,6 +113,15 @@
 #ifdef HAVE_SYS_PTRACE_H
 #include <sys/ptrace.h>
 #endif
+#ifdef HAVE_SCHED_H
+#include <sched.h>
+#endif
+#ifdef HAVE_SYS_SYSCALL_H
+#include <sys/syscall.h>
+#endif
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
 
 #include "src/hwloc/hwloc-internal.h"
 #include "src/hwloc/hwloc-internal.h"
@@ -121,6 +130,7 @@
 #include "src/util/show_help.h"
 #include "src/util/sys_limits.h"
 #include "src/util/fd.h"
+#include "src/util/string_copy.h"
 
 #include "src/util/show_help.h"
 #include "src/runtime/prte_wait.h"
@@ -129,6 +139,7 @@
 #include "src/mca/ess/ess.h"
 #include "src/mca/iof/base/iof_base_setup.h"
 #include "src/mca/plm/plm.h"
+#include "src/mca/rmaps/rmaps_types.h"
 #include "src/mca/rtc/rtc.h"
 #include "src/util/name_fns.h"
 #include "src/threads/threads.h"
@@ -606,6 +617,352 @@ static int do_parent(prte_odls_spawn_caddy_t *cd, int read_fd)
 }
 
 
+#if defined(HAVE_VFORK) && defined(HAVE_SCHED_SETAFFINITY) && defined(CPU_SETSIZE)
+/*
+ * vfork-based launch
+ *
+ * The child shares our address space until it exec's, so launching
+ * does not require copying the daemon's page tables - the cost per
+ * proc therefore doesn't grow with the amount of job data the daemon
+ * is holding. The price is that the child may only make async-signal-safe
+ * calls and must not touch our memory other than to report where it
+ * failed. Everything that requires more than that (rendering error
+ * messages, computing the binding) is done here in the parent, and
+ * procs that need child-side work we cannot do safely fall back to
+ * the regular fork path.
+ */
+#define PRTE_ODLS_VFORK_OK      0
+#define PRTE_ODLS_VFORK_IOF     1
+#define PRTE_ODLS_VFORK_BIND    2
+#define PRTE_ODLS_VFORK_WDIR    3
+#define PRTE_ODLS_VFORK_EXEC    4
+#define PRTE_ODLS_VFORK_FDS     5
+
+typedef struct {
+    int stage;
+    int error;
+    int bind_error;
+} odls_vfork_status_t;
+
+typedef struct {
+    bool bind;
+    bool report;
+    bool required;
+    cpu_set_t mask;
+    char *cpus;
+} odls_vfork_binding_t;
+
+/* -1 => not yet checked, 0 => unavailable, 1 => available */
+static int vfork_close_range = -1;
+
+static void vfork_child(prte_odls_spawn_caddy_t *cd,
+                        volatile odls_vfork_status_t *st,
+                        odls_vfork_binding_t *bnd)
+    __prte_attribute_noreturn__;
+
+/* determine if this proc can be launched via vfork and, if
+ * so, compute its binding */
+static bool vfork_prep(prte_odls_spawn_caddy_t *cd, odls_vfork_binding_t *bnd)
+{
+    hwloc_cpuset_t cpuset;
+    hwloc_obj_t root;
+    prte_hwloc_topo_data_t *sum;
+    char *cpu_bitmap = NULL;
+    int cpu;
+    bool ret = true;
+
+    memset(bnd, 0, sizeof(odls_vfork_binding_t));
+
+    /* the child has no cheap, async-signal-safe way of closing
+     * its inherited fds without close_range, so let the fork
+     * path handle it when the kernel doesn't support it. Closing
+     * an fd that cannot be open is harmless and tells us if the
+     * call exists */
+    if (0 > vfork_close_range) {
+#if defined(SYS_close_range)
+        vfork_close_range = (0 == syscall(SYS_close_range, ~0U, ~0U, 0)) ? 1 : 0;
+#else
+        vfork_close_range = 0;
+#endif
+    }
+    if (0 == vfork_close_range) {
+        return false;
+    }
+
+#if PRTE_HAVE_STOP_ON_EXEC
+    if (prte_get_attribute(&cd->jdata->attributes, PRTE_JOB_STOP_ON_EXEC, NULL, PMIX_BOOL)) {
+        return false;
+    }
+#endif
+    if (NULL == cd->child) {
+        /* no binding to be done */
+        return true;
+    }
+    /* memory binding and binding reports both have to be
+     * done by the child itself */
+    if (PRTE_HWLOC_BASE_MAP_NONE != prte_hwloc_base_map ||
+        NULL == cd->jdata->map ||
+        prte_get_attribute(&cd->jdata->attributes, PRTE_JOB_REPORT_BINDINGS, NULL, PMIX_BOOL)) {
+        return false;
+    }
+
+    if (prte_get_attribute(&cd->child->attributes, PRTE_PROC_CPU_BITMAP,
+                           (void**)&cpu_bitmap, PMIX_STRING) &&
+        NULL != cpu_bitmap && 0 < strlen(cpu_bitmap)) {
+        cpuset = hwloc_bitmap_alloc();
+        if (0 != hwloc_bitmap_list_sscanf(cpuset, cpu_bitmap)) {
+            /* let the fork path report it */
+            hwloc_bitmap_free(cpuset);
+            free(cpu_bitmap);
+            return false;
+        }
+        bnd->cpus = cpu_bitmap;
+    } else {
+        if (NULL != cpu_bitmap) {
+            free(cpu_bitmap);
+        }
+        if (NULL == prte_daemon_cores) {
+            /* nothing to bind */
+            return true;
+        }
+        /* the daemon is bound, so we need to "free" this proc */
+        root = hwloc_get_root_obj(prte_hwloc_topology);
+        if (NULL == root->userdata) {
+            return false;
+        }
+        sum = (prte_hwloc_topo_data_t*)root->userdata;
+        cpuset = hwloc_bitmap_dup(sum->available);
+        (void)hwloc_bitmap_list_asprintf(&bnd->cpus, cpuset);
+    }
+
+    CPU_ZERO(&bnd->mask);
+    hwloc_bitmap_foreach_begin(cpu, cpuset) {
+        if (CPU_SETSIZE <= cpu) {
+            ret = false;
+            break;
+        }
+        CPU_SET(cpu, &bnd->mask);
+    } hwloc_bitmap_foreach_end();
+    hwloc_bitmap_free(cpuset);
+    if (!ret) {
+        free(bnd->cpus);
+        bnd->cpus = NULL;
+        return false;
+    }
+
+    bnd->bind = true;
+    bnd->report = PRTE_BINDING_POLICY_IS_SET(cd->jdata->map->binding);
+    bnd->required = bnd->report && PRTE_BINDING_REQUIRED(cd->jdata->map->binding);
+    return true;
+}
+
+static int vfork_close_fds(void)
+{
+#if defined(SYS_close_range)
+    return syscall(SYS_close_range, 3, ~0U, 0);
+#else
+    errno = ENOSYS;
+    return -1;
+#endif
+}
+
+/* NOTE: only async-signal-safe calls in here */
+static void vfork_child(prte_odls_spawn_caddy_t *cd,
+                        volatile odls_vfork_status_t *st,
+                        odls_vfork_binding_t *bnd)
+{
+    int i, fdnull;
+    sigset_t sigs;
+
+#if HAVE_SETPGID
+    /* Set a new process group for this child, so that any
+     * signals we send to it will reach any children it spawns */
+    setpgid(0, 0);
+#endif
+
+    if (NULL != cd->child) {
+        if (PRTE_FLAG_TEST(cd->jdata, PRTE_JOB_FLAG_FORWARD_OUTPUT)) {
+            if (PRTE_SUCCESS != prte_iof_base_setup_child(&cd->opts, &cd->env)) {
+                st->error = errno;
+                st->stage = PRTE_ODLS_VFORK_IOF;
+                _exit(1);
+            }
+        }
+        if (bnd->bind && 0 != sched_setaffinity(0, sizeof(cpu_set_t), &bnd->mask)) {
+            st->bind_error = errno;
+            if (bnd->required) {
+                st->error = errno;
+                st->stage = PRTE_ODLS_VFORK_BIND;
+                _exit(1);
+            }
+        }
+    } else if (!PRTE_FLAG_TEST(cd->jdata, PRTE_JOB_FLAG_FORWARD_OUTPUT)) {
+        /* tie stdin/out/err/internal to /dev/null */
+        for (i=0; i < 3; i++) {
+            fdnull = open("/dev/null", O_RDONLY, 0);
+            if (fdnull > i) {
+                dup2(fdnull, i);
+            }
+            close(fdnull);
+        }
+    }
+
+    if (0 != vfork_close_fds()) {
+        st->error = errno;
+        st->stage = PRTE_ODLS_VFORK_FDS;
+        _exit(1);
+    }
+
+    /* restore the default handlers and unblock everything - the
+     * parent blocked all signals before we were created so that
+     * none of its handlers can run in here */
+    set_handler_default(SIGTERM);
+    set_handler_default(SIGINT);
+    set_handler_default(SIGHUP);
+    set_handler_default(SIGPIPE);
+    set_handler_default(SIGCHLD);
+    set_handler_default(SIGTRAP);
+    sigemptyset(&sigs);
+    sigprocmask(SIG_SETMASK, &sigs, 0);
+
+    /* take us to the correct wdir */
+    if (NULL != cd->wdir && 0 != chdir(cd->wdir)) {
+        st->error = errno;
+        st->stage = PRTE_ODLS_VFORK_WDIR;
+        _exit(1);
+    }
+
+    execve(cd->cmd, cd->argv, cd->env);
+    st->error = errno;
+    st->stage = PRTE_ODLS_VFORK_EXEC;
+    _exit(1);
+}
+
+static int odls_default_vfork_local_proc(prte_odls_spawn_caddy_t *cd,
+                                         odls_vfork_binding_t *bnd)
+{
+    volatile odls_vfork_status_t st;
+    sigset_t all, old;
+    pid_t pid;
+    prte_proc_t *child = cd->child;
+    char dir[MAXPATHLEN], *msg;
+    struct stat stats;
+
+    st.stage = PRTE_ODLS_VFORK_OK;
+    st.error = 0;
+    st.bind_error = 0;
+
+    /* the child cannot allocate memory */
+    if (NULL == cd->argv) {
+        cd->argv = malloc(sizeof(char*)*2);
+        cd->argv[0] = strdup(cd->app->app);
+        cd->argv[1] = NULL;
+    }
+
+    /* block all signals so none of our handlers can execute in
+     * the child while it is using our address space */
+    sigfillset(&all);
+    pthread_sigmask(SIG_BLOCK, &all, &old);
+
+    pid = vfork();
+    if (0 == pid) {
+        vfork_child(cd, &st, bnd);
+        /* Does not return */
+    }
+    pthread_sigmask(SIG_SETMASK, &old, NULL);
+
+    if (NULL != child) {
+        child->pid = pid;
+    }
+    if (pid < 0) {
+        PRTE_ERROR_LOG(PRTE_ERR_SYS_LIMITS_CHILDREN);
+        if (NULL != child) {
+            child->state = PRTE_PROC_STATE_FAILED_TO_START;
+            child->exit_code = PRTE_ERR_SYS_LIMITS_CHILDREN;
+        }
+        return PRTE_ERR_SYS_LIMITS_CHILDREN;
+    }
+
+    /* by the time we get here, the child has either exec'd
+     * or failed - close our copies of its ends of the pipes */
+    if (cd->opts.connect_stdin) {
+        close(cd->opts.p_stdin[0]);
+    }
+    close(cd->opts.p_stdout[1]);
+    if( !prte_iof_base.redirect_app_stderr_to_stdout ) {
+        close(cd->opts.p_stderr[1]);
+    }
+
+    /* report any problems the child had */
+    if (0 != st.bind_error && bnd->report) {
+        if (ENOSYS == st.bind_error) {
+            msg = strdup("cpu binding not supported");
+        } else {
+            asprintf(&msg, "sched_setaffinity returned \"%s\" for bitmap \"%s\"",
+                     strerror(st.bind_error), bnd->cpus);
+        }
+        if (PRTE_ODLS_VFORK_BIND == st.stage) {
+            prte_show_help("help-prte-odls-default.txt", "binding generic error", true,
+                           prte_process_info.nodename, cd->app->app, msg,
+                           __FILE__, __LINE__);
+        } else {
+            prte_show_help("help-prte-odls-default.txt", "not bound", true,
+                           prte_process_info.nodename, cd->app->app, msg,
+                           __FILE__, __LINE__);
+        }
+        free(msg);
+    }
+
+    switch (st.stage) {
+    case PRTE_ODLS_VFORK_OK:
+        if (NULL != child) {
+            child->state = PRTE_PROC_STATE_RUNNING;
+            PRTE_FLAG_SET(child, PRTE_PROC_FLAG_ALIVE);
+        }
+        return PRTE_SUCCESS;
+
+    case PRTE_ODLS_VFORK_IOF:
+        prte_show_help("help-prte-odls-default.txt", "iof setup failed", true,
+                       prte_process_info.nodename, cd->app->app);
+        break;
+
+    case PRTE_ODLS_VFORK_WDIR:
+        prte_show_help("help-prun.txt", "prun:wdir-not-found", true,
+                       "prted", cd->wdir, prte_process_info.nodename,
+                       (NULL == child) ? 0 : child->app_rank);
+        break;
+
+    case PRTE_ODLS_VFORK_EXEC:
+        if (NULL != cd->wdir) {
+            prte_string_copy(dir, cd->wdir, sizeof(dir));
+        } else if (NULL == getcwd(dir, sizeof(dir))) {
+            dir[0] = '\0';
+        }
+        /* If errno is ENOENT, that indicates either cd->cmd does not exist, or
+         * cd->cmd is a script, but has a bad interpreter specified. */
+        if (ENOENT == st.error && 0 == stat(cd->app->app, &stats)) {
+            asprintf(&msg, "%s has a bad interpreter on the first line.",
+                     cd->app->app);
+        } else {
+            msg = strdup(strerror(st.error));
+        }
+        prte_show_help("help-prte-odls-default.txt", "execve error", true,
+                       prte_process_info.nodename, dir, cd->app->app, msg);
+        free(msg);
+        break;
+
+    default:
+        break;
+    }
+
+    if (NULL != child) {
+        child->state = PRTE_PROC_STATE_FAILED_TO_START;
+        PRTE_FLAG_UNSET(child, PRTE_PROC_FLAG_ALIVE);
+    }
+    return PRTE_ERR_FAILED_TO_START;
+}
+#endif
+
 /**
  *  Fork/exec the specified processes
  */
@@ -615,6 +972,17 @@ static int odls_default_fork_local_proc(void *cdptr)
     int p[2];
     pid_t pid;
     prte_proc_t *child = cd->child;
+#if defined(HAVE_VFORK) && defined(HAVE_SCHED_SETAFFINITY) && defined(CPU_SETSIZE)
+    odls_vfork_binding_t bnd;
+
+    if (prte_odls_default_use_vfork && vfork_prep(cd, &bnd)) {
+        int rc = odls_default_vfork_local_proc(cd, &bnd);
+        if (NULL != bnd.cpus) {
+            free(bnd.cpus);
+        }
+        return rc;
+    }
+#endif
 
     /* A pipe is used to communicate between the parent and child to
        indicate whether the exec ultimately succeeded or failed.  The
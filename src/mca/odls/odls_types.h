@@ -92,6 +92,9 @@ typedef uint8_t prte_daemon_cmd_flag_t;
 /* tell DVM daemons to cleanup resources from job */
 #define PRTE_DAEMON_DVM_CLEANUP_JOB_CMD     (prte_daemon_cmd_flag_t) 34
 
+/* request the jobs launched while a daemon was absent */
+#define PRTE_DAEMON_JOB_CATALOG_CMD         (prte_daemon_cmd_flag_t) 35
+
 /*
  * Struct written up the pipe from the child to the parent.
  */
@@ -245,6 +245,15 @@ static int tcp_component_register(void)
                                           PRTE_MCA_BASE_VAR_SCOPE_LOCAL,
                                           &prte_oob_tcp_component.tcp_sndbuf);
 
+    prte_oob_tcp_component.compact_hdr = true;
+    (void)prte_mca_base_component_var_register(component, "compact_hdr",
+                                          "Offer to exchange compact message headers with peers in the same DVM (default: true)",
+                                          PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0,
+                                          PRTE_MCA_BASE_VAR_FLAG_NONE,
+                                          PRTE_INFO_LVL_5,
+                                          PRTE_MCA_BASE_VAR_SCOPE_LOCAL,
+                                          &prte_oob_tcp_component.compact_hdr);
+
     prte_oob_tcp_component.tcp_rcvbuf = 0;
     (void)prte_mca_base_component_var_register(component, "rcvbuf",
                                           "TCP socket receive buffering size (in bytes, 0 => leave system default)",
@@ -1306,6 +1315,7 @@ static void peer_cons(prte_oob_tcp_peer_t *peer)
     peer->active_addr = NULL;
     peer->state = MCA_OOB_TCP_UNCONNECTED;
     peer->num_retries = 0;
+    peer->compact_hdr = false;
     PRTE_CONSTRUCT(&peer->send_queue, prte_list_t);
     peer->send_msg = NULL;
     peer->recv_msg = NULL;
@@ -89,6 +89,7 @@ typedef struct {
     int                keepalive_intvl;        /**< time between keepalives, in seconds */
     int                retry_delay;            /**< time to wait before retrying connection */
     int                max_recon_attempts;     /**< maximum number of times to attempt connect before giving up (-1 for never) */
+    bool               compact_hdr;            /**< offer the compact message header to peers */
 } prte_oob_tcp_component_t;
 
 PRTE_MODULE_EXPORT extern prte_oob_tcp_component_t prte_oob_tcp_component;
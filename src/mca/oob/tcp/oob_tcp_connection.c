@@ -515,6 +515,7 @@ static int tcp_peer_send_connect_ack(prte_oob_tcp_peer_t* peer)
     char *msg;
     prte_oob_tcp_hdr_t hdr;
     uint16_t ack_flag = htons(1);
+    uint8_t caps = 0;
     size_t sdsize, offset = 0;
 
     prte_output_verbose(OOB_TCP_DEBUG_CONNECT, prte_oob_base_framework.framework_output,
@@ -528,8 +529,13 @@ static int tcp_peer_send_connect_ack(prte_oob_tcp_peer_t* peer)
     hdr.seq_num = 0;
     memset(hdr.routed, 0, PRTE_MAX_RTD_SIZE+1);
 
+    /* advertise what we are willing to do on this connection */
+    if (prte_oob_tcp_component.compact_hdr) {
+        caps |= PRTE_OOB_TCP_CAP_COMPACT_HDR;
+    }
+
     /* payload size */
-    sdsize = sizeof(ack_flag) + strlen(prte_version_string) + 1;
+    sdsize = sizeof(ack_flag) + strlen(prte_version_string) + 1 + sizeof(caps);
     hdr.nbytes = sdsize;
     MCA_OOB_TCP_HDR_HTON(&hdr);
 
@@ -547,6 +553,8 @@ static int tcp_peer_send_connect_ack(prte_oob_tcp_peer_t* peer)
     offset += sizeof(ack_flag);
     memcpy(msg + offset, prte_version_string, strlen(prte_version_string) + 1);
     offset += strlen(prte_version_string)+1;
+    memcpy(msg + offset, &caps, sizeof(caps));
+    offset += sizeof(caps);
 
     /* send it */
     if (PRTE_SUCCESS != tcp_peer_send_blocking(peer->sd, msg, sdsize)) {
@@ -835,6 +843,7 @@ int prte_oob_tcp_peer_recv_connect_ack(prte_oob_tcp_peer_t* pr,
     prte_oob_tcp_hdr_t hdr;
     prte_oob_tcp_peer_t *peer;
     uint16_t ack_flag;
+    uint8_t caps = 0;
     bool is_new = (NULL == pr);
 
     prte_output_verbose(OOB_TCP_DEBUG_CONNECT, prte_oob_base_framework.framework_output,
@@ -1022,12 +1031,26 @@ int prte_oob_tcp_peer_recv_connect_ack(prte_oob_tcp_peer_t* pr,
         free(msg);
         return PRTE_ERR_CONNECTION_REFUSED;
     }
+
+    /* anything beyond the version string is the peer's capability
+     * flags - a peer that doesn't provide them gets the full header */
+    if (offset < hdr.nbytes) {
+        memcpy(&caps, msg + offset, sizeof(caps));
+        offset += sizeof(caps);
+    }
     free(msg);
 
+    /* the compact header refers to our common nspace by index,
+     * so it can only be used with peers in our own job */
+    peer->compact_hdr = (prte_oob_tcp_component.compact_hdr &&
+                         (PRTE_OOB_TCP_CAP_COMPACT_HDR & caps) &&
+                         PMIX_CHECK_NSPACE(peer->name.nspace, PRTE_PROC_MY_NAME->nspace));
+
     prte_output_verbose(OOB_TCP_DEBUG_CONNECT, prte_oob_base_framework.framework_output,
-                        "%s connect-ack version from %s matches ours",
+                        "%s connect-ack version from %s matches ours - %s header",
                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                        PRTE_NAME_PRINT(&peer->name));
+                        PRTE_NAME_PRINT(&peer->name),
+                        peer->compact_hdr ? "compact" : "full");
 
     /* if the requestor wanted the header returned, then they
      * will complete their processing
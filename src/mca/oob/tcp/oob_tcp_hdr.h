@@ -68,6 +68,46 @@ typedef struct {
     /* routed module to be used */
     char routed[PRTE_MAX_RTD_SIZE+1];
 } prte_oob_tcp_hdr_t;
+
+/* capabilities advertised in the IDENT handshake */
+#define PRTE_OOB_TCP_CAP_COMPACT_HDR  0x01
+
+/* job index values used in the compact header. Peers that
+ * negotiate the compact header must belong to the same DVM,
+ * so index 0 always refers to our common daemon nspace. Any
+ * other nspace is carried explicitly in an extension that
+ * immediately follows the compact header on the wire */
+#define PRTE_OOB_TCP_JOB_LOCAL      0
+#define PRTE_OOB_TCP_JOB_EXPLICIT   0xff
+
+/* compact header for tcp msgs - used in place of the full
+ * header once both sides have negotiated it during the
+ * IDENT handshake */
+typedef struct {
+    uint32_t origin_rank;
+    uint32_t dst_rank;
+    prte_rml_tag_t tag;
+    uint32_t seq_num;
+    uint32_t nbytes;
+    prte_oob_tcp_msg_type_t type;
+    uint8_t origin_job;
+    uint8_t dst_job;
+    uint8_t pad;
+} prte_oob_tcp_chdr_t;
+
+/* wire image of a compact header plus the nspaces for
+ * any job index marked as explicit */
+typedef struct {
+    prte_oob_tcp_chdr_t hdr;
+    pmix_nspace_t nspace[2];
+} prte_oob_tcp_chdr_ext_t;
+
+/* number of bytes on the wire for a given compact header */
+#define MCA_OOB_TCP_CHDR_SIZE(h)                                        \
+    (sizeof(prte_oob_tcp_chdr_t) +                                      \
+     ((PRTE_OOB_TCP_JOB_EXPLICIT == (h)->origin_job) ? sizeof(pmix_nspace_t) : 0) + \
+     ((PRTE_OOB_TCP_JOB_EXPLICIT == (h)->dst_job) ? sizeof(pmix_nspace_t) : 0))
+
 /**
  * Convert the message header to host byte order
  */
@@ -86,4 +126,18 @@ typedef struct {
     (h)->tag = PRTE_RML_TAG_HTON((h)->tag);     \
     (h)->nbytes = htonl((h)->nbytes);
 
+/**
+ * Encode a full header (in network byte order) into its compact
+ * wire image. Returns the number of bytes to be sent.
+ */
+PRTE_MODULE_EXPORT size_t prte_oob_tcp_hdr_compact(const prte_oob_tcp_hdr_t *hdr,
+                                                  prte_oob_tcp_chdr_ext_t *chdr);
+
+/**
+ * Expand a received compact header back into a full header,
+ * leaving it in network byte order
+ */
+PRTE_MODULE_EXPORT void prte_oob_tcp_hdr_expand(const prte_oob_tcp_chdr_ext_t *chdr,
+                                               prte_oob_tcp_hdr_t *hdr);
+
 #endif /* _MCA_OOB_TCP_HDR_H_ */
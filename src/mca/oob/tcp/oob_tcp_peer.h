@@ -58,6 +58,7 @@ typedef struct {
     prte_oob_tcp_addr_t *active_addr;
     prte_oob_tcp_state_t state;
     int num_retries;
+    bool compact_hdr;           /**< peer negotiated the compact header */
     prte_event_t send_event;    /**< registration with event thread for send events */
     bool send_ev_active;
     prte_event_t recv_event;    /**< registration with event thread for recv events */
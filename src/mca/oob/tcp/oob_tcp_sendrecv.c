@@ -111,11 +111,84 @@ void prte_oob_tcp_queue_msg(int sd, short args, void *cbdata)
     }
 }
 
+size_t prte_oob_tcp_hdr_compact(const prte_oob_tcp_hdr_t *hdr,
+                                prte_oob_tcp_chdr_ext_t *chdr)
+{
+    int n = 0;
+
+    /* the numeric fields are already in network byte order */
+    chdr->hdr.origin_rank = hdr->origin.rank;
+    chdr->hdr.dst_rank = hdr->dst.rank;
+    chdr->hdr.tag = hdr->tag;
+    chdr->hdr.seq_num = hdr->seq_num;
+    chdr->hdr.nbytes = hdr->nbytes;
+    chdr->hdr.type = hdr->type;
+    chdr->hdr.pad = 0;
+
+    /* any nspace other than our own has to be sent along -
+     * they are packed in origin, dst order */
+    if (!PMIX_NSPACE_INVALID(hdr->origin.nspace) &&
+        PMIX_CHECK_NSPACE(hdr->origin.nspace, PRTE_PROC_MY_NAME->nspace)) {
+        chdr->hdr.origin_job = PRTE_OOB_TCP_JOB_LOCAL;
+    } else {
+        chdr->hdr.origin_job = PRTE_OOB_TCP_JOB_EXPLICIT;
+        PMIX_LOAD_NSPACE(chdr->nspace[n], hdr->origin.nspace);
+        ++n;
+    }
+    if (!PMIX_NSPACE_INVALID(hdr->dst.nspace) &&
+        PMIX_CHECK_NSPACE(hdr->dst.nspace, PRTE_PROC_MY_NAME->nspace)) {
+        chdr->hdr.dst_job = PRTE_OOB_TCP_JOB_LOCAL;
+    } else {
+        chdr->hdr.dst_job = PRTE_OOB_TCP_JOB_EXPLICIT;
+        PMIX_LOAD_NSPACE(chdr->nspace[n], hdr->dst.nspace);
+        ++n;
+    }
+
+    return MCA_OOB_TCP_CHDR_SIZE(&chdr->hdr);
+}
+
+void prte_oob_tcp_hdr_expand(const prte_oob_tcp_chdr_ext_t *chdr,
+                             prte_oob_tcp_hdr_t *hdr)
+{
+    int n = 0;
+
+    memset(hdr, 0, sizeof(prte_oob_tcp_hdr_t));
+    if (PRTE_OOB_TCP_JOB_EXPLICIT == chdr->hdr.origin_job) {
+        PMIX_LOAD_NSPACE(hdr->origin.nspace, chdr->nspace[n]);
+        ++n;
+    } else {
+        PMIX_LOAD_NSPACE(hdr->origin.nspace, PRTE_PROC_MY_NAME->nspace);
+    }
+    if (PRTE_OOB_TCP_JOB_EXPLICIT == chdr->hdr.dst_job) {
+        PMIX_LOAD_NSPACE(hdr->dst.nspace, chdr->nspace[n]);
+        ++n;
+    } else {
+        PMIX_LOAD_NSPACE(hdr->dst.nspace, PRTE_PROC_MY_NAME->nspace);
+    }
+    hdr->origin.rank = chdr->hdr.origin_rank;
+    hdr->dst.rank = chdr->hdr.dst_rank;
+    hdr->tag = chdr->hdr.tag;
+    hdr->seq_num = chdr->hdr.seq_num;
+    hdr->nbytes = chdr->hdr.nbytes;
+    hdr->type = chdr->hdr.type;
+}
+
 static int send_msg(prte_oob_tcp_peer_t* peer, prte_oob_tcp_send_t* msg)
 {
     struct iovec iov[2];
     int iov_count, retries = 0;
-    ssize_t remain = msg->sdbytes, rc;
+    ssize_t remain, rc;
+
+    /* the header format depends on what was negotiated with the
+     * peer, which may not have been known when the msg was queued */
+    if (!msg->hdr_sent && !msg->hdr_encoded) {
+        msg->hdr_encoded = true;
+        if (peer->compact_hdr) {
+            msg->sdbytes = prte_oob_tcp_hdr_compact(&msg->hdr, &msg->chdr);
+            msg->sdptr = (char*)&msg->chdr;
+        }
+    }
+    remain = msg->sdbytes;
 
     iov[0].iov_base = msg->sdptr;
     iov[0].iov_len = msg->sdbytes;
@@ -383,6 +456,35 @@ static int read_bytes(prte_oob_tcp_peer_t* peer)
     return PRTE_SUCCESS;
 }
 
+/* read the message header - a compact header may be followed
+ * by the nspaces it could not express by index */
+static int read_hdr(prte_oob_tcp_peer_t* peer)
+{
+    prte_oob_tcp_recv_t *rcv = peer->recv_msg;
+    size_t ext;
+    int rc;
+
+    if (PRTE_SUCCESS != (rc = read_bytes(peer))) {
+        return rc;
+    }
+    if (!peer->compact_hdr) {
+        return PRTE_SUCCESS;
+    }
+    if (!rcv->chdr_recvd) {
+        rcv->chdr_recvd = true;
+        ext = MCA_OOB_TCP_CHDR_SIZE(&rcv->chdr.hdr) - sizeof(prte_oob_tcp_chdr_t);
+        if (0 < ext) {
+            rcv->rdptr = (char*)rcv->chdr.nspace;
+            rcv->rdbytes = ext;
+            if (PRTE_SUCCESS != (rc = read_bytes(peer))) {
+                return rc;
+            }
+        }
+    }
+    prte_oob_tcp_hdr_expand(&rcv->chdr, &rcv->hdr);
+    return PRTE_SUCCESS;
+}
+
 /*
  * Dispatch to the appropriate action routine based on the state
  * of the connection with the peer.
@@ -459,15 +561,20 @@ void prte_oob_tcp_recv_handler(int sd, short flags, void *cbdata)
                 return;
             }
             /* start by reading the header */
-            peer->recv_msg->rdptr = (char*)&peer->recv_msg->hdr;
-            peer->recv_msg->rdbytes = sizeof(prte_oob_tcp_hdr_t);
+            if (peer->compact_hdr) {
+                peer->recv_msg->rdptr = (char*)&peer->recv_msg->chdr.hdr;
+                peer->recv_msg->rdbytes = sizeof(prte_oob_tcp_chdr_t);
+            } else {
+                peer->recv_msg->rdptr = (char*)&peer->recv_msg->hdr;
+                peer->recv_msg->rdbytes = sizeof(prte_oob_tcp_hdr_t);
+            }
         }
         /* if the header hasn't been completely read, read it */
         if (!peer->recv_msg->hdr_recvd) {
             prte_output_verbose(OOB_TCP_DEBUG_CONNECT, prte_oob_base_framework.framework_output,
                                 "%s:tcp:recv:handler read hdr",
                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME));
-            if (PRTE_SUCCESS == (rc = read_bytes(peer))) {
+            if (PRTE_SUCCESS == (rc = read_hdr(peer))) {
                 /* completed reading the header */
                 peer->recv_msg->hdr_recvd = true;
                 /* convert the header */
@@ -590,6 +697,7 @@ void prte_oob_tcp_recv_handler(int sd, short flags, void *cbdata)
 static void snd_cons(prte_oob_tcp_send_t *ptr)
 {
     memset(&ptr->hdr, 0, sizeof(prte_oob_tcp_hdr_t));
+    ptr->hdr_encoded = false;
     ptr->msg = NULL;
     ptr->data = NULL;
     ptr->hdr_sent = false;
@@ -616,6 +724,7 @@ PRTE_CLASS_INSTANCE(prte_oob_tcp_send_t,
 static void rcv_cons(prte_oob_tcp_recv_t *ptr)
 {
     memset(&ptr->hdr, 0, sizeof(prte_oob_tcp_hdr_t));
+    ptr->chdr_recvd = false;
     ptr->hdr_recvd = false;
     ptr->rdptr = NULL;
     ptr->rdbytes = 0;
@@ -46,6 +46,8 @@ typedef struct {
     struct prte_oob_tcp_peer_t *peer;
     bool activate;
     prte_oob_tcp_hdr_t hdr;
+    prte_oob_tcp_chdr_ext_t chdr;
+    bool hdr_encoded;
     prte_rml_send_t *msg;
     char *data;
     bool hdr_sent;
@@ -59,6 +61,8 @@ PRTE_CLASS_DECLARATION(prte_oob_tcp_send_t);
 typedef struct {
     prte_list_item_t super;
     prte_oob_tcp_hdr_t hdr;
+    prte_oob_tcp_chdr_ext_t chdr;
+    bool chdr_recvd;
     bool hdr_recvd;
     char *data;
     char *rdptr;
@@ -67,6 +67,16 @@ static int mca_plm_base_register(prte_mca_base_register_flag_t flags)
                                                   PRTE_MCA_BASE_VAR_SCOPE_READONLY,
                                                   &prte_plm_globals.node_regex_threshold);
 
+    prte_plm_globals.report_startup_timing = false;
+    (void) prte_mca_base_framework_var_register (&prte_plm_base_framework, "report_startup_timing",
+                                                  "Report the time spent in each phase of DVM startup (daemon launch, "
+                                                  "daemon callback, topology collection, VM ready)",
+                                                  PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0,
+                                                  PRTE_MCA_BASE_VAR_FLAG_NONE,
+                                                  PRTE_INFO_LVL_9,
+                                                  PRTE_MCA_BASE_VAR_SCOPE_READONLY,
+                                                  &prte_plm_globals.report_startup_timing);
+
     /* Note that we break abstraction rules here by listing a
      specific PLM here in the base.  This is necessary, however,
      due to extraordinary circumstances:
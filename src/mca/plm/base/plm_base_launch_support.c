@@ -115,6 +115,58 @@ void prte_plm_base_set_slots(prte_node_t *node)
     PRTE_FLAG_SET(node, PRTE_NODE_FLAG_SLOTS_GIVEN);
 }
 
+static prte_job_t *jdatorted=NULL;
+
+/* startup phase timing - most phases are stamped when first reached,
+ * but those that complete with the last daemon are stamped each time */
+static bool startup_reported = false;
+
+static void mark_phase(prte_plm_phase_t phase, bool latest)
+{
+    struct timeval *tv = &prte_plm_globals.phases[phase];
+
+    if (latest || (0 == tv->tv_sec && 0 == tv->tv_usec)) {
+        gettimeofday(tv, NULL);
+    }
+}
+
+static double phase_delta(prte_plm_phase_t from, prte_plm_phase_t to)
+{
+    struct timeval *a = &prte_plm_globals.phases[from];
+    struct timeval *b = &prte_plm_globals.phases[to];
+
+    if ((0 == a->tv_sec && 0 == a->tv_usec) ||
+        (0 == b->tv_sec && 0 == b->tv_usec)) {
+        return 0.0;
+    }
+    return (double)(b->tv_sec - a->tv_sec) + (double)(b->tv_usec - a->tv_usec) / 1000000.0;
+}
+
+static void report_startup_phases(void)
+{
+    struct timeval *start = &prte_plm_globals.phases[PRTE_PLM_PHASE_LAUNCH_START];
+    int verbosity = prte_plm_globals.report_startup_timing ? 0 : 1;
+
+    startup_reported = true;
+    if (0 == start->tv_sec && 0 == start->tv_usec) {
+        /* no daemons were launched */
+        return;
+    }
+    mark_phase(PRTE_PLM_PHASE_VM_READY, false);
+
+    prte_output_verbose(verbosity, prte_plm_base_framework.framework_output,
+                        "%s plm:base:startup %d daemons: launch %.3f sec, first callback %.3f sec, "
+                        "all callbacks %.3f sec, topology fetch %.3f sec, vm ready %.3f sec, total %.3f sec",
+                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                        (NULL == jdatorted) ? 0 : (int)jdatorted->num_procs,
+                        phase_delta(PRTE_PLM_PHASE_LAUNCH_START, PRTE_PLM_PHASE_DAEMONS_LAUNCHED),
+                        phase_delta(PRTE_PLM_PHASE_LAUNCH_START, PRTE_PLM_PHASE_FIRST_CALLBACK),
+                        phase_delta(PRTE_PLM_PHASE_LAUNCH_START, PRTE_PLM_PHASE_DAEMONS_REPORTED),
+                        phase_delta(PRTE_PLM_PHASE_TOPO_REQUESTED, PRTE_PLM_PHASE_TOPO_RECEIVED),
+                        phase_delta(PRTE_PLM_PHASE_DAEMONS_REPORTED, PRTE_PLM_PHASE_VM_READY),
+                        phase_delta(PRTE_PLM_PHASE_LAUNCH_START, PRTE_PLM_PHASE_VM_READY));
+}
+
 void prte_plm_base_daemons_reported(int fd, short args, void *cbdata)
 {
     prte_state_caddy_t *caddy = (prte_state_caddy_t*)cbdata;
@@ -207,6 +259,8 @@ void prte_plm_base_daemons_launched(int fd, short args, void *cbdata)
 
     PRTE_ACQUIRE_OBJECT(caddy);
 
+    mark_phase(PRTE_PLM_PHASE_DAEMONS_LAUNCHED, false);
+
     /* do NOT increment the state - we wait for the
      * daemons to report that they have actually
      * started before moving to the right state
@@ -232,6 +286,10 @@ void prte_plm_base_vm_ready(int fd, short args, void *cbdata)
 
     PRTE_ACQUIRE_OBJECT(caddy);
 
+    if (!startup_reported) {
+        report_startup_phases();
+    }
+
     /* progress the job */
     caddy->jdata->state = PRTE_JOB_STATE_VM_READY;
 
@@ -1015,7 +1073,6 @@ void prte_plm_base_registered(int fd, short args, void *cbdata)
 
 /* daemons callback when they start - need to listen for them */
 static bool prted_failed_launch;
-static prte_job_t *jdatorted=NULL;
 
 /* callback for topology reports */
 void prte_plm_base_daemon_topology(int status, pmix_proc_t* sender,
@@ -1028,7 +1085,7 @@ void prte_plm_base_daemon_topology(int status, pmix_proc_t* sender,
     int rc, idx;
     char *sig, *coprocessors, **sns;
     prte_proc_t *daemon=NULL;
-    prte_topology_t *t, *t2;
+    prte_topology_t *t;
     int i;
     uint32_t h;
     prte_job_t *jdata;
@@ -1096,18 +1153,9 @@ void prte_plm_base_daemon_topology(int status, pmix_proc_t* sender,
         prted_failed_launch = true;
         goto CLEANUP;
     }
-    /* find it in the array */
-    t = NULL;
-    for (i=0; i < prte_node_topologies->size; i++) {
-        if (NULL == (t2 = (prte_topology_t*)prte_pointer_array_get_item(prte_node_topologies, i))) {
-            continue;
-        }
-        /* just check the signature */
-        if (0 == strcmp(sig, t2->sig)) {
-            t = t2;
-            break;
-        }
-    }
+    /* find it in the index */
+    t = prte_get_topology(sig);
+    free(sig);
     if (NULL == t) {
         /* should never happen */
         PRTE_ERROR_LOG(PRTE_ERR_NOT_FOUND);
@@ -1130,6 +1178,7 @@ void prte_plm_base_daemon_topology(int status, pmix_proc_t* sender,
     prte_hwloc_base_filter_cpus(topo);
     /* record the final topology */
     t->topo = topo;
+    mark_phase(PRTE_PLM_PHASE_TOPO_RECEIVED, true);
     /* setup the summary data for this topology as we will need
      * it when we go to map/bind procs to it */
     root = hwloc_get_root_obj(topo);
@@ -1206,6 +1255,7 @@ void prte_plm_base_daemon_topology(int status, pmix_proc_t* sender,
                              jdatorted->num_reported, jdatorted->num_procs));
         if (jdatorted->num_procs == jdatorted->num_reported) {
             bool dvm = true;
+            mark_phase(PRTE_PLM_PHASE_DAEMONS_REPORTED, true);
             jdatorted->state = PRTE_JOB_STATE_DAEMONS_REPORTED;
             /* activate the daemons_reported state for all jobs
              * whose daemons were launched
@@ -1236,6 +1286,41 @@ static void opcbfunc(pmix_status_t status, void *cbdata)
     PRTE_PMIX_WAKEUP_THREAD(lock);
 }
 
+/* tracker for an inventory being delivered to the PMIx server */
+typedef struct {
+    prte_list_item_t super;
+    prte_pmix_lock_t lock;
+    pmix_info_t *info;
+    size_t ninfo;
+} prte_plm_inventory_t;
+static void invcon(prte_plm_inventory_t *p)
+{
+    PRTE_PMIX_CONSTRUCT_LOCK(&p->lock);
+    p->info = NULL;
+    p->ninfo = 0;
+}
+static void invdes(prte_plm_inventory_t *p)
+{
+    PRTE_PMIX_DESTRUCT_LOCK(&p->lock);
+    if (NULL != p->info) {
+        PMIX_INFO_FREE(p->info, p->ninfo);
+    }
+}
+static PRTE_CLASS_INSTANCE(prte_plm_inventory_t,
+                           prte_list_item_t,
+                           invcon, invdes);
+
+static void wait_inventories(prte_list_t *inventories)
+{
+    prte_plm_inventory_t *inv;
+
+    while (NULL != (inv = (prte_plm_inventory_t*)prte_list_remove_first(inventories))) {
+        PRTE_PMIX_WAIT_THREAD(&inv->lock);
+        PRTE_RELEASE(inv);
+    }
+    PRTE_DESTRUCT(inventories);
+}
+
 void prte_plm_base_daemon_callback(int status, pmix_proc_t* sender,
                                    pmix_data_buffer_t *buffer,
                                    prte_rml_tag_t tag, void *cbdata)
@@ -1251,7 +1336,6 @@ void prte_plm_base_daemon_callback(int status, pmix_proc_t* sender,
     prte_topology_t *t, *mytopo;
     hwloc_topology_t topo;
     int i;
-    bool found;
     prte_daemon_cmd_flag_t cmd;
     char *myendian;
     char *alias, **atmp;
@@ -1267,11 +1351,15 @@ void prte_plm_base_daemon_callback(int status, pmix_proc_t* sender,
     bool compressed;
     pmix_data_buffer_t datbuf, *data;
     pmix_topology_t ptopo;
+    prte_list_t inventories;
+    prte_plm_inventory_t *inv;
 
     /* get the daemon job, if necessary */
     if (NULL == jdatorted) {
         jdatorted = prte_get_job_data_object(PRTE_PROC_MY_NAME->nspace);
     }
+    mark_phase(PRTE_PLM_PHASE_FIRST_CALLBACK, false);
+    PRTE_CONSTRUCT(&inventories, prte_list_t);
 
     /* get my endianness */
     mytopo = (prte_topology_t*)prte_pointer_array_get_item(prte_node_topologies, 0);
@@ -1543,7 +1631,6 @@ void prte_plm_base_daemon_callback(int status, pmix_proc_t* sender,
             }
             /* if nothing is present, then ignore it */
             if (0 < pbo.size) {
-                prte_pmix_lock_t lock;
                 /* load the bytes into a PMIx data buffer for unpacking */
                 PMIX_DATA_BUFFER_CONSTRUCT(&pbuf);
                 ret = PMIx_Data_load(&pbuf, &pbo);
@@ -1572,48 +1659,40 @@ void prte_plm_base_daemon_callback(int status, pmix_proc_t* sender,
                     goto CLEANUP;
                 }
                 PMIX_DATA_BUFFER_DESTRUCT(&pbuf);
-                PRTE_PMIX_CONSTRUCT_LOCK(&lock);
-                ret = PMIx_server_deliver_inventory(info, ninfo, NULL, 0, opcbfunc, &lock);
+                /* don't wait for the delivery here - let the inventories of
+                 * all daemons in this buffer be processed concurrently */
+                inv = PRTE_NEW(prte_plm_inventory_t);
+                inv->info = info;
+                inv->ninfo = ninfo;
+                ret = PMIx_server_deliver_inventory(info, ninfo, NULL, 0, opcbfunc, &inv->lock);
                 if (PMIX_SUCCESS != ret) {
                     PMIX_ERROR_LOG(ret);
-                    PMIX_INFO_FREE(info, ninfo);
+                    PRTE_RELEASE(inv);
                     prted_failed_launch = true;
                     goto CLEANUP;
                 }
-                PRTE_PMIX_WAIT_THREAD(&lock);
-                PRTE_PMIX_DESTRUCT_LOCK(&lock);
+                prte_list_append(&inventories, &inv->super);
             }
         }
 
         /* do we already have this topology from some other node? */
-        found = false;
-        for (i=0; i < prte_node_topologies->size; i++) {
-            if (NULL == (t = (prte_topology_t*)prte_pointer_array_get_item(prte_node_topologies, i))) {
-                continue;
-            }
-            /* just check the signature */
-            if (0 == strcmp(sig, t->sig)) {
-                PRTE_OUTPUT_VERBOSE((5, prte_plm_base_framework.framework_output,
-                                     "%s TOPOLOGY ALREADY RECORDED",
-                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME)));
-                found = true;
-                daemon->node->topology = t;
-                if (NULL != topo) {
-                    hwloc_topology_destroy(topo);
-                }
-                free(sig);
-                break;
+        if (NULL != (t = prte_get_topology(sig))) {
+            PRTE_OUTPUT_VERBOSE((5, prte_plm_base_framework.framework_output,
+                                 "%s TOPOLOGY ALREADY RECORDED",
+                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME)));
+            daemon->node->topology = t;
+            if (NULL != topo) {
+                hwloc_topology_destroy(topo);
             }
-        }
-
-        if (!found) {
+            free(sig);
+        } else {
             /* nope - save the signature and request the complete topology from that node */
             PRTE_OUTPUT_VERBOSE((5, prte_plm_base_framework.framework_output,
                                  "%s NEW TOPOLOGY - ADDING",
                                  PRTE_NAME_PRINT(PRTE_PROC_MY_NAME)));
             t = PRTE_NEW(prte_topology_t);
             t->sig = sig;
-            t->index = prte_pointer_array_add(prte_node_topologies, t);
+            prte_add_topology(t);
             daemon->node->topology = t;
             if (NULL != topo) {
                 /* Apply any CPU filters (not preserved by the XML) */
@@ -1635,6 +1714,7 @@ void prte_plm_base_daemon_callback(int status, pmix_proc_t* sender,
                     goto CLEANUP;
                 }
                 /* send it */
+                mark_phase(PRTE_PLM_PHASE_TOPO_REQUESTED, false);
                 prte_rml.send_buffer_nb(&dname, relay,
                                         PRTE_RML_TAG_DAEMON,
                                         prte_rml_send_callback, NULL);
@@ -1663,6 +1743,7 @@ void prte_plm_base_daemon_callback(int status, pmix_proc_t* sender,
         }
 
         if (prted_failed_launch) {
+            wait_inventories(&inventories);
             PRTE_ACTIVATE_JOB_STATE(jdatorted, PRTE_JOB_STATE_FAILED_TO_START);
             return;
         } else {
@@ -1674,6 +1755,7 @@ void prte_plm_base_daemon_callback(int status, pmix_proc_t* sender,
                                  jdatorted->num_reported, jdatorted->num_procs));
             if (jdatorted->num_procs == jdatorted->num_reported) {
                 bool dvm = true;
+                mark_phase(PRTE_PLM_PHASE_DAEMONS_REPORTED, true);
                 jdatorted->state = PRTE_JOB_STATE_DAEMONS_REPORTED;
                 /* activate the daemons_reported state for all jobs
                  * whose daemons were launched
@@ -1698,6 +1780,9 @@ void prte_plm_base_daemon_callback(int status, pmix_proc_t* sender,
         }
         idx = 1;
     }
+    /* the state machine can't move forward until the
+     * inventories are in place */
+    wait_inventories(&inventories);
     if (PMIX_ERR_UNPACK_READ_PAST_END_OF_BUFFER != ret) {
         PMIX_ERROR_LOG(ret);
         PRTE_ACTIVATE_JOB_STATE(jdatorted, PRTE_JOB_STATE_FAILED_TO_START);
@@ -1960,6 +2045,8 @@ int prte_plm_base_setup_virtual_machine(prte_job_t *jdata)
                          "%s plm:base:setup_vm",
                          PRTE_NAME_PRINT(PRTE_PROC_MY_NAME)));
 
+    mark_phase(PRTE_PLM_PHASE_LAUNCH_START, false);
+
     if (NULL == (daemons = prte_get_job_data_object(PRTE_PROC_MY_NAME->nspace))) {
         PRTE_ERROR_LOG(PRTE_ERR_NOT_FOUND);
         return PRTE_ERR_NOT_FOUND;
@@ -55,6 +55,7 @@
 #include "src/mca/ras/base/base.h"
 #include "src/util/name_fns.h"
 #include "src/mca/state/state.h"
+#include "src/mca/state/base/base.h"
 #include "src/pmix/pmix-internal.h"
 #include "src/runtime/prte_globals.h"
 #include "src/runtime/prte_quit.h"
@@ -135,6 +136,7 @@ void prte_plm_base_recv(int status, pmix_proc_t* sender,
     pmix_data_buffer_t *answer;
     pmix_rank_t vpid;
     prte_proc_t *proc;
+    prte_state_batch_t *batch = NULL;
     prte_proc_state_t state;
     prte_exit_code_t exit_code;
     int32_t rc=PRTE_SUCCESS, ret;
@@ -377,17 +379,22 @@ void prte_plm_base_recv(int status, pmix_proc_t* sender,
                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                                 PRTE_JOBID_PRINT(job));
 
-            PMIX_LOAD_NSPACE(name.nspace, job);
             running = false;
             /* get the job object */
             jdata = prte_get_job_data_object(job);
+            if (NULL != jdata) {
+                /* collect the updates for this job so they can all be
+                 * applied in a single pass of the state machine */
+                batch = PRTE_NEW(prte_state_batch_t);
+                PRTE_RETAIN(jdata);
+                batch->jdata = jdata;
+            }
             count = 1;
             while (PMIX_SUCCESS == (rc = PMIx_Data_unpack(NULL, buffer, &vpid, &count, PMIX_PROC_RANK))) {
                 if (PMIX_RANK_INVALID == vpid) {
                     /* flag indicates that this job is complete - move on */
                     break;
                 }
-                name.rank = vpid;
                 /* unpack the pid */
                 count = 1;
                 rc = PMIx_Data_unpack(NULL, buffer, &pid, &count, PMIX_PID);
@@ -430,9 +437,13 @@ void prte_plm_base_recv(int status, pmix_proc_t* sender,
                      * state against the prior proc state */
                     proc->pid = pid;
                     proc->exit_code = exit_code;
-                    PRTE_ACTIVATE_PROC_STATE(&name, state);
+                    prte_state_base_batch_add(batch, vpid, state);
                 }
             }
+            if (NULL != batch) {
+                prte_state_base_activate_proc_batch(batch);
+                batch = NULL;
+            }
             /* record that we heard back from a daemon during app launch */
             if (running && NULL != jdata) {
                 jdata->num_daemons_reported++;
@@ -484,6 +495,9 @@ void prte_plm_base_recv(int status, pmix_proc_t* sender,
     }
 
   CLEANUP:
+    if (NULL != batch) {
+        PRTE_RELEASE(batch);
+    }
     /* see if an error occurred - if so, wakeup the HNP so we can exit */
     if (PRTE_PROC_IS_MASTER && PRTE_SUCCESS != rc) {
         jdata = NULL;
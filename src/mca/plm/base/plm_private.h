@@ -52,6 +52,18 @@ BEGIN_C_DECLS
 
 PRTE_EXPORT extern prte_mca_base_framework_t prte_plm_base_framework;
 
+/* DVM startup phases whose time is tracked */
+typedef enum {
+    PRTE_PLM_PHASE_LAUNCH_START,
+    PRTE_PLM_PHASE_DAEMONS_LAUNCHED,
+    PRTE_PLM_PHASE_FIRST_CALLBACK,
+    PRTE_PLM_PHASE_DAEMONS_REPORTED,
+    PRTE_PLM_PHASE_TOPO_REQUESTED,
+    PRTE_PLM_PHASE_TOPO_RECEIVED,
+    PRTE_PLM_PHASE_VM_READY,
+    PRTE_PLM_PHASE_MAX
+} prte_plm_phase_t;
+
 /* globals for use solely within PLM framework */
 typedef struct {
     /* base nspace for this DVM */
@@ -65,6 +77,9 @@ typedef struct {
     /* daemon nodes assigned at launch */
     bool daemon_nodes_assigned_at_launch;
     size_t node_regex_threshold;
+    /* time at which each startup phase was reached */
+    struct timeval phases[PRTE_PLM_PHASE_MAX];
+    bool report_startup_timing;
 } prte_plm_globals_t;
 /**
  * Global instance of PLM framework data
@@ -18,12 +18,16 @@
 #include <unistd.h>
 #endif  /* HAVE_UNISTD_H */
 #include <string.h>
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
 #ifdef HAVE_SYS_WAIT_H
 #include <sys/wait.h>
 #endif
 #include <pmix.h>
 #include <pmix_server.h>
 
+#include "src/event/event-internal.h"
 #include "src/util/output.h"
 
 #include "src/pmix/pmix-internal.h"
@@ -41,6 +45,7 @@
 #include "src/mca/grpcomm/bmg/grpcomm_bmg.h"
 #include "src/mca/ess/ess.h"
 #include "src/mca/state/state.h"
+#include "src/mca/state/base/base.h"
 
 #include "src/util/error_strings.h"
 #include "src/util/name_fns.h"
@@ -65,6 +70,14 @@ prte_list_t prte_error_procs = {{0}};
 
 static int prte_propagate_error_cb_type = -1;
 
+/* failures detected here that are waiting to be broadcast - they
+ * are collected for a short window so that the loss of many procs
+ * at once (e.g., a node or a rack) results in a single notice */
+static pmix_data_buffer_t pending;
+static int32_t npending = 0;
+static prte_event_t pending_ev;
+static bool pending_active = false;
+
 static int init(void);
 static int finalize(void);
 static int register_prp_callback(void);
@@ -74,6 +87,7 @@ static int prte_propagate_prperror(const pmix_nspace_t job,
                                    prte_proc_state_t state);
 
 static int prte_propagate_prperror_recv(pmix_data_buffer_t* buffer);
+static void flush_pending(int fd, short args, void *cbdata);
 
 /* flag use to register callback for grpcomm rbcast forward */
 int enable_callback_register_flag = 1;
@@ -109,6 +123,10 @@ static void flush_error_list(size_t evhdlr_registration_id,
 static int init(void)
 {
     PRTE_CONSTRUCT(&prte_error_procs, prte_list_t);
+    PMIX_DATA_BUFFER_CONSTRUCT(&pending);
+    npending = 0;
+    pending_active = false;
+    prte_event_evtimer_set(prte_event_base, &pending_ev, flush_pending, NULL);
     pmix_status_t pcode1 = PMIX_ERR_JOB_TERMINATED;
     PMIx_Register_event_handler(&pcode1, 1, NULL, 0, flush_error_list, NULL, NULL);
     return PRTE_SUCCESS;
@@ -133,6 +151,12 @@ static int register_prp_callback(void)
 static int finalize(void)
 {
     int ret=0;
+    if (pending_active) {
+        prte_event_evtimer_del(&pending_ev);
+        pending_active = false;
+    }
+    PMIX_DATA_BUFFER_DESTRUCT(&pending);
+    npending = 0;
     if ( -1 == prte_propagate_error_cb_type){
         return PRTE_SUCCESS;
     }
@@ -143,6 +167,61 @@ static int finalize(void)
     return ret;
 }
 
+/* broadcast all the failures collected so far in one notice
+ * ---------------------------------------------------------------
+ * | cb_type | nfailures | status | errorproc | nprocs affected | procs | ...
+ * --------------------------------------------------------------*/
+static void flush_pending(int fd, short args, void *cbdata)
+{
+    pmix_data_buffer_t buf;
+    prte_grpcomm_signature_t *sig;
+    int rc;
+
+    pending_active = false;
+    if (0 == npending) {
+        return;
+    }
+
+    PRTE_OUTPUT_VERBOSE((5, prte_propagate_base_framework.framework_output,
+                         "propagate: prperror: daemon %s rbcast %d failures",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), (int)npending));
+
+    PMIX_DATA_BUFFER_CONSTRUCT(&buf);
+    /* pack the callback type */
+    rc = PMIx_Data_pack(NULL, &buf, &prte_propagate_error_cb_type, 1, PMIX_INT);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        goto done;
+    }
+    /* pack the number of failures */
+    rc = PMIx_Data_pack(NULL, &buf, &npending, 1, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        goto done;
+    }
+    rc = PMIx_Data_copy_payload(&buf, &pending);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        goto done;
+    }
+
+    /* goes to all daemons */
+    sig = PRTE_NEW(prte_grpcomm_signature_t);
+    sig->signature = (pmix_proc_t*)malloc(sizeof(pmix_proc_t));
+    sig->sz = 1;
+    PMIX_LOAD_PROCID(&sig->signature[0], PRTE_PROC_MY_NAME->nspace, PMIX_RANK_WILDCARD);
+    if (PRTE_SUCCESS != (rc = prte_grpcomm.rbcast(sig, PRTE_RML_TAG_PROPAGATE, &buf))) {
+        PRTE_ERROR_LOG(rc);
+    }
+    PRTE_RELEASE(sig);
+
+  done:
+    PMIX_DATA_BUFFER_DESTRUCT(&buf);
+    PMIX_DATA_BUFFER_DESTRUCT(&pending);
+    PMIX_DATA_BUFFER_CONSTRUCT(&pending);
+    npending = 0;
+}
+
 /*
  * uplevel call from the error handler to initiate a failure_propagator
  */
@@ -158,7 +237,6 @@ static int prte_propagate_prperror(const pmix_nspace_t job,
 
     /* namelist for tracking error procs */
     prte_namelist_t *nmcheck, *nm;
-    nmcheck = PRTE_NEW(prte_namelist_t);
 
     PRTE_LIST_FOREACH(nmcheck, &prte_error_procs, prte_namelist_t){
         if (PMIX_CHECK_PROCID(&nmcheck->name, errorproc)) {
@@ -172,11 +250,10 @@ static int prte_propagate_prperror(const pmix_nspace_t job,
     PMIX_XFER_PROCID(&nm->name, errorproc);
     prte_list_append(&prte_error_procs, &(nm->super));
 
-    prte_grpcomm_signature_t *sig;
     int cnt=0;
-    /* ---------------------------------------------------------
-     * | cb_type | status | errorproc | nprocs afftected | procs|
-     * --------------------------------------------------------*/
+    /* ---------------------------------------------------
+     * | status | errorproc | nprocs afftected | procs|
+     * --------------------------------------------------*/
     pmix_data_buffer_t prperror_buffer;
 
     /* set the status for pmix to use */
@@ -202,13 +279,6 @@ static int prte_propagate_prperror(const pmix_nspace_t job,
                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),state, PRTE_NAME_PRINT(errorproc)));
 
     PMIX_DATA_BUFFER_CONSTRUCT(&prperror_buffer);
-    /* pack the callback type */
-    rc = PMIx_Data_pack(NULL, &prperror_buffer, &prte_propagate_error_cb_type, 1, PMIX_INT);
-    if (PMIX_SUCCESS != rc) {
-        PMIX_ERROR_LOG(rc);
-        PMIX_DATA_BUFFER_DESTRUCT(&prperror_buffer);
-        return rc;
-    }
     /* pack the status */
     rc = PMIx_Data_pack(NULL, &prperror_buffer, &status, 1, PMIX_INT);
     if (PMIX_SUCCESS != rc) {
@@ -350,7 +420,9 @@ static int prte_propagate_prperror(const pmix_nspace_t job,
                     return rc;
                 }
 
-                /* send this process's info to hnp */
+                /* send this process's info to hnp - after any
+                 * queued state updates */
+                prte_state_base_flush_updates();
                 if (0 > (rc = prte_rml.send_buffer_nb(
                                 PRTE_PROC_MY_HNP, alert,
                                 PRTE_RML_TAG_PLM,
@@ -370,70 +442,54 @@ static int prte_propagate_prperror(const pmix_nspace_t job,
         }
     }
 
-    /* goes to all daemons */
-    sig = PRTE_NEW(prte_grpcomm_signature_t);
-    sig->signature = (pmix_proc_t*)malloc(sizeof(pmix_proc_t));
-    PMIX_LOAD_PROCID(&sig->signature[0], PRTE_PROC_MY_NAME->nspace, PMIX_RANK_WILDCARD);
-    if (PRTE_SUCCESS != (rc = prte_grpcomm.rbcast(sig, PRTE_RML_TAG_PROPAGATE, &prperror_buffer))) {
-        PRTE_ERROR_LOG(rc);
+    /* queue it for the next notice to all daemons */
+    rc = PMIx_Data_copy_payload(&pending, &prperror_buffer);
+    PMIX_DATA_BUFFER_DESTRUCT(&prperror_buffer);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+    } else {
+        ++npending;
+        if (0 >= prte_propagate_prperror_coalesce_window) {
+            flush_pending(0, 0, NULL);
+        } else if (!pending_active) {
+            struct timeval tv;
+            tv.tv_sec = prte_propagate_prperror_coalesce_window / 1000000;
+            tv.tv_usec = prte_propagate_prperror_coalesce_window % 1000000;
+            pending_active = true;
+            prte_event_evtimer_add(&pending_ev, &tv);
+        }
     }
     /* notify this error locally, only from rbcast dont have a source id */
     if( source==NULL ) {
-        if (PRTE_SUCCESS != PMIx_Notify_event(prte_pmix_convert_rc(state), NULL,
-                    PMIX_RANGE_LOCAL, pinfo, cnt+1,
-                    NULL,NULL )) {
-            PMIX_INFO_FREE(pinfo, pcnt);
-        }
+        PMIx_Notify_event(prte_pmix_convert_rc(state), NULL,
+                          PMIX_RANGE_LOCAL, pinfo, cnt+1,
+                          NULL,NULL );
     }
-    //PRTE_DESTRUCT(&prperror_buffer);
     PMIX_INFO_FREE(pinfo, pcnt);
-    PRTE_RELEASE(sig);
     /* we're done! */
     return PRTE_SUCCESS;
 }
 
-static int _prte_propagate_prperror(pmix_nspace_t job, pmix_proc_t *source,
-                pmix_proc_t *errorproc, prte_proc_state_t state, pmix_data_buffer_t* buffer,pmix_data_buffer_t* rly) {
-
-    int rc = PRTE_SUCCESS;
-    /* don't need to check jobid because this can be different: daemon and process has different jobids */
-
+/* process one failure from a notice - returns true if
+ * it was news to us */
+static bool _prte_propagate_prperror(pmix_proc_t *errorproc, prte_proc_state_t state,
+                                     pmix_data_buffer_t* buffer, int *rc)
+{
     /* namelist for tracking error procs */
     prte_namelist_t *nmcheck, *nm;
-    nmcheck = PRTE_NEW(prte_namelist_t);
-
-    PRTE_LIST_FOREACH(nmcheck, &prte_error_procs, prte_namelist_t){
-        if (PMIX_CHECK_PROCID(&nmcheck->name, errorproc)) {
-            PRTE_OUTPUT_VERBOSE((10, prte_propagate_base_framework.framework_output,
-                                 "propagate: prperror: already propagated this msg: error proc is %s",
-                                 PRTE_NAME_PRINT(errorproc)));
-            return rc;
-        }
-    }
-    PRTE_OUTPUT_VERBOSE((10, prte_propagate_base_framework.framework_output,
-                         "propagate: prperror: interal forward: error proc is %s",
-                         PRTE_NAME_PRINT(errorproc)));
-
-    nm = PRTE_NEW(prte_namelist_t);
-    PMIX_XFER_PROCID(&nm->name, errorproc);
-    prte_list_append(&prte_error_procs, &(nm->super));
-    /* goes to all daemons */
-    prte_grpcomm_signature_t *sig;
-    sig = PRTE_NEW(prte_grpcomm_signature_t);
-    sig->signature = (pmix_proc_t*)malloc(sizeof(pmix_proc_t));
-    PMIX_LOAD_PROCID(&sig->signature[0], PRTE_PROC_MY_NAME->nspace, PMIX_RANK_WILDCARD);
-    if (PRTE_SUCCESS != (rc = prte_grpcomm.rbcast(sig, PRTE_RML_TAG_PROPAGATE, rly))) {
-        PRTE_ERROR_LOG(rc);
-    }
-
     pmix_info_t *pinfo;
-    int ret;
     int cnt=1;
     size_t pcnt=1;
     int num_affected = 0;
-    ret = PMIx_Data_unpack(NULL, buffer, &num_affected, &cnt, PMIX_INT);
-    if (PMIX_SUCCESS != ret) {
-        PMIX_ERROR_LOG(ret);
+    pmix_proc_t ename;
+    int i=0;
+    bool known = false;
+
+    /* always unpack the affected procs so the next failure
+     * in the notice can be found */
+    *rc = PMIx_Data_unpack(NULL, buffer, &num_affected, &cnt, PMIX_INT);
+    if (PMIX_SUCCESS != *rc) {
+        PMIX_ERROR_LOG(*rc);
         return false;
     }
     pcnt = 1+num_affected;
@@ -441,43 +497,59 @@ static int _prte_propagate_prperror(pmix_nspace_t job, pmix_proc_t *source,
 
     PMIX_INFO_LOAD(&pinfo[0], PMIX_EVENT_AFFECTED_PROC, errorproc, PMIX_PROC );
 
-    pmix_proc_t ename;
-    int i=0;
     for (i =0; i <num_affected; i++) {
-        rc = PMIx_Data_unpack(NULL, buffer, &ename, &cnt, PMIX_PROC);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
+        cnt = 1;
+        *rc = PMIx_Data_unpack(NULL, buffer, &ename, &cnt, PMIX_PROC);
+        if (PMIX_SUCCESS != *rc) {
+            PMIX_ERROR_LOG(*rc);
             PMIX_INFO_FREE(pinfo, pcnt);
-            return rc;
+            return false;
         }
         PMIX_INFO_LOAD(&pinfo[i+1], PMIX_EVENT_AFFECTED_PROC, &ename, PMIX_PROC );
     }
-    /* notify this error locally, only from rbcast dont have a source id */
-    if (source == NULL) {
-        if (PRTE_SUCCESS != PMIx_Notify_event(prte_pmix_convert_rc(state), NULL,
-                                              PMIX_RANGE_LOCAL, pinfo, num_affected+1,
-                                              NULL,NULL)) {
-            PRTE_RELEASE(pinfo);
+
+    /* don't need to check jobid because this can be different: daemon and process has different jobids */
+    PRTE_LIST_FOREACH(nmcheck, &prte_error_procs, prte_namelist_t){
+        if (PMIX_CHECK_PROCID(&nmcheck->name, errorproc)) {
+            known = true;
+            break;
         }
     }
-    return rc;
+    if (known) {
+        PRTE_OUTPUT_VERBOSE((10, prte_propagate_base_framework.framework_output,
+                             "propagate: prperror: already propagated this msg: error proc is %s",
+                             PRTE_NAME_PRINT(errorproc)));
+        PMIX_INFO_FREE(pinfo, pcnt);
+        return false;
+    }
+    PRTE_OUTPUT_VERBOSE((10, prte_propagate_base_framework.framework_output,
+                         "propagate: prperror: interal forward: error proc is %s",
+                         PRTE_NAME_PRINT(errorproc)));
+
+    nm = PRTE_NEW(prte_namelist_t);
+    PMIX_XFER_PROCID(&nm->name, errorproc);
+    prte_list_append(&prte_error_procs, &(nm->super));
+
+    /* notify this error locally */
+    PMIx_Notify_event(prte_pmix_convert_rc(state), NULL,
+                      PMIX_RANGE_LOCAL, pinfo, pcnt,
+                      NULL,NULL);
+    PMIX_INFO_FREE(pinfo, pcnt);
+    return true;
 }
 
 
+/* returns true if the notice should be forwarded by grpcomm,
+ * i.e., if it told us about at least one failure we didn't
+ * already know about */
 static int prte_propagate_prperror_recv(pmix_data_buffer_t* buffer)
 {
     int rc, cnt, state;
     pmix_proc_t errorproc;
     int cbtype;
+    int32_t n, nfailures;
+    bool forward = false;
 
-    pmix_data_buffer_t rly;
-    PMIX_DATA_BUFFER_CONSTRUCT(&rly);
-
-    rc = PMIx_Data_copy_payload(&rly, buffer);
-    if (PMIX_SUCCESS != rc) {
-        PMIX_ERROR_LOG(rc);
-        return false;
-    }
     /* get the cbtype */
     cnt=1;
     rc = PMIx_Data_unpack(NULL, buffer, &cbtype, &cnt, PMIX_INT);
@@ -485,24 +557,36 @@ static int prte_propagate_prperror_recv(pmix_data_buffer_t* buffer)
         PMIX_ERROR_LOG(rc);
         return false;
     }
-    cnt = 1;
-    rc = PMIx_Data_unpack(NULL, buffer, &state, &cnt, PMIX_INT);
-    if (PMIX_SUCCESS != rc) {
-        PMIX_ERROR_LOG(rc);
-        return false;
-    }
-    /* for propagate, only one major errorproc is affected per call */
-    cnt = 1;
-    rc = PMIx_Data_unpack(NULL, buffer, &errorproc, &cnt, PMIX_PROC);
+    cnt=1;
+    rc = PMIx_Data_unpack(NULL, buffer, &nfailures, &cnt, PMIX_INT32);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
         return false;
     }
+    for (n=0; n < nfailures; n++) {
+        cnt = 1;
+        rc = PMIx_Data_unpack(NULL, buffer, &state, &cnt, PMIX_INT);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            break;
+        }
+        cnt = 1;
+        rc = PMIx_Data_unpack(NULL, buffer, &errorproc, &cnt, PMIX_PROC);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            break;
+        }
 
-    PRTE_OUTPUT_VERBOSE((5, prte_propagate_base_framework.framework_output,
-                "%s propagete: prperror: daemon received %s gone forwarding with status %d",
-                PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(&errorproc), state));
+        PRTE_OUTPUT_VERBOSE((5, prte_propagate_base_framework.framework_output,
+                    "%s propagete: prperror: daemon received %s gone forwarding with status %d",
+                    PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_NAME_PRINT(&errorproc), state));
 
-    _prte_propagate_prperror(prte_process_info.myproc.nspace, NULL, &errorproc, state, buffer , &rly);
-    return false;
+        if (_prte_propagate_prperror(&errorproc, state, buffer, &rc)) {
+            forward = true;
+        }
+        if (PMIX_SUCCESS != rc) {
+            break;
+        }
+    }
+    return forward;
 }
@@ -34,6 +34,9 @@ PRTE_EXPORT extern prte_propagate_base_module_t prte_propagate_prperror_module;
 
 PRTE_EXPORT extern prte_list_t prte_error_procs;
 
+/* usecs to collect failures into a single notice */
+extern int prte_propagate_prperror_coalesce_window;
+
 END_C_DECLS
 
 #endif /* MCA_PROPAGATE_PRPERROR_EXPORT_H */
@@ -60,6 +60,7 @@ prte_propagate_base_component_t prte_propagate_prperror_component = {
 };
 
 static int my_priority;
+int prte_propagate_prperror_coalesce_window = 10000;
 
 static int propagate_prperror_register(void)
 {
@@ -73,6 +74,15 @@ static int propagate_prperror_register(void)
             PRTE_INFO_LVL_9,
             PRTE_MCA_BASE_VAR_SCOPE_READONLY, &my_priority);
 
+    prte_propagate_prperror_coalesce_window = 10000;
+    (void) prte_mca_base_component_var_register(c, "coalesce_window",
+            "Time (in microseconds) to collect failures detected by this daemon into a single "
+            "notice to the other daemons (0 = send a notice for each failure as it is detected)",
+            PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0,
+            PRTE_MCA_BASE_VAR_FLAG_NONE,
+            PRTE_INFO_LVL_9,
+            PRTE_MCA_BASE_VAR_SCOPE_READONLY, &prte_propagate_prperror_coalesce_window);
+
     return PRTE_SUCCESS;
 }
 
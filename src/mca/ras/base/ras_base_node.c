@@ -131,7 +131,7 @@ int prte_ras_base_node_insert(prte_list_t* nodes, prte_job_t *jdata)
             hnp_node->slots = node->slots;
             hnp_node->slots_max = node->slots_max;
             /* copy across any attributes */
-            PRTE_LIST_FOREACH(kv, &node->attributes, prte_attribute_t) {
+            PRTE_LIST_FOREACH(kv, &node->attributes.super, prte_attribute_t) {
                 prte_set_attribute(&node->attributes, kv->key, PRTE_ATTR_LOCAL, &kv->data, kv->data.type);
             }
             if (prte_managed_allocation || PRTE_FLAG_TEST(node, PRTE_NODE_FLAG_SLOTS_GIVEN)) {
@@ -204,7 +204,7 @@ static int allocate(prte_job_t *jdata, prte_list_t *nodes)
             t = PRTE_NEW(prte_topology_t);
             t->topo = topo;
             t->sig = prte_hwloc_base_get_topo_signature(topo);
-            prte_pointer_array_add(prte_node_topologies, t);
+            prte_add_topology(t);
         } else {
             if (0 != hwloc_topology_init(&topo)) {
                 prte_show_help("help-ras-simulator.txt",
@@ -260,7 +260,7 @@ static int allocate(prte_job_t *jdata, prte_list_t *nodes)
             t = PRTE_NEW(prte_topology_t);
             t->topo = topo;
             t->sig = prte_hwloc_base_get_topo_signature(topo);
-            prte_pointer_array_add(prte_node_topologies, t);
+            prte_add_topology(t);
         }
 
         /* get the available processors on this node */
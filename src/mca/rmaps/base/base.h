@@ -73,6 +73,8 @@ typedef struct {
     /* default file for use in sequential and rankfile mapping
      * when the directive comes thru MCA param */
     char *file;
+    /* whether or not to report the time spent in each mapping phase */
+    bool report_timing;
 } prte_rmaps_base_t;
 
 /**
@@ -69,10 +69,82 @@ static bool membind_warned=false;
  * to recording usage etc in the userdata object */
 
 
-static void reset_usage(prte_node_t *node, pmix_nspace_t jobid)
+/* job-level info used when computing bindings node by node. None
+ * of this varies between nodes, so we look it up just once */
+typedef struct {
+    bool dobind;
+    bool do_not_launch;
+    bool use_hwthread_cpus;
+    int cpus_per_rank;
+    char *job_cpuset;
+    /* available cpus restricted to the job's cpuset, by topology index */
+    prte_pointer_array_t available;
+    /* scratch storage reused for each node */
+    hwloc_cpuset_t totalcpuset;
+    prte_proc_t **procs;
+    int nprocs;
+    int szprocs;
+} bind_info_t;
+
+static void bind_info_setup(prte_job_t *jdata, bind_info_t *info)
+{
+    uint16_t u16, *u16ptr = &u16;
+
+    memset(info, 0, sizeof(bind_info_t));
+    if (prte_get_attribute(&jdata->attributes, PRTE_JOB_DO_NOT_LAUNCH, NULL, PMIX_BOOL)) {
+        info->do_not_launch = true;
+    }
+    if (info->do_not_launch ||
+        prte_get_attribute(&jdata->attributes, PRTE_JOB_DISPLAY_MAP, NULL, PMIX_BOOL) ||
+        prte_get_attribute(&jdata->attributes, PRTE_JOB_DISPLAY_DEVEL_MAP, NULL, PMIX_BOOL) ||
+        prte_get_attribute(&jdata->attributes, PRTE_JOB_DISPLAY_DIFF, NULL, PMIX_BOOL)) {
+        info->dobind = true;
+    }
+    /* see if they want multiple cpus/rank */
+    if (prte_get_attribute(&jdata->attributes, PRTE_JOB_PES_PER_PROC, (void**)&u16ptr, PMIX_UINT16)) {
+        info->cpus_per_rank = u16;
+    } else {
+        info->cpus_per_rank = 1;
+    }
+    /* check for type of cpu being used */
+    if (prte_get_attribute(&jdata->attributes, PRTE_JOB_HWT_CPUS, NULL, PMIX_BOOL)) {
+        info->use_hwthread_cpus = true;
+    }
+    /* see if this job has a "soft" cgroup assignment */
+    if (!prte_get_attribute(&jdata->attributes, PRTE_JOB_CPUSET, (void**)&info->job_cpuset, PMIX_STRING)) {
+        info->job_cpuset = NULL;
+    }
+    PRTE_CONSTRUCT(&info->available, prte_pointer_array_t);
+    prte_pointer_array_init(&info->available, 4, INT_MAX, 4);
+    info->totalcpuset = hwloc_bitmap_alloc();
+}
+
+static void bind_info_teardown(bind_info_t *info)
+{
+    int i;
+    hwloc_cpuset_t cpus;
+
+    for (i=0; i < info->available.size; i++) {
+        if (NULL != (cpus = (hwloc_cpuset_t)prte_pointer_array_get_item(&info->available, i))) {
+            hwloc_bitmap_free(cpus);
+        }
+    }
+    PRTE_DESTRUCT(&info->available);
+    hwloc_bitmap_free(info->totalcpuset);
+    if (NULL != info->job_cpuset) {
+        free(info->job_cpuset);
+    }
+    if (NULL != info->procs) {
+        free(info->procs);
+    }
+}
+
+/* if info is given, the procs on the node that belong to the job
+ * are collected into it (in node order) while we are scanning */
+static int reset_usage(prte_node_t *node, pmix_nspace_t jobid, bind_info_t *info)
 {
     int j;
-    prte_proc_t *proc;
+    prte_proc_t *proc, **procs;
     prte_hwloc_obj_data_t *data=NULL;
     hwloc_obj_t bound;
 
@@ -85,6 +157,19 @@ static void reset_usage(prte_node_t *node, pmix_nspace_t jobid)
      * records from the userdata in this topo */
     prte_hwloc_base_clear_usage(node->topology->topo);
 
+    if (NULL != info) {
+        info->nprocs = 0;
+        if (info->szprocs < node->procs->size) {
+            procs = (prte_proc_t**)realloc(info->procs, node->procs->size * sizeof(prte_proc_t*));
+            if (NULL == procs) {
+                PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+                return PRTE_ERR_OUT_OF_RESOURCE;
+            }
+            info->procs = procs;
+            info->szprocs = node->procs->size;
+        }
+    }
+
     /* cycle thru the procs on the node and record
      * their usage in the topology
      */
@@ -98,6 +183,9 @@ static void reset_usage(prte_node_t *node, pmix_nspace_t jobid)
                                 "%s reset_usage: ignoring proc %s",
                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                                 PRTE_NAME_PRINT(&proc->name));
+            if (NULL != info) {
+                info->procs[info->nprocs++] = proc;
+            }
             continue;
         }
         bound = NULL;
@@ -124,6 +212,7 @@ static void reset_usage(prte_node_t *node, pmix_nspace_t jobid)
                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                             PRTE_NAME_PRINT(&proc->name), data->num_bound);
     }
+    return PRTE_SUCCESS;
 }
 
 static void unbind_procs(prte_job_t *jdata)
@@ -142,24 +231,23 @@ static void unbind_procs(prte_job_t *jdata)
 
 static int bind_generic(prte_job_t *jdata,
                         prte_node_t *node,
-                        int target_depth)
+                        int target_depth,
+                        bind_info_t *info)
 {
-    int j;
+    int j, rc;
     prte_job_map_t *map;
     prte_proc_t *proc;
     hwloc_obj_t trg_obj, tmp_obj, nxt_obj;
     unsigned int ncpus;
     prte_hwloc_obj_data_t *data;
-    int total_cpus, cpus_per_rank;
-    hwloc_cpuset_t totalcpuset, available, mycpus;
+    int total_cpus;
+    hwloc_cpuset_t totalcpuset, available;
     hwloc_obj_t locale;
-    char *cpu_bitmap, *job_cpuset;
+    char *cpu_bitmap;
     unsigned min_bound;
-    bool dobind, use_hwthread_cpus;
     struct hwloc_topology_support *support;
     hwloc_obj_t root;
     prte_hwloc_topo_data_t *rdata;
-    uint16_t u16, *u16ptr = &u16;
 
     prte_output_verbose(5, prte_rmaps_base_framework.framework_output,
                         "mca:rmaps: bind downward for job %s with bindings %s",
@@ -167,17 +255,12 @@ static int bind_generic(prte_job_t *jdata,
                         prte_hwloc_base_print_binding(jdata->map->binding));
     /* initialize */
     map = jdata->map;
-    totalcpuset = hwloc_bitmap_alloc();
+    totalcpuset = info->totalcpuset;
 
-    dobind = false;
-    if (prte_get_attribute(&jdata->attributes, PRTE_JOB_DO_NOT_LAUNCH, NULL, PMIX_BOOL) ||
-        prte_get_attribute(&jdata->attributes, PRTE_JOB_DISPLAY_MAP, NULL, PMIX_BOOL) ||
-        prte_get_attribute(&jdata->attributes, PRTE_JOB_DISPLAY_DEVEL_MAP, NULL, PMIX_BOOL) ||
-        prte_get_attribute(&jdata->attributes, PRTE_JOB_DISPLAY_DIFF, NULL, PMIX_BOOL)) {
-        dobind = true;
+    /* reset usage and collect this job's procs on the node */
+    if (PRTE_SUCCESS != (rc = reset_usage(node, jdata->nspace, info))) {
+        return rc;
     }
-    /* reset usage */
-    reset_usage(node, jdata->nspace);
 
     /* get the available processors on this node */
     root = hwloc_get_root_obj(node->topology->topo);
@@ -187,45 +270,33 @@ static int bind_generic(prte_job_t *jdata,
         return PRTE_ERR_BAD_PARAM;
     }
     rdata = (prte_hwloc_topo_data_t*)root->userdata;
-    available = hwloc_bitmap_dup(rdata->available);
-
-    /* see if they want multiple cpus/rank */
-    if (prte_get_attribute(&jdata->attributes, PRTE_JOB_PES_PER_PROC, (void**)&u16ptr, PMIX_UINT16)) {
-        cpus_per_rank = u16;
-    } else {
-        cpus_per_rank = 1;
-    }
-
-    /* check for type of cpu being used */
-    if (prte_get_attribute(&jdata->attributes, PRTE_JOB_HWT_CPUS, NULL, PMIX_BOOL)) {
-        use_hwthread_cpus = true;
-    } else {
-        use_hwthread_cpus = false;
-    }
-
-    /* see if this job has a "soft" cgroup assignment */
-    job_cpuset = NULL;
-    if (prte_get_attribute(&jdata->attributes, PRTE_JOB_CPUSET, (void**)&job_cpuset, PMIX_STRING) &&
-        NULL != job_cpuset) {
-        mycpus = prte_hwloc_base_generate_cpuset(node->topology->topo, use_hwthread_cpus, job_cpuset);
-        hwloc_bitmap_and(available, mycpus, available);
-        hwloc_bitmap_free(mycpus);
+    available = rdata->available;
+
+    /* if this job has a "soft" cgroup assignment, restrict the
+     * available cpus to it - the result only depends on the
+     * topology, so compute it once for each topology we see */
+    if (NULL != info->job_cpuset) {
+        available = NULL;
+        if (0 <= node->topology->index) {
+            available = (hwloc_cpuset_t)prte_pointer_array_get_item(&info->available, node->topology->index);
+        }
+        if (NULL == available) {
+            available = prte_hwloc_base_generate_cpuset(node->topology->topo, info->use_hwthread_cpus, info->job_cpuset);
+            hwloc_bitmap_and(available, available, rdata->available);
+            if (0 <= node->topology->index) {
+                prte_pointer_array_set_item(&info->available, node->topology->index, available);
+            }
+        }
     }
 
     /* cycle thru the procs */
-    for (j=0; j < node->procs->size; j++) {
-        if (NULL == (proc = (prte_proc_t*)prte_pointer_array_get_item(node->procs, j))) {
-            continue;
-        }
-        /* ignore procs from other jobs */
-        if (!PMIX_CHECK_NSPACE(proc->name.nspace, jdata->nspace)) {
-            continue;
-        }
-        if ((int)PRTE_PROC_MY_NAME->rank != node->index && !dobind) {
+    for (j=0; j < info->nprocs; j++) {
+        proc = info->procs[j];
+        if ((int)PRTE_PROC_MY_NAME->rank != node->index && !info->dobind) {
             continue;
         }
 
-        if (!prte_get_attribute(&jdata->attributes, PRTE_JOB_DO_NOT_LAUNCH, NULL, PMIX_BOOL)) {
+        if (!info->do_not_launch) {
             /* if we don't want to launch, then we are just testing the system,
              * so ignore questions about support capabilities
              */
@@ -243,12 +314,7 @@ static int bind_generic(prte_job_t *jdata,
                     continue;
                 }
                 prte_show_help("help-prte-rmaps-base.txt", "rmaps:cpubind-not-supported", true, node->name);
-                hwloc_bitmap_free(totalcpuset);
-                hwloc_bitmap_free(available);
-                if (NULL != job_cpuset) {
-                    free(job_cpuset);
-                }
-                return PRTE_ERR_SILENT;
+                goto silent;
             }
             /* check if topology supports membind - have to be careful here
              * as hwloc treats this differently than I (at least) would have
@@ -266,12 +332,7 @@ static int bind_generic(prte_job_t *jdata,
                     membind_warned = true;
                 } else if (PRTE_HWLOC_BASE_MBFA_ERROR == prte_hwloc_base_mbfa) {
                     prte_show_help("help-prte-rmaps-base.txt", "rmaps:membind-not-supported-fatal", true, node->name);
-                    hwloc_bitmap_free(totalcpuset);
-                    hwloc_bitmap_free(available);
-                    if (NULL != job_cpuset) {
-                        free(job_cpuset);
-                    }
-                    return PRTE_ERR_SILENT;
+                    goto silent;
                 }
             }
         }
@@ -281,12 +342,7 @@ static int bind_generic(prte_job_t *jdata,
         if (!prte_get_attribute(&proc->attributes, PRTE_PROC_HWLOC_LOCALE, (void**)&locale, PMIX_POINTER) ||
             NULL == locale) {
             prte_show_help("help-prte-rmaps-base.txt", "rmaps:no-locale", true, PRTE_NAME_PRINT(&proc->name));
-            hwloc_bitmap_free(totalcpuset);
-            hwloc_bitmap_free(available);
-            if (NULL != job_cpuset) {
-                free(job_cpuset);
-            }
-            return PRTE_ERR_SILENT;
+            goto silent;
         }
 
         /* use the min_bound object that intersects locale->cpuset at target_depth */
@@ -314,12 +370,7 @@ static int bind_generic(prte_job_t *jdata,
         if (NULL == trg_obj) {
             /* there aren't any such targets under this object */
             prte_show_help("help-prte-rmaps-base.txt", "rmaps:no-available-cpus", true, node->name);
-            hwloc_bitmap_free(totalcpuset);
-            hwloc_bitmap_free(available);
-            if (NULL != job_cpuset) {
-                free(job_cpuset);
-            }
-            return PRTE_ERR_SILENT;
+            goto silent;
         }
         /* record the location */
         prte_set_attribute(&proc->attributes, PRTE_PROC_HWLOC_BOUND, PRTE_ATTR_LOCAL, trg_obj, PMIX_POINTER);
@@ -332,16 +383,11 @@ static int bind_generic(prte_job_t *jdata,
             if (NULL == nxt_obj) {
                 /* could not find enough cpus to meet request */
                 prte_show_help("help-prte-rmaps-base.txt", "rmaps:no-available-cpus", true, node->name);
-                hwloc_bitmap_free(totalcpuset);
-                hwloc_bitmap_free(available);
-                if (NULL != job_cpuset) {
-                    free(job_cpuset);
-                }
-                return PRTE_ERR_SILENT;
+                goto silent;
             }
             trg_obj = nxt_obj;
             /* get the number of available cpus under this location */
-            ncpus = prte_hwloc_base_get_npus(node->topology->topo, use_hwthread_cpus,
+            ncpus = prte_hwloc_base_get_npus(node->topology->topo, info->use_hwthread_cpus,
                                               available, trg_obj);
             /* track the number bound */
             if (NULL == (data = (prte_hwloc_obj_data_t*)trg_obj->userdata)) {
@@ -362,25 +408,16 @@ static int bind_generic(prte_job_t *jdata,
                     prte_show_help("help-prte-rmaps-base.txt", "rmaps:binding-overload", true,
                                    prte_hwloc_base_print_binding(map->binding), node->name,
                                    data->num_bound, ncpus);
-                    hwloc_bitmap_free(totalcpuset);
-                    hwloc_bitmap_free(available);
-                    if (NULL != job_cpuset) {
-                        free(job_cpuset);
-                    }
-                    return PRTE_ERR_SILENT;
-                } else if (1 < cpus_per_rank) {
+                    goto silent;
+                } else if (1 < info->cpus_per_rank) {
                     /* if the user specified cpus/proc, then we weren't able
                      * to meet that request - this constitutes an error that
                      * must be reported */
                     prte_show_help("help-prte-rmaps-base.txt", "insufficient-cpus-per-proc", true,
                                    prte_hwloc_base_print_binding(map->binding), node->name,
-                                   (NULL != job_cpuset) ? job_cpuset : (NULL == prte_hwloc_default_cpu_list) ? "FULL" : prte_hwloc_default_cpu_list,
-                                   cpus_per_rank);
-                    hwloc_bitmap_free(available);
-                    if (NULL != job_cpuset) {
-                        free(job_cpuset);
-                    }
-                    return PRTE_ERR_SILENT;
+                                   (NULL != info->job_cpuset) ? info->job_cpuset : (NULL == prte_hwloc_default_cpu_list) ? "FULL" : prte_hwloc_default_cpu_list,
+                                   info->cpus_per_rank);
+                    goto silent;
                 } else {
                     /* if we have the default binding policy, then just don't bind */
                     prte_output_verbose(5, prte_rmaps_base_framework.framework_output,
@@ -388,10 +425,8 @@ static int bind_generic(prte_job_t *jdata,
                                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME));
                     PRTE_SET_BINDING_POLICY(map->binding, PRTE_BIND_TO_NONE);
                     unbind_procs(jdata);
-                    hwloc_bitmap_free(totalcpuset);
-                    hwloc_bitmap_free(available);
-                    if (NULL != job_cpuset) {
-                        free(job_cpuset);
+                    if (NULL != info->job_cpuset && 0 > node->topology->index) {
+                        hwloc_bitmap_free(available);
                     }
                     return PRTE_SUCCESS;
                 }
@@ -402,7 +437,7 @@ static int bind_generic(prte_job_t *jdata,
             total_cpus += ncpus;
             /* move to the next location, in case we need it */
             nxt_obj = trg_obj->next_cousin;
-        } while (total_cpus < cpus_per_rank);
+        } while (total_cpus < info->cpus_per_rank);
         hwloc_bitmap_list_asprintf(&cpu_bitmap, totalcpuset);
         prte_output_verbose(5, prte_rmaps_base_framework.framework_output,
                             "%s PROC %s BITMAP %s",
@@ -414,7 +449,7 @@ static int bind_generic(prte_job_t *jdata,
         }
         if (4 < prte_output_get_verbosity(prte_rmaps_base_framework.framework_output)) {
             char *tmp1;
-            tmp1 = prte_hwloc_base_cset2str(totalcpuset, use_hwthread_cpus, node->topology->topo);
+            tmp1 = prte_hwloc_base_cset2str(totalcpuset, info->use_hwthread_cpus, node->topology->topo);
             prte_output(prte_rmaps_base_framework.framework_output,
                         "%s BOUND PROC %s[%s] TO %s",
                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
@@ -422,13 +457,16 @@ static int bind_generic(prte_job_t *jdata,
             free(tmp1);
         }
     }
-    hwloc_bitmap_free(totalcpuset);
-    hwloc_bitmap_free(available);
-    if (NULL != job_cpuset) {
-        free(job_cpuset);
+    if (NULL != info->job_cpuset && 0 > node->topology->index) {
+        hwloc_bitmap_free(available);
     }
-
     return PRTE_SUCCESS;
+
+  silent:
+    if (NULL != info->job_cpuset && 0 > node->topology->index) {
+        hwloc_bitmap_free(available);
+    }
+    return PRTE_ERR_SILENT;
 }
 
 static int bind_in_place(prte_job_t *jdata,
@@ -560,7 +598,7 @@ static int bind_in_place(prte_job_t *jdata,
          * to save space, so we need to reset the usage info to reflect
          * our own current state
          */
-        reset_usage(node, jdata->nspace);
+        reset_usage(node, jdata->nspace, NULL);
         /* get the available processors on this node */
         root = hwloc_get_root_obj(node->topology->topo);
         if (NULL == root->userdata) {
@@ -868,7 +906,7 @@ static int bind_to_cpuset(prte_job_t *jdata)
             hwloc_bitmap_free(mycpuset);
             return PRTE_ERR_NOT_FOUND;
         }
-        reset_usage(node, jdata->nspace);
+        reset_usage(node, jdata->nspace, NULL);
         hwloc_bitmap_zero(mycpuset);
 
         /* filter the node-available cpus against the specified "soft" cgroup */
@@ -938,7 +976,7 @@ int prte_rmaps_base_compute_bindings(prte_job_t *jdata)
     int i, rc;
     struct hwloc_topology_support *support;
     int bind_depth;
-    bool dobind;
+    bind_info_t info;
 
     prte_output_verbose(5, prte_rmaps_base_framework.framework_output,
                         "mca:rmaps: compute bindings for job %s with policy %s[%x]",
@@ -1030,22 +1068,17 @@ int prte_rmaps_base_compute_bindings(prte_job_t *jdata)
                         "mca:rmaps: computing bindings for job %s",
                         PRTE_JOBID_PRINT(jdata->nspace));
 
-    dobind = false;
-    if (prte_get_attribute(&jdata->attributes, PRTE_JOB_DO_NOT_LAUNCH, NULL, PMIX_BOOL) ||
-        prte_get_attribute(&jdata->attributes, PRTE_JOB_DISPLAY_MAP, NULL, PMIX_BOOL) ||
-        prte_get_attribute(&jdata->attributes, PRTE_JOB_DISPLAY_DEVEL_MAP, NULL, PMIX_BOOL) ||
-        prte_get_attribute(&jdata->attributes, PRTE_JOB_DISPLAY_DIFF, NULL, PMIX_BOOL)) {
-        dobind = true;
-    }
+    bind_info_setup(jdata, &info);
+    rc = PRTE_SUCCESS;
 
     for (i=0; i < jdata->map->nodes->size; i++) {
         if (NULL == (node = (prte_node_t*)prte_pointer_array_get_item(jdata->map->nodes, i))) {
             continue;
         }
-        if ((int)PRTE_PROC_MY_NAME->rank != node->index && !dobind) {
+        if ((int)PRTE_PROC_MY_NAME->rank != node->index && !info.dobind) {
             continue;
         }
-        if (!prte_get_attribute(&jdata->attributes, PRTE_JOB_DO_NOT_LAUNCH, NULL, PMIX_BOOL)) {
+        if (!info.do_not_launch) {
             /* if we don't want to launch, then we are just testing the system,
              * so ignore questions about support capabilities
              */
@@ -1063,7 +1096,8 @@ int prte_rmaps_base_compute_bindings(prte_job_t *jdata)
                     continue;
                 }
                 prte_show_help("help-prte-rmaps-base.txt", "rmaps:cpubind-not-supported", true, node->name);
-                return PRTE_ERR_SILENT;
+                rc = PRTE_ERR_SILENT;
+                break;
             }
             /* check if topology supports membind - have to be careful here
              * as hwloc treats this differently than I (at least) would have
@@ -1081,7 +1115,8 @@ int prte_rmaps_base_compute_bindings(prte_job_t *jdata)
                     membind_warned = true;
                 } else if (PRTE_HWLOC_BASE_MBFA_ERROR == prte_hwloc_base_mbfa) {
                     prte_show_help("help-prte-rmaps-base.txt", "rmaps:membind-not-supported-fatal", true, node->name);
-                    return PRTE_ERR_SILENT;
+                    rc = PRTE_ERR_SILENT;
+                    break;
                 }
             }
         }
@@ -1118,17 +1153,19 @@ int prte_rmaps_base_compute_bindings(prte_job_t *jdata)
             /* didn't find such an object */
             prte_show_help("help-prte-rmaps-base.txt", "prte-rmaps-base:no-objects",
                            true, hwloc_obj_type_string(hwb), node->name);
-            return PRTE_ERR_SILENT;
+            rc = PRTE_ERR_SILENT;
+            break;
         }
         prte_output_verbose(5, prte_rmaps_base_framework.framework_output,
                             "%s bind_depth: %d",
                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                             bind_depth);
-        if (PRTE_SUCCESS != (rc = bind_generic(jdata, node, bind_depth))) {
+        if (PRTE_SUCCESS != (rc = bind_generic(jdata, node, bind_depth, &info))) {
             PRTE_ERROR_LOG(rc);
-            return rc;
+            break;
         }
     }
 
-    return PRTE_SUCCESS;
+    bind_info_teardown(&info);
+    return rc;
 }
@@ -59,6 +59,7 @@ prte_rmaps_base_t prte_rmaps_base = {{{0}}};
 static char *rmaps_base_mapping_policy = NULL;
 static char *rmaps_base_ranking_policy = NULL;
 static bool rmaps_base_inherit = false;
+static bool rmaps_base_report_timing = false;
 
 static int prte_rmaps_base_register(prte_mca_base_register_flag_t flags)
 {
@@ -94,6 +95,14 @@ static int prte_rmaps_base_register(prte_mca_base_register_flag_t flags)
                                        PRTE_INFO_LVL_9,
                                        PRTE_MCA_BASE_VAR_SCOPE_READONLY, &rmaps_base_inherit);
 
+    rmaps_base_report_timing = false;
+    (void) prte_mca_base_var_register("prte", "rmaps", "base", "report_timing",
+                                       "Report the time spent in each phase of mapping a job (map, vpids, "
+                                       "local ranks, bindings) along with the peak RSS of the mapping daemon",
+                                       PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE,
+                                       PRTE_INFO_LVL_9,
+                                       PRTE_MCA_BASE_VAR_SCOPE_READONLY, &rmaps_base_report_timing);
+
     return PRTE_SUCCESS;
 }
 
@@ -124,6 +133,7 @@ static int prte_rmaps_base_open(prte_mca_base_open_flag_t flags)
     prte_rmaps_base.ranking = 0;
     prte_rmaps_base.inherit = rmaps_base_inherit;
     prte_rmaps_base.hwthread_cpus = false;
+    prte_rmaps_base.report_timing = rmaps_base_report_timing;
     if (NULL == prte_set_slots) {
         prte_set_slots = strdup("core");
     }
@@ -29,6 +29,12 @@
 #include "constants.h"
 
 #include <string.h>
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+#ifdef HAVE_SYS_RESOURCE_H
+#include <sys/resource.h>
+#endif
 
 #include "src/mca/mca.h"
 #include "src/util/argv.h"
@@ -48,6 +54,63 @@
 #include "src/mca/rmaps/base/rmaps_private.h"
 
 
+/* points at which we sample the clock when reporting mapping times */
+typedef enum {
+    PRTE_RMAPS_TIME_START,
+    PRTE_RMAPS_TIME_MAPPED,
+    PRTE_RMAPS_TIME_VPIDS,
+    PRTE_RMAPS_TIME_LOCAL_RANKS,
+    PRTE_RMAPS_TIME_BINDINGS,
+    PRTE_RMAPS_TIME_MAX
+} prte_rmaps_time_t;
+
+static void mark_time(struct timeval *marks, prte_rmaps_time_t t)
+{
+    if (prte_rmaps_base.report_timing) {
+        gettimeofday(&marks[t], NULL);
+    }
+}
+
+static double time_delta(struct timeval *marks, prte_rmaps_time_t from, prte_rmaps_time_t to)
+{
+    /* phases that were not executed for this job report zero */
+    if ((0 == marks[from].tv_sec && 0 == marks[from].tv_usec) ||
+        (0 == marks[to].tv_sec && 0 == marks[to].tv_usec)) {
+        return 0.0;
+    }
+    return (double)(marks[to].tv_sec - marks[from].tv_sec) +
+           (double)(marks[to].tv_usec - marks[from].tv_usec) / 1000000.0;
+}
+
+/* emit a single line of key=value pairs so that scaling scripts
+ * (see contrib/scaling/mapping.pl) can parse it */
+static void report_times(prte_job_t *jdata, struct timeval *marks)
+{
+    long maxrss = 0;
+#ifdef HAVE_SYS_RESOURCE_H
+    struct rusage usage;
+
+    if (0 == getrusage(RUSAGE_SELF, &usage)) {
+        maxrss = usage.ru_maxrss;
+    }
+#endif
+
+    prte_output(0, "%s rmaps:base:timing job=%s mapper=%s policy=%s nodes=%d procs=%lu "
+                "map=%.6f vpids=%.6f local_ranks=%.6f bindings=%.6f total=%.6f maxrss_kb=%ld",
+                PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_JOBID_PRINT(jdata->nspace),
+                (NULL == jdata->map->last_mapper) ? "none" : jdata->map->last_mapper,
+                prte_rmaps_base_print_mapping(jdata->map->mapping),
+                (int)jdata->map->num_nodes, (unsigned long)jdata->num_procs,
+                time_delta(marks, PRTE_RMAPS_TIME_START, PRTE_RMAPS_TIME_MAPPED),
+                time_delta(marks, PRTE_RMAPS_TIME_MAPPED, PRTE_RMAPS_TIME_VPIDS),
+                time_delta(marks, PRTE_RMAPS_TIME_VPIDS, PRTE_RMAPS_TIME_LOCAL_RANKS),
+                time_delta(marks, PRTE_RMAPS_TIME_LOCAL_RANKS, PRTE_RMAPS_TIME_BINDINGS),
+                time_delta(marks, PRTE_RMAPS_TIME_START,
+                           (0 == marks[PRTE_RMAPS_TIME_BINDINGS].tv_sec) ? PRTE_RMAPS_TIME_VPIDS
+                                                                         : PRTE_RMAPS_TIME_BINDINGS),
+                maxrss);
+}
+
 void prte_rmaps_base_map_job(int fd, short args, void *cbdata)
 {
     prte_state_caddy_t *caddy = (prte_state_caddy_t*)cbdata;
@@ -67,8 +130,10 @@ void prte_rmaps_base_map_job(int fd, short args, void *cbdata)
     bool use_hwthreads = false;
     bool sequential = false;
     int32_t slots;
+    struct timeval marks[PRTE_RMAPS_TIME_MAX];
 
     PRTE_ACQUIRE_OBJECT(caddy);
+    memset(marks, 0, sizeof(marks));
     jdata = caddy->jdata;
 
     jdata->state = PRTE_JOB_STATE_MAP;
@@ -483,6 +548,7 @@ compute:
      * the job
      */
     did_map = false;
+    mark_time(marks, PRTE_RMAPS_TIME_START);
     if (1 == prte_list_get_size(&prte_rmaps_base.selected_modules)) {
         /* forced selection */
         mod = (prte_rmaps_base_selected_module_t*)prte_list_get_first(&prte_rmaps_base.selected_modules);
@@ -538,12 +604,14 @@ compute:
 
     /* compute the ranks and add the proc objects
      * to the jdata->procs array */
+    mark_time(marks, PRTE_RMAPS_TIME_MAPPED);
     if (PRTE_SUCCESS != (rc = prte_rmaps_base_compute_vpids(jdata))) {
         PRTE_ERROR_LOG(rc);
         jdata->exit_code = rc;
         PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_MAP_FAILED);
         goto cleanup;
     }
+    mark_time(marks, PRTE_RMAPS_TIME_VPIDS);
 
     if (prte_get_attribute(&jdata->attributes, PRTE_JOB_DO_NOT_LAUNCH, NULL, PMIX_BOOL) ||
         prte_get_attribute(&jdata->attributes, PRTE_JOB_DISPLAY_MAP, NULL, PMIX_BOOL) ||
@@ -556,6 +624,7 @@ compute:
             PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_MAP_FAILED);
             goto cleanup;
         }
+        mark_time(marks, PRTE_RMAPS_TIME_LOCAL_RANKS);
         /* compute and save bindings */
         if (PRTE_SUCCESS != (rc = prte_rmaps_base_compute_bindings(jdata))) {
             PRTE_ERROR_LOG(rc);
@@ -563,6 +632,7 @@ compute:
             PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_MAP_FAILED);
             goto cleanup;
         }
+        mark_time(marks, PRTE_RMAPS_TIME_BINDINGS);
     } else if (prte_get_attribute(&jdata->attributes, PRTE_JOB_FULLY_DESCRIBED, NULL, PMIX_BOOL)) {
         /* compute and save local ranks */
         if (PRTE_SUCCESS != (rc = prte_rmaps_base_compute_local_ranks(jdata))) {
@@ -571,6 +641,7 @@ compute:
             PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_MAP_FAILED);
             goto cleanup;
         }
+        mark_time(marks, PRTE_RMAPS_TIME_LOCAL_RANKS);
 
         /* compute and save bindings */
         if (PRTE_SUCCESS != (rc = prte_rmaps_base_compute_bindings(jdata))) {
@@ -579,6 +650,7 @@ compute:
             PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_MAP_FAILED);
             goto cleanup;
         }
+        mark_time(marks, PRTE_RMAPS_TIME_BINDINGS);
     }
 
     /* set the offset so shared memory components can potentially
@@ -602,6 +674,10 @@ compute:
         prte_rmaps_base_display_map(jdata);
     }
 
+    if (prte_rmaps_base.report_timing) {
+        report_times(jdata, marks);
+    }
+
     /* set the job state to the next position */
     PRTE_ACTIVATE_JOB_STATE(jdata, PRTE_JOB_STATE_MAP_COMPLETE);
 
@@ -46,6 +46,8 @@
 
 #include "src/mca/mca.h"
 #include "src/class/prte_pointer_array.h"
+#include "src/class/prte_hash_table.h"
+#include "src/sys/atomic.h"
 
 #include "src/runtime/prte_globals.h"
 #include "src/mca/routed/routed.h"
@@ -68,9 +70,17 @@ PRTE_EXPORT int prte_rml_base_select(void);
 
 /* a global struct containing framework-level values */
 typedef struct {
-    prte_list_t posted_recvs;
-    prte_list_t unmatched_msgs;
+    /* recvs and unmatched msgs are held per tag - the slots
+     * for the reserved tags are indexed directly by tag, while
+     * those for tags beyond PRTE_RML_TAG_MAX are hashed */
+    prte_pointer_array_t tags;
+    prte_hash_table_t dyn_tags;
     int max_retries;
+    /* bytes handled by each send path */
+    prte_atomic_size_t bytes_copied;    // copied by send_buffer_nb
+    prte_atomic_size_t bytes_self;      // copied for delivery to ourselves
+    prte_atomic_size_t bytes_moved;     // taken over by send_transfer_nb
+    prte_atomic_size_t bytes_shared;    // sent from a shared payload
 } prte_rml_base_t;
 PRTE_EXPORT extern prte_rml_base_t prte_rml_base;
 
@@ -90,6 +100,9 @@ typedef struct {
 
     /* data buffer */
     pmix_data_buffer_t dbuf;
+    /* shared payload, if any - when set, dbuf refers to
+     * the payload's data and does not own it */
+    prte_rml_payload_t *payload;
     /* msg seq number */
     uint32_t seq_num;
 } prte_rml_send_t;
@@ -125,6 +138,20 @@ typedef struct {
 } prte_rml_posted_recv_t;
 PRTE_CLASS_DECLARATION(prte_rml_posted_recv_t);
 
+/* the recvs posted for, and msgs waiting on, a single tag. Nearly
+ * all recvs accept any sender, so those are held separately from
+ * recvs for specific peers and can be matched without comparing
+ * names. The system does not allow a wildcard recv to coexist
+ * with a recv for a specific peer on the same tag */
+typedef struct {
+    prte_object_t super;
+    prte_rml_tag_t tag;
+    prte_rml_posted_recv_t *wildcard;   // recv posted for any sender
+    prte_list_t posted;                 // recvs posted for specific peers
+    prte_list_t unmatched;              // msgs awaiting a matching recv
+} prte_rml_tag_slot_t;
+PRTE_CLASS_DECLARATION(prte_rml_tag_slot_t);
+
 /* define an object for transferring recv requests to the list of posted recvs */
 typedef struct {
     prte_object_t super;
@@ -60,7 +60,33 @@ static int prte_rml_base_register(prte_mca_base_register_flag_t flags)
 
 static int prte_rml_base_close(void)
 {
-    PRTE_LIST_DESTRUCT(&prte_rml_base.posted_recvs);
+    prte_rml_tag_slot_t *slot;
+    uint32_t key;
+    void *node;
+    int n;
+
+    prte_output_verbose(1, prte_rml_base_framework.framework_output,
+                        "%s rml:base:send bytes copied=%lu self=%lu moved=%lu shared=%lu",
+                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                        (unsigned long)prte_rml_base.bytes_copied,
+                        (unsigned long)prte_rml_base.bytes_self,
+                        (unsigned long)prte_rml_base.bytes_moved,
+                        (unsigned long)prte_rml_base.bytes_shared);
+
+    for (n=0; n < prte_rml_base.tags.size; n++) {
+        if (NULL != (slot = (prte_rml_tag_slot_t*)prte_pointer_array_get_item(&prte_rml_base.tags, n))) {
+            PRTE_RELEASE(slot);
+        }
+    }
+    PRTE_DESTRUCT(&prte_rml_base.tags);
+    if (PRTE_SUCCESS == prte_hash_table_get_first_key_uint32(&prte_rml_base.dyn_tags, &key,
+                                                             (void**)&slot, &node)) {
+        do {
+            PRTE_RELEASE(slot);
+        } while (PRTE_SUCCESS == prte_hash_table_get_next_key_uint32(&prte_rml_base.dyn_tags, &key,
+                                                                     (void**)&slot, node, &node));
+    }
+    PRTE_DESTRUCT(&prte_rml_base.dyn_tags);
     return prte_mca_base_framework_components_close(&prte_rml_base_framework, NULL);
 }
 
@@ -68,8 +94,14 @@ static int prte_rml_base_open(prte_mca_base_open_flag_t flags)
 {
     /* Initialize globals */
     /* construct object for holding the active plugin modules */
-    PRTE_CONSTRUCT(&prte_rml_base.posted_recvs, prte_list_t);
-    PRTE_CONSTRUCT(&prte_rml_base.unmatched_msgs, prte_list_t);
+    PRTE_CONSTRUCT(&prte_rml_base.tags, prte_pointer_array_t);
+    prte_pointer_array_init(&prte_rml_base.tags, PRTE_RML_TAG_MAX, PRTE_RML_TAG_MAX, 8);
+    PRTE_CONSTRUCT(&prte_rml_base.dyn_tags, prte_hash_table_t);
+    prte_hash_table_init(&prte_rml_base.dyn_tags, 32);
+    prte_rml_base.bytes_copied = 0;
+    prte_rml_base.bytes_self = 0;
+    prte_rml_base.bytes_moved = 0;
+    prte_rml_base.bytes_shared = 0;
 
     /* Open up all available components */
     return prte_mca_base_framework_components_open(&prte_rml_base_framework, flags);
@@ -167,10 +199,16 @@ static void send_cons(prte_rml_send_t *ptr)
     ptr->retries = 0;
     ptr->cbdata = NULL;
     PMIX_DATA_BUFFER_CONSTRUCT(&ptr->dbuf);
+    ptr->payload = NULL;
     ptr->seq_num = 0xFFFFFFFF;
 }
 static void send_des(prte_rml_send_t *ptr)
 {
+    if (NULL != ptr->payload) {
+        /* the data belongs to the payload */
+        PMIX_DATA_BUFFER_CONSTRUCT(&ptr->dbuf);
+        PRTE_RELEASE(ptr->payload);
+    }
     PMIX_DATA_BUFFER_DESTRUCT(&ptr->dbuf);
 }
 PRTE_CLASS_INSTANCE(prte_rml_send_t,
@@ -214,6 +252,17 @@ static void rcv_des(prte_rml_recv_cb_t *ptr)
 PRTE_CLASS_INSTANCE(prte_rml_recv_cb_t, prte_object_t,
                    rcv_cons, rcv_des);
 
+static void pld_cons(prte_rml_payload_t *ptr)
+{
+    PMIX_DATA_BUFFER_CONSTRUCT(&ptr->data);
+}
+static void pld_des(prte_rml_payload_t *ptr)
+{
+    PMIX_DATA_BUFFER_DESTRUCT(&ptr->data);
+}
+PRTE_CLASS_INSTANCE(prte_rml_payload_t, prte_object_t,
+                   pld_cons, pld_des);
+
 static void prcv_cons(prte_rml_posted_recv_t *ptr)
 {
     ptr->cbdata = NULL;
@@ -222,6 +271,25 @@ PRTE_CLASS_INSTANCE(prte_rml_posted_recv_t,
                    prte_list_item_t,
                    prcv_cons, NULL);
 
+static void slot_cons(prte_rml_tag_slot_t *ptr)
+{
+    ptr->tag = PRTE_RML_TAG_INVALID;
+    ptr->wildcard = NULL;
+    PRTE_CONSTRUCT(&ptr->posted, prte_list_t);
+    PRTE_CONSTRUCT(&ptr->unmatched, prte_list_t);
+}
+static void slot_des(prte_rml_tag_slot_t *ptr)
+{
+    if (NULL != ptr->wildcard) {
+        PRTE_RELEASE(ptr->wildcard);
+    }
+    PRTE_LIST_DESTRUCT(&ptr->posted);
+    PRTE_LIST_DESTRUCT(&ptr->unmatched);
+}
+PRTE_CLASS_INSTANCE(prte_rml_tag_slot_t,
+                   prte_object_t,
+                   slot_cons, slot_des);
+
 static void prq_cons(prte_rml_recv_request_t *ptr)
 {
     ptr->cancel = false;
@@ -52,13 +52,41 @@
 #include "src/mca/rml/base/rml_contact.h"
 
 
-static void msg_match_recv(prte_rml_posted_recv_t *rcv, bool get_all);
+static void msg_match_recv(prte_rml_tag_slot_t *slot,
+                           prte_rml_posted_recv_t *rcv, bool get_all);
 
+/* a recv that will accept a message from any sender */
+#define PRTE_RML_ANY_SENDER(p)                  \
+    ('\0' == (p)->nspace[0] && PMIX_RANK_WILDCARD == (p)->rank)
+
+/* find the slot for a tag, creating it if requested */
+static prte_rml_tag_slot_t* get_slot(prte_rml_tag_t tag, bool create)
+{
+    prte_rml_tag_slot_t *slot = NULL;
+
+    if (tag < PRTE_RML_TAG_MAX) {
+        slot = (prte_rml_tag_slot_t*)prte_pointer_array_get_item(&prte_rml_base.tags, tag);
+    } else if (PRTE_SUCCESS != prte_hash_table_get_value_uint32(&prte_rml_base.dyn_tags, tag,
+                                                                (void**)&slot)) {
+        slot = NULL;
+    }
+    if (NULL == slot && create) {
+        slot = PRTE_NEW(prte_rml_tag_slot_t);
+        slot->tag = tag;
+        if (tag < PRTE_RML_TAG_MAX) {
+            prte_pointer_array_set_item(&prte_rml_base.tags, tag, slot);
+        } else {
+            prte_hash_table_set_value_uint32(&prte_rml_base.dyn_tags, tag, slot);
+        }
+    }
+    return slot;
+}
 
 void prte_rml_base_post_recv(int sd, short args, void *cbdata)
 {
     prte_rml_recv_request_t *req = (prte_rml_recv_request_t*)cbdata;
     prte_rml_posted_recv_t *post, *recv;
+    prte_rml_tag_slot_t *slot;
 
     PRTE_ACQUIRE_OBJECT(req);
 
@@ -79,60 +107,86 @@ void prte_rml_base_post_recv(int sd, short args, void *cbdata)
      * and remove it from our list
      */
     if (req->cancel) {
-        PRTE_LIST_FOREACH(recv, &prte_rml_base.posted_recvs, prte_rml_posted_recv_t) {
-            if (PMIX_CHECK_PROCID(&post->peer, &recv->peer) &&
-                post->tag == recv->tag) {
+        if (NULL != (slot = get_slot(post->tag, false))) {
+            if (NULL != slot->wildcard &&
+                PMIX_CHECK_PROCID(&post->peer, &slot->wildcard->peer)) {
                 prte_output_verbose(5, prte_rml_base_framework.framework_output,
-                                    "%s canceling recv %d for peer %s",
-                                    PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                    post->tag, PRTE_NAME_PRINT(&recv->peer));
-                /* got a match - remove it */
-                prte_list_remove_item(&prte_rml_base.posted_recvs, &recv->super);
-                PRTE_RELEASE(recv);
-                break;
+                                    "%s canceling recv %d for any peer",
+                                    PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), post->tag);
+                PRTE_RELEASE(slot->wildcard);
+                slot->wildcard = NULL;
+            } else {
+                PRTE_LIST_FOREACH(recv, &slot->posted, prte_rml_posted_recv_t) {
+                    if (PMIX_CHECK_PROCID(&post->peer, &recv->peer)) {
+                        prte_output_verbose(5, prte_rml_base_framework.framework_output,
+                                            "%s canceling recv %d for peer %s",
+                                            PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                                            post->tag, PRTE_NAME_PRINT(&recv->peer));
+                        /* got a match - remove it */
+                        prte_list_remove_item(&slot->posted, &recv->super);
+                        PRTE_RELEASE(recv);
+                        break;
+                    }
+                }
             }
         }
         PRTE_RELEASE(req);
         return;
     }
 
+    slot = get_slot(post->tag, true);
+
     /* bozo check - cannot have two receives for the same peer/tag combination */
-    PRTE_LIST_FOREACH(recv, &prte_rml_base.posted_recvs, prte_rml_posted_recv_t) {
-        if (PMIX_CHECK_PROCID(&post->peer, &recv->peer) &&
-            post->tag == recv->tag) {
-            prte_output(0, "%s TWO RECEIVES WITH SAME PEER %s AND TAG %d - ABORTING",
-                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                        PRTE_NAME_PRINT(&post->peer), post->tag);
-            abort();
+    recv = slot->wildcard;
+    if (NULL == recv) {
+        PRTE_LIST_FOREACH(recv, &slot->posted, prte_rml_posted_recv_t) {
+            if (PMIX_CHECK_PROCID(&post->peer, &recv->peer)) {
+                break;
+            }
+        }
+        if (recv == (prte_rml_posted_recv_t*)prte_list_get_end(&slot->posted)) {
+            recv = NULL;
         }
     }
+    if (NULL != recv) {
+        prte_output(0, "%s TWO RECEIVES WITH SAME PEER %s AND TAG %d - ABORTING",
+                    PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                    PRTE_NAME_PRINT(&post->peer), post->tag);
+        abort();
+    }
 
     prte_output_verbose(5, prte_rml_base_framework.framework_output,
                         "%s posting %s recv on tag %d for peer %s",
                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                         (post->persistent) ? "persistent" : "non-persistent",
                         post->tag, PRTE_NAME_PRINT(&post->peer));
-    /* add it to the list of recvs */
-    prte_list_append(&prte_rml_base.posted_recvs, &post->super);
+    /* add it to the recvs for this tag */
+    if (PRTE_RML_ANY_SENDER(&post->peer)) {
+        slot->wildcard = post;
+    } else {
+        prte_list_append(&slot->posted, &post->super);
+    }
     req->post = NULL;
     /* handle any messages that may have already arrived for this recv */
-    msg_match_recv(post, post->persistent);
+    msg_match_recv(slot, post, post->persistent);
 
     /* cleanup */
     PRTE_RELEASE(req);
 }
 
-static void msg_match_recv(prte_rml_posted_recv_t *rcv, bool get_all)
+static void msg_match_recv(prte_rml_tag_slot_t *slot,
+                           prte_rml_posted_recv_t *rcv, bool get_all)
 {
     prte_list_item_t *item, *next;
     prte_rml_recv_t *msg;
+    bool any = PRTE_RML_ANY_SENDER(&rcv->peer);
 
-    /* scan thru the list of unmatched recvd messages and
-     * see if any matches this spec - if so, push the first
+    /* scan thru the unmatched msgs for this tag and see
+     * if any matches this spec - if so, push the first
      * into the recvd msg queue and look no further
      */
-    item = prte_list_get_first(&prte_rml_base.unmatched_msgs);
-    while (item != prte_list_get_end(&prte_rml_base.unmatched_msgs)) {
+    item = prte_list_get_first(&slot->unmatched);
+    while (item != prte_list_get_end(&slot->unmatched)) {
         next = prte_list_get_next(item);
         msg = (prte_rml_recv_t*)item;
         prte_output_verbose(5, prte_rml_base_framework.framework_output,
@@ -144,10 +198,9 @@ static void msg_match_recv(prte_rml_posted_recv_t *rcv, bool get_all)
         /* since names could include wildcards, must use
          * the more generalized comparison function
          */
-        if (PMIX_CHECK_PROCID(&msg->sender, &rcv->peer) &&
-            msg->tag == rcv->tag) {
+        if (any || PMIX_CHECK_PROCID(&msg->sender, &rcv->peer)) {
+            prte_list_remove_item(&slot->unmatched, item);
             PRTE_RML_ACTIVATE_MESSAGE(msg);
-            prte_list_remove_item(&prte_rml_base.unmatched_msgs, item);
             if (!get_all) {
                 break;
             }
@@ -160,6 +213,7 @@ void prte_rml_base_process_msg(int fd, short flags, void *cbdata)
 {
     prte_rml_recv_t *msg = (prte_rml_recv_t*)cbdata;
     prte_rml_posted_recv_t *post;
+    prte_rml_tag_slot_t *slot;
 
     PRTE_ACQUIRE_OBJECT(msg);
 
@@ -197,41 +251,49 @@ void prte_rml_base_process_msg(int fd, short flags, void *cbdata)
     }
 
     /* see if we have a waiting recv for this message */
-    PRTE_LIST_FOREACH(post, &prte_rml_base.posted_recvs, prte_rml_posted_recv_t) {
-        /* since names could include wildcards, must use
-         * the more generalized comparison function
-         */
-        if (PMIX_CHECK_PROCID(&msg->sender, &post->peer) &&
-            msg->tag == post->tag) {
-            /* deliver the data to this location */
-            post->cbfunc(PRTE_SUCCESS, &msg->sender, &msg->dbuf, msg->tag, post->cbdata);
-            /* the user must have unloaded the buffer if they wanted
-             * to retain ownership of it, so release whatever remains
+    slot = get_slot(msg->tag, true);
+    post = slot->wildcard;
+    if (NULL == post) {
+        PRTE_LIST_FOREACH(post, &slot->posted, prte_rml_posted_recv_t) {
+            /* since names could include wildcards, must use
+             * the more generalized comparison function
              */
-            PRTE_OUTPUT_VERBOSE((5, prte_rml_base_framework.framework_output,
-                                 "%s message received %"PRIsize_t" bytes from %s for tag %d called callback",
-                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                 msg->dbuf.bytes_used,
-                                 PRTE_NAME_PRINT(&msg->sender),
-                                 msg->tag));
-            /* release the message */
-            PRTE_RELEASE(msg);
-            PRTE_OUTPUT_VERBOSE((5, prte_rml_base_framework.framework_output,
-                                 "%s message tag %d on released",
-                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                 post->tag));
-            /* if the recv is non-persistent, remove it */
-            if (!post->persistent) {
-                prte_list_remove_item(&prte_rml_base.posted_recvs, &post->super);
-                /*PRTE_OUTPUT_VERBOSE((5, prte_rml_base_framework.framework_output,
-                                     "%s non persistent recv %p remove success releasing now",
-                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                     post));*/
-                PRTE_RELEASE(post);
-
+            if (PMIX_CHECK_PROCID(&msg->sender, &post->peer)) {
+                break;
             }
-            return;
         }
+        if (post == (prte_rml_posted_recv_t*)prte_list_get_end(&slot->posted)) {
+            post = NULL;
+        }
+    }
+    if (NULL != post) {
+        /* deliver the data to this location */
+        post->cbfunc(PRTE_SUCCESS, &msg->sender, &msg->dbuf, msg->tag, post->cbdata);
+        /* the user must have unloaded the buffer if they wanted
+         * to retain ownership of it, so release whatever remains
+         */
+        PRTE_OUTPUT_VERBOSE((5, prte_rml_base_framework.framework_output,
+                             "%s message received %"PRIsize_t" bytes from %s for tag %d called callback",
+                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                             msg->dbuf.bytes_used,
+                             PRTE_NAME_PRINT(&msg->sender),
+                             msg->tag));
+        /* release the message */
+        PRTE_RELEASE(msg);
+        PRTE_OUTPUT_VERBOSE((5, prte_rml_base_framework.framework_output,
+                             "%s message tag %d on released",
+                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                             post->tag));
+        /* if the recv is non-persistent, remove it */
+        if (!post->persistent) {
+            if (post == slot->wildcard) {
+                slot->wildcard = NULL;
+            } else {
+                prte_list_remove_item(&slot->posted, &post->super);
+            }
+            PRTE_RELEASE(post);
+        }
+        return;
     }
     /* we get here if no matching recv was found - we then hold
      * the message until such a recv is issued
@@ -241,5 +303,5 @@ void prte_rml_base_process_msg(int fd, short flags, void *cbdata)
                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                             PRTE_NAME_PRINT(&msg->sender),
                             msg->tag));
-     prte_list_append(&prte_rml_base.unmatched_msgs, &msg->super);
+     prte_list_append(&slot->unmatched, &msg->super);
 }
@@ -54,6 +54,18 @@ int prte_rml_oob_send_buffer_nb(pmix_proc_t* peer,
                                 prte_rml_buffer_callback_fn_t cbfunc,
                                 void* cbdata);
 
+int prte_rml_oob_send_transfer_nb(pmix_proc_t* peer,
+                                  pmix_data_buffer_t* buffer,
+                                  prte_rml_tag_t tag,
+                                  prte_rml_buffer_callback_fn_t cbfunc,
+                                  void* cbdata);
+
+int prte_rml_oob_send_payload_nb(pmix_proc_t* peer,
+                                 prte_rml_payload_t* payload,
+                                 prte_rml_tag_t tag,
+                                 prte_rml_buffer_callback_fn_t cbfunc,
+                                 void* cbdata);
+
 END_C_DECLS
 
 #endif
@@ -137,6 +137,8 @@ static prte_rml_base_module_t base_module = {
     .component = (struct prte_rml_component_t*)&prte_rml_oob_component,
     .ping = oob_ping,
     .send_buffer_nb = prte_rml_oob_send_buffer_nb,
+    .send_transfer_nb = prte_rml_oob_send_transfer_nb,
+    .send_payload_nb = prte_rml_oob_send_payload_nb,
     .recv_buffer_nb = recv_buffer_nb,
     .recv_cancel = recv_cancel,
     .purge = NULL
@@ -61,20 +61,46 @@ static void send_self_exe(int fd, short args, void* data)
     PRTE_RELEASE(xfer);
 }
 
-int prte_rml_oob_send_buffer_nb(pmix_proc_t* peer,
-                                pmix_data_buffer_t* buffer,
-                                prte_rml_tag_t tag,
-                                prte_rml_buffer_callback_fn_t cbfunc,
-                                void* cbdata)
+/* move the data from the caller's buffer into one of ours */
+static pmix_status_t move_data(pmix_data_buffer_t *dest,
+                               pmix_data_buffer_t *src)
+{
+    pmix_byte_object_t bo;
+    pmix_status_t rc;
+
+    PMIX_BYTE_OBJECT_CONSTRUCT(&bo);
+    rc = PMIx_Data_unload(src, &bo);
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
+    if (NULL == bo.bytes) {
+        /* nothing to move */
+        return PMIX_SUCCESS;
+    }
+    rc = PMIx_Data_load(dest, &bo);
+    if (PMIX_SUCCESS != rc) {
+        /* give the data back so the caller's buffer is unchanged */
+        (void)PMIx_Data_load(src, &bo);
+    }
+    return rc;
+}
+
+static int send_nb(pmix_proc_t* peer,
+                   pmix_data_buffer_t* buffer,
+                   prte_rml_tag_t tag,
+                   prte_rml_buffer_callback_fn_t cbfunc,
+                   void* cbdata, bool transfer)
 {
     prte_rml_recv_t *rcv;
     prte_rml_send_t *snd;
     prte_self_send_xfer_t *xfer;
     pmix_status_t rc;
+    size_t nbytes;
 
     PRTE_OUTPUT_VERBOSE((1, prte_rml_base_framework.framework_output,
-                         "%s rml_send_buffer to peer %s at tag %d",
+                         "%s rml_send_%s to peer %s at tag %d",
                          PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                         transfer ? "transfer" : "buffer",
                          (NULL == peer) ? "NULL" : PRTE_NAME_PRINT(peer), tag));
 
     if (PRTE_RML_TAG_INVALID == tag) {
@@ -87,6 +113,7 @@ int prte_rml_oob_send_buffer_nb(pmix_proc_t* peer,
         PRTE_ERROR_LOG(PRTE_ERR_BAD_PARAM);
         return PRTE_ERR_BAD_PARAM;
     }
+    nbytes = buffer->bytes_used;
 
     /* if this is a message to myself, then just post the message
      * for receipt - no need to dive into the oob
@@ -109,32 +136,46 @@ int prte_rml_oob_send_buffer_nb(pmix_proc_t* peer,
          * message behavior. If we actually pushed the message out
          * on the wire and had it loop back, then we would receive
          * a new block of data anyway.
+         *
+         * If the caller has given us the data, then none of
+         * this applies - the data simply moves to the recv.
          */
 
-        /* setup the send callback */
-        xfer = PRTE_NEW(prte_self_send_xfer_t);
-        rc = PMIx_Data_copy_payload(&xfer->dbuf, buffer);
+        /* setup the message for the recv */
+        rcv = PRTE_NEW(prte_rml_recv_t);
+        rcv->sender = *peer;
+        rcv->tag = tag;
+        if (transfer) {
+            rc = move_data(&rcv->dbuf, buffer);
+        } else {
+            rc = PMIx_Data_copy_payload(&rcv->dbuf, buffer);
+        }
         if (PMIX_SUCCESS != rc) {
             PMIX_ERROR_LOG(rc);
-            PRTE_RELEASE(xfer);
+            PRTE_RELEASE(rcv);
             return prte_pmix_convert_status(rc);
         }
+
+        /* setup the send callback */
+        xfer = PRTE_NEW(prte_self_send_xfer_t);
+        if (!transfer) {
+            rc = PMIx_Data_copy_payload(&xfer->dbuf, buffer);
+            if (PMIX_SUCCESS != rc) {
+                PMIX_ERROR_LOG(rc);
+                PRTE_RELEASE(xfer);
+                PRTE_RELEASE(rcv);
+                return prte_pmix_convert_status(rc);
+            }
+            prte_atomic_add_fetch_size_t(&prte_rml_base.bytes_self, 2 * nbytes);
+        } else {
+            prte_atomic_add_fetch_size_t(&prte_rml_base.bytes_moved, nbytes);
+        }
         xfer->cbfunc = cbfunc;
         xfer->tag = tag;
         xfer->cbdata = cbdata;
         /* setup the event for the send callback */
         PRTE_THREADSHIFT(xfer, prte_event_base, send_self_exe, PRTE_MSG_PRI);
 
-        /* copy the message for the recv */
-        rcv = PRTE_NEW(prte_rml_recv_t);
-        rcv->sender = *peer;
-        rcv->tag = tag;
-        rc = PMIx_Data_copy_payload(&rcv->dbuf, buffer);
-        if (PMIX_SUCCESS != rc) {
-            PMIX_ERROR_LOG(rc);
-            PRTE_RELEASE(rcv);
-            return prte_pmix_convert_status(rc);
-        }
         /* post the message for receipt - since the send callback was posted
          * first and has the same priority, it will execute first
          */
@@ -146,12 +187,86 @@ int prte_rml_oob_send_buffer_nb(pmix_proc_t* peer,
     snd->dst = *peer;
     snd->origin = *PRTE_PROC_MY_NAME;
     snd->tag = tag;
-    rc = PMIx_Data_copy_payload(&snd->dbuf, buffer);
+    if (transfer) {
+        rc = move_data(&snd->dbuf, buffer);
+    } else {
+        rc = PMIx_Data_copy_payload(&snd->dbuf, buffer);
+    }
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
         PRTE_RELEASE(snd);
         return prte_pmix_convert_status(rc);
     }
+    if (transfer) {
+        prte_atomic_add_fetch_size_t(&prte_rml_base.bytes_moved, nbytes);
+    } else {
+        prte_atomic_add_fetch_size_t(&prte_rml_base.bytes_copied, nbytes);
+    }
+    snd->cbfunc = cbfunc;
+    snd->cbdata = cbdata;
+
+    /* activate the OOB send state */
+    PRTE_OOB_SEND(snd);
+
+    return PRTE_SUCCESS;
+}
+
+int prte_rml_oob_send_buffer_nb(pmix_proc_t* peer,
+                                pmix_data_buffer_t* buffer,
+                                prte_rml_tag_t tag,
+                                prte_rml_buffer_callback_fn_t cbfunc,
+                                void* cbdata)
+{
+    return send_nb(peer, buffer, tag, cbfunc, cbdata, false);
+}
+
+int prte_rml_oob_send_transfer_nb(pmix_proc_t* peer,
+                                  pmix_data_buffer_t* buffer,
+                                  prte_rml_tag_t tag,
+                                  prte_rml_buffer_callback_fn_t cbfunc,
+                                  void* cbdata)
+{
+    return send_nb(peer, buffer, tag, cbfunc, cbdata, true);
+}
+
+int prte_rml_oob_send_payload_nb(pmix_proc_t* peer,
+                                 prte_rml_payload_t* payload,
+                                 prte_rml_tag_t tag,
+                                 prte_rml_buffer_callback_fn_t cbfunc,
+                                 void* cbdata)
+{
+    prte_rml_send_t *snd;
+    pmix_data_buffer_t whole;
+
+    PRTE_OUTPUT_VERBOSE((1, prte_rml_base_framework.framework_output,
+                         "%s rml_send_payload to peer %s at tag %d",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                         (NULL == peer) ? "NULL" : PRTE_NAME_PRINT(peer), tag));
+
+    /* sends to myself and bad params are handled by the
+     * buffer send - a copy is required for the former anyway.
+     * The buffer send only copies what remains to be unpacked,
+     * and a relay may have already unpacked part of the payload,
+     * so give it a view of all the data. It is done with the
+     * view by the time it returns */
+    if (PRTE_RML_TAG_INVALID == tag || NULL == peer ||
+        PMIX_CHECK_PROCID(PRTE_NAME_INVALID, peer) ||
+        PMIX_CHECK_PROCID(peer, PRTE_PROC_MY_NAME)) {
+        whole = payload->data;
+        whole.unpack_ptr = whole.base_ptr;
+        return prte_rml_oob_send_buffer_nb(peer, &whole, tag, cbfunc, cbdata);
+    }
+
+    snd = PRTE_NEW(prte_rml_send_t);
+    snd->dst = *peer;
+    snd->origin = *PRTE_PROC_MY_NAME;
+    snd->tag = tag;
+    /* point at the shared data - the send destructor will
+     * drop our reference without touching the data */
+    prte_atomic_add_fetch_size_t(&prte_rml_base.bytes_shared, payload->data.bytes_used);
+    PRTE_RETAIN(payload);
+    snd->payload = payload;
+    snd->dbuf = payload->data;
     snd->cbfunc = cbfunc;
     snd->cbdata = cbdata;
 
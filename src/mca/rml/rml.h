@@ -64,6 +64,15 @@ typedef struct {
 } prte_rml_recv_cb_t;
 PRTE_CLASS_DECLARATION(prte_rml_recv_cb_t);
 
+/* reference-counted payload that can be handed to any number
+ * of sends without copying it - each send retains the payload
+ * until the OOB is done with it */
+typedef struct {
+    prte_object_t super;
+    pmix_data_buffer_t data;
+} prte_rml_payload_t;
+PRTE_EXPORT PRTE_CLASS_DECLARATION(prte_rml_payload_t);
+
 /* Provide a generic callback function to release buffers
  * following a non-blocking send as this happens all over
  * the code base
@@ -168,6 +177,50 @@ typedef int (*prte_rml_module_send_buffer_nb_fn_t)(pmix_proc_t* peer,
                                                    prte_rml_buffer_callback_fn_t cbfunc,
                                                    void* cbdata);
 
+/**
+ * Send a buffer non-blocking message, transferring its data
+ *
+ * Same as send_buffer_nb, except that the data in the buffer is
+ * taken over by the RML rather than copied. The buffer is left
+ * empty and still belongs to the caller, who must release or
+ * destruct it as usual - nothing more may be packed into it for
+ * this message. On error, the buffer is left untouched. For a
+ * send to self, the buffer passed to the callback function is
+ * empty as its data has already been handed to the recipient.
+ *
+ * @param[in] peer   Name of receiving process
+ * @param[in] buffer Buffer whose data is to be sent
+ * @param[in] tag    User defined tag for matching send/recv
+ * @param[in] cbfunc Callback function on message comlpetion
+ * @param[in] cbdata User data to provide during completion callback
+ */
+typedef int (*prte_rml_module_send_transfer_nb_fn_t)(pmix_proc_t* peer,
+                                                     pmix_data_buffer_t* buffer,
+                                                     prte_rml_tag_t tag,
+                                                     prte_rml_buffer_callback_fn_t cbfunc,
+                                                     void* cbdata);
+
+/**
+ * Send a shared payload non-blocking message
+ *
+ * Same as send_buffer_nb, except that the payload is retained
+ * rather than copied, so the same payload can be sent to several
+ * peers. The caller remains free to release its own reference
+ * once the call returns. The buffer passed to the callback
+ * function refers to the shared payload and must not be modified.
+ *
+ * @param[in] peer    Name of receiving process
+ * @param[in] payload Payload to be sent
+ * @param[in] tag     User defined tag for matching send/recv
+ * @param[in] cbfunc  Callback function on message comlpetion
+ * @param[in] cbdata  User data to provide during completion callback
+ */
+typedef int (*prte_rml_module_send_payload_nb_fn_t)(pmix_proc_t* peer,
+                                                    prte_rml_payload_t* payload,
+                                                    prte_rml_tag_t tag,
+                                                    prte_rml_buffer_callback_fn_t cbfunc,
+                                                    void* cbdata);
+
 /**
  * Purge the RML/OOB of contact info and pending messages
  * to/from a specified process. Used when a process aborts
@@ -217,6 +270,12 @@ typedef struct prte_rml_base_module_t {
     /** Send non-blocking buffer message */
     prte_rml_module_send_buffer_nb_fn_t          send_buffer_nb;
 
+    /** Send non-blocking buffer message without copying its data */
+    prte_rml_module_send_transfer_nb_fn_t        send_transfer_nb;
+
+    /** Send non-blocking shared payload message */
+    prte_rml_module_send_payload_nb_fn_t         send_payload_nb;
+
     prte_rml_module_recv_buffer_nb_fn_t          recv_buffer_nb;
     prte_rml_module_recv_cancel_fn_t             recv_cancel;
 
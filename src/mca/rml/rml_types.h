@@ -193,6 +193,12 @@ BEGIN_C_DECLS
 /* error propagate  */
 #define PRTE_RML_TAG_PROPAGATE              71
 
+/* jobs a daemon missed */
+#define PRTE_RML_TAG_JOB_CATALOG            72
+
+/* file positioning progress up the routing tree */
+#define PRTE_RML_TAG_FILEM_CREDIT           73
+
 #define PRTE_RML_TAG_MAX                   100
 
 
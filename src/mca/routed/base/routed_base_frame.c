@@ -94,12 +94,7 @@ int prte_routed_base_select(void)
 static void construct(prte_routed_tree_t *rt)
 {
     rt->rank = PMIX_RANK_INVALID;
-    PRTE_CONSTRUCT(&rt->relatives, prte_bitmap_t);
-}
-static void destruct(prte_routed_tree_t *rt)
-{
-    PRTE_DESTRUCT(&rt->relatives);
 }
 PRTE_CLASS_INSTANCE(prte_routed_tree_t,
                    prte_list_item_t,
-                   construct, destruct);
+                   construct, NULL);
@@ -20,7 +20,6 @@
 #include <stddef.h>
 
 #include "src/class/prte_pointer_array.h"
-#include "src/class/prte_bitmap.h"
 #include "src/util/bit_ops.h"
 #include "src/util/output.h"
 
@@ -71,6 +70,9 @@ static pmix_proc_t      local_lifeline;
 static int                      num_children;
 static prte_list_t              my_children;
 static bool                     hnp_direct=true;
+/* mask covering my rank and every bit below my high bit - the
+ * daemons below me are exactly those that match me under it */
+static int                      my_lowmask;
 
 static int init(void)
 {
@@ -157,11 +159,26 @@ static int update_route(pmix_proc_t *target,
 }
 
 
+/* the children of a daemon are formed by setting one bit above its
+ * high bit, so the daemons below us are those whose low bits match
+ * our rank, and the child leading to one of them is the one holding
+ * the lowest of its remaining bits */
+static pmix_rank_t binomial_next_hop(pmix_rank_t target)
+{
+    int rest;
+
+    if (target == PRTE_PROC_MY_NAME->rank ||
+        ((int)target & my_lowmask) != (int)PRTE_PROC_MY_NAME->rank) {
+        /* not in our branch */
+        return PRTE_PROC_MY_PARENT->rank;
+    }
+    rest = (int)target & ~my_lowmask;
+    return PRTE_PROC_MY_NAME->rank | (rest & -rest);
+}
+
 static pmix_proc_t get_route(pmix_proc_t *target)
 {
     pmix_proc_t *ret, daemon;
-    prte_list_item_t *item;
-    prte_routed_tree_t *child;
 
     if (!prte_routing_is_enabled) {
         ret = target;
@@ -213,31 +230,9 @@ static pmix_proc_t get_route(pmix_proc_t *target)
         goto found;
     }
 
-    /* search routing tree for next step to that daemon */
-    for (item = prte_list_get_first(&my_children);
-            item != prte_list_get_end(&my_children);
-            item = prte_list_get_next(item)) {
-        child = (prte_routed_tree_t*)item;
-        if (child->rank == daemon.rank) {
-            /* the child is hosting the proc - just send it there */
-            ret = &daemon;
-            goto found;
-        }
-        /* otherwise, see if the daemon we need is below the child */
-        if (prte_bitmap_is_set_bit(&child->relatives, daemon.rank)) {
-            /* yep - we need to step through this child */
-            daemon.rank = child->rank;
-
-            ret = &daemon;
-            goto found;
-        }
-    }
-
-    /* if we get here, then the target daemon is not beneath
-     * any of our children, so we have to step up through our parent
-     */
-    daemon.rank = PRTE_PROC_MY_PARENT->rank;
-
+    /* step down through the child whose branch holds that
+     * daemon, or up through our parent if none does */
+    daemon.rank = binomial_next_hop(daemon.rank);
     ret = &daemon;
 
  found:
@@ -321,94 +316,37 @@ static int set_lifeline(pmix_proc_t *proc)
     return PRTE_SUCCESS;
 }
 
-static int binomial_tree(int rank, int parent, int me, int num_procs,
-                         int *nchildren, prte_list_t *childrn,
-                         prte_bitmap_t *relatives, bool mine)
+static void binomial_tree(int rank, int num_procs,
+                          int *nchildren, prte_list_t *childrn)
 {
-    int i, bitmap, peer, hibit, mask, found;
+    int i, dim, peer, hibit, mask;
     prte_routed_tree_t *child;
-    prte_bitmap_t *relations;
 
-    PRTE_OUTPUT_VERBOSE((3, prte_routed_base_framework.framework_output,
-                         "%s routed:binomial rank %d parent %d me %d num_procs %d",
-                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                         rank, parent, me, num_procs));
-
-    /* is this me? */
-    if (me == rank) {
-        bitmap = prte_cube_dim(num_procs);
-
-        hibit = prte_hibit(rank, bitmap);
-        --bitmap;
-
-        for (i = hibit + 1, mask = 1 << i; i <= bitmap; ++i, mask <<= 1) {
-            peer = rank | mask;
-            if (peer < num_procs) {
-                child = PRTE_NEW(prte_routed_tree_t);
-                child->rank = peer;
-                PRTE_OUTPUT_VERBOSE((3, prte_routed_base_framework.framework_output,
-                                     "%s routed:binomial %d found child %s",
-                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                     rank,
-                                     PRTE_VPID_PRINT(child->rank)));
-
-                if (mine) {
-                    /* this is a direct child - add it to my list */
-                    prte_list_append(childrn, &child->super);
-                    (*nchildren)++;
-                    /* setup the relatives bitmap */
-                    prte_bitmap_init(&child->relatives, num_procs);
-
-                    /* point to the relatives */
-                    relations = &child->relatives;
-                } else {
-                    /* we are recording someone's relatives - set the bit */
-                    prte_bitmap_set_bit(relatives, peer);
-                    /* point to this relations */
-                    relations = relatives;
-                }
-                /* search for this child's relatives */
-                binomial_tree(0, 0, peer, num_procs, nchildren, childrn, relations, false);
-            }
-        }
-        return parent;
-    }
-
-    /* find the children of this rank */
-    PRTE_OUTPUT_VERBOSE((5, prte_routed_base_framework.framework_output,
-                         "%s routed:binomial find children of rank %d",
-                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), rank));
-    bitmap = prte_cube_dim(num_procs);
+    dim = prte_cube_dim(num_procs);
+    hibit = prte_hibit(rank, dim);
+    --dim;
 
-    hibit = prte_hibit(rank, bitmap);
-    --bitmap;
-
-    for (i = hibit + 1, mask = 1 << i; i <= bitmap; ++i, mask <<= 1) {
+    for (i = hibit + 1, mask = 1 << i; i <= dim; ++i, mask <<= 1) {
         peer = rank | mask;
-        PRTE_OUTPUT_VERBOSE((5, prte_routed_base_framework.framework_output,
-                             "%s routed:binomial find children checking peer %d",
-                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), peer));
         if (peer < num_procs) {
-            PRTE_OUTPUT_VERBOSE((5, prte_routed_base_framework.framework_output,
-                                 "%s routed:binomial find children computing tree",
-                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME)));
-            /* execute compute on this child */
-            if (0 <= (found = binomial_tree(peer, rank, me, num_procs, nchildren, childrn, relatives, mine))) {
-                PRTE_OUTPUT_VERBOSE((5, prte_routed_base_framework.framework_output,
-                                     "%s routed:binomial find children returning found value %d",
-                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), found));
-                return found;
-            }
+            child = PRTE_NEW(prte_routed_tree_t);
+            child->rank = peer;
+            PRTE_OUTPUT_VERBOSE((3, prte_routed_base_framework.framework_output,
+                                 "%s routed:binomial %d found child %s",
+                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                                 rank,
+                                 PRTE_VPID_PRINT(child->rank)));
+            prte_list_append(childrn, &child->super);
+            (*nchildren)++;
         }
     }
-    return -1;
 }
 
 static void update_routing_plan(void)
 {
     prte_routed_tree_t *child;
-    int j;
     prte_list_item_t *item;
+    int me, hibit;
 
     /* clear the list of children if any are already present */
     while (NULL != (item = prte_list_remove_first(&my_children))) {
@@ -416,12 +354,19 @@ static void update_routing_plan(void)
     }
     num_children = 0;
 
-    /* compute my direct children and the bitmap that shows which vpids
-     * lie underneath their branch
-     */
-    PRTE_PROC_MY_PARENT->rank = binomial_tree(0, 0, PRTE_PROC_MY_NAME->rank,
-                                   prte_process_info.num_daemons,
-                                   &num_children, &my_children, NULL, true);
+    /* my parent is my rank with its high bit cleared */
+    me = PRTE_PROC_MY_NAME->rank;
+    hibit = prte_hibit(me, prte_cube_dim(prte_process_info.num_daemons));
+    if (0 > hibit) {
+        PRTE_PROC_MY_PARENT->rank = 0;
+    } else {
+        PRTE_PROC_MY_PARENT->rank = me & ~(1 << hibit);
+    }
+    my_lowmask = (1 << (hibit + 1)) - 1;
+
+    /* compute my direct children */
+    binomial_tree(me, prte_process_info.num_daemons,
+                  &num_children, &my_children);
 
     if (0 < prte_output_get_verbosity(prte_routed_base_framework.framework_output)) {
         prte_output(0, "%s: parent %u num_children %d", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_PROC_MY_PARENT->rank, num_children);
@@ -430,11 +375,6 @@ static void update_routing_plan(void)
              item = prte_list_get_next(item)) {
             child = (prte_routed_tree_t*)item;
             prte_output(0, "%s: \tchild %u", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), child->rank);
-            for (j=0; j < (int)prte_process_info.num_daemons; j++) {
-                if (prte_bitmap_is_set_bit(&child->relatives, j)) {
-                    prte_output(0, "%s: \t\trelation %d", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), j);
-                }
-            }
         }
     }
 }
@@ -24,7 +24,6 @@
 #include <stddef.h>
 
 #include "src/class/prte_hash_table.h"
-#include "src/class/prte_bitmap.h"
 #include "src/util/output.h"
 
 #include "src/mca/errmgr/errmgr.h"
@@ -75,6 +74,11 @@ static pmix_proc_t      local_lifeline;
 static int                      num_children;
 static prte_list_t              my_children;
 static bool                     hnp_direct=true;
+/* my position in the tree, used to compute the next hop
+ * to any daemon without storing the members of each branch */
+static int                      my_width;         // #ranks in my level
+static int                      my_offset;        // my index within my level
+static int                      child_start;      // first rank in my children's level
 
 static int init(void)
 {
@@ -162,11 +166,51 @@ static int update_route(pmix_proc_t *target,
 }
 
 
+/* find the first rank in, and width of, the level holding
+ * the given rank - level L holds radix^L ranks */
+static void radix_level(int rank, int *start, int *width)
+{
+    int Sum, NInLevel;
+
+    Sum = 1;
+    NInLevel = 1;
+    while (Sum < (rank+1)) {
+        NInLevel *= prte_routed_radix_component.radix;
+        Sum += NInLevel;
+    }
+    *start = Sum - NInLevel;
+    *width = NInLevel;
+}
+
+/* the ranks below a member of level L all share its offset
+ * within their own level modulo the width of L - so the child
+ * leading to a daemon below us is the member of the next
+ * level down that shares the daemon's offset modulo the width
+ * of that level */
+static pmix_rank_t radix_next_hop(pmix_rank_t target)
+{
+    int start, width, offset;
+
+    if (target <= PRTE_PROC_MY_NAME->rank) {
+        /* cannot be below us */
+        return PRTE_PROC_MY_PARENT->rank;
+    }
+    radix_level(target, &start, &width);
+    if (width <= my_width) {
+        /* at or above our level */
+        return PRTE_PROC_MY_PARENT->rank;
+    }
+    offset = target - start;
+    if (offset % my_width != my_offset) {
+        /* not in our branch */
+        return PRTE_PROC_MY_PARENT->rank;
+    }
+    return child_start + (offset % (my_width * prte_routed_radix_component.radix));
+}
+
 static pmix_proc_t get_route(pmix_proc_t *target)
 {
     pmix_proc_t *ret, daemon;
-    prte_list_item_t *item;
-    prte_routed_tree_t *child;
 
     if (!prte_routing_is_enabled) {
         ret = target;
@@ -227,32 +271,11 @@ static pmix_proc_t get_route(pmix_proc_t *target)
     if (PRTE_PROC_MY_NAME->rank == daemon.rank) {
         ret = target;
         goto found;
-    } else {
-        /* search routing tree for next step to that daemon */
-        for (item = prte_list_get_first(&my_children);
-             item != prte_list_get_end(&my_children);
-             item = prte_list_get_next(item)) {
-            child = (prte_routed_tree_t*)item;
-            if (child->rank == daemon.rank) {
-                /* the child is hosting the proc - just send it there */
-                ret = &daemon;
-                goto found;
-            }
-            /* otherwise, see if the daemon we need is below the child */
-            if (prte_bitmap_is_set_bit(&child->relatives, daemon.rank)) {
-                /* yep - we need to step through this child */
-                daemon.rank = child->rank;
-                ret = &daemon;
-                goto found;
-            }
-        }
     }
 
-    /* if we get here, then the target daemon is not beneath
-     * any of our children, so we have to step up through our parent
-     */
-    daemon.rank = PRTE_PROC_MY_PARENT->rank;
-
+    /* step down through the child whose branch holds that
+     * daemon, or up through our parent if none does */
+    daemon.rank = radix_next_hop(daemon.rank);
     ret = &daemon;
 
 found:
@@ -332,20 +355,13 @@ static int set_lifeline(pmix_proc_t *proc)
 }
 
 static void radix_tree(int rank, int *num_children_out,
-                       prte_list_t *children, prte_bitmap_t *relatives)
+                       prte_list_t *children)
 {
-    int i, peer, Sum, NInLevel;
+    int i, peer, start, NInLevel;
     prte_routed_tree_t *child;
-    prte_bitmap_t *relations;
 
     /* compute how many procs are at my level */
-    Sum=1;
-    NInLevel=1;
-
-    while ( Sum < (rank+1) ) {
-        NInLevel *= prte_routed_radix_component.radix;
-        Sum += NInLevel;
-    }
+    radix_level(rank, &start, &NInLevel);
 
     /* our children start at our rank + num_in_level */
     peer = rank + NInLevel;
@@ -353,25 +369,8 @@ static void radix_tree(int rank, int *num_children_out,
         if (peer < (int)prte_process_info.num_daemons) {
             child = PRTE_NEW(prte_routed_tree_t);
             child->rank = peer;
-            if (NULL != children) {
-                /* this is a direct child - add it to my list */
-                prte_list_append(children, &child->super);
-                (*num_children_out)++;
-                /* setup the relatives bitmap */
-                prte_bitmap_init(&child->relatives, prte_process_info.num_daemons);
-                /* point to the relatives */
-                relations = &child->relatives;
-            } else {
-                /* we are recording someone's relatives - set the bit */
-                if (PRTE_SUCCESS != prte_bitmap_set_bit(relatives, peer)) {
-                    prte_output(0, "%s Error: could not set relations bit!", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME));
-                }
-                /* point to this relations */
-                relations = relatives;
-                PRTE_RELEASE(child);
-            }
-            /* search for this child's relatives */
-            radix_tree(peer, NULL, NULL, relations);
+            prte_list_append(children, &child->super);
+            (*num_children_out)++;
         }
         peer += NInLevel;
     }
@@ -380,7 +379,6 @@ static void radix_tree(int rank, int *num_children_out,
 static void update_routing_plan(void)
 {
     prte_routed_tree_t *child;
-    int j;
     prte_list_item_t *item;
     int Level,Sum,NInLevel,Ii;
     int NInPrevLevel;
@@ -415,10 +413,13 @@ static void update_routing_plan(void)
         PRTE_PROC_MY_PARENT->rank += (Sum - NInPrevLevel);
     }
 
-    /* compute my direct children and the bitmap that shows which vpids
-     * lie underneath their branch
-     */
-    radix_tree(Ii, &num_children, &my_children, NULL);
+    /* record my place in the tree so routes can be computed */
+    my_width = NInLevel;
+    my_offset = Ii - Sum;
+    child_start = Sum + NInLevel;
+
+    /* compute my direct children */
+    radix_tree(Ii, &num_children, &my_children);
 
     if (0 < prte_output_get_verbosity(prte_routed_base_framework.framework_output)) {
         prte_output(0, "%s: parent %d num_children %d", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), PRTE_PROC_MY_PARENT->rank, num_children);
@@ -429,11 +430,6 @@ static void update_routing_plan(void)
             child = (prte_routed_tree_t*)item;
             d = (prte_proc_t*)prte_pointer_array_get_item(dmns->procs, child->rank);
             prte_output(0, "%s: \tchild %d node %s", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), child->rank, d->node->name);
-            for (j=0; j < (int)prte_process_info.num_daemons; j++) {
-                if (prte_bitmap_is_set_bit(&child->relatives, j)) {
-                    prte_output(0, "%s: \t\trelation %d", PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), j);
-                }
-            }
         }
     }
 }
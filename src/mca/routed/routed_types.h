@@ -35,7 +35,6 @@ BEGIN_C_DECLS
 typedef struct {
     prte_list_item_t super;
     pmix_rank_t rank;
-    prte_bitmap_t relatives;
 } prte_routed_tree_t;
 PRTE_EXPORT PRTE_CLASS_DECLARATION(prte_routed_tree_t);
 
@@ -847,7 +847,7 @@ static int setup_fork(prte_job_t *jdata,
      * ones as the app-specific ones can override them. We have to
      * process them in the order they were given to ensure we wind
      * up in the desired final state */
-    PRTE_LIST_FOREACH(attr, &jdata->attributes, prte_attribute_t) {
+    PRTE_LIST_FOREACH(attr, &jdata->attributes.super, prte_attribute_t) {
         if (PRTE_JOB_SET_ENVAR == attr->key) {
             prte_setenv(attr->data.data.envar.envar, attr->data.data.envar.value, true, &app->env);
         } else if (PRTE_JOB_ADD_ENVAR == attr->key) {
@@ -908,7 +908,7 @@ static int setup_fork(prte_job_t *jdata,
     }
 
     /* now do the same thing for any app-level attributes */
-    PRTE_LIST_FOREACH(attr, &app->attributes, prte_attribute_t) {
+    PRTE_LIST_FOREACH(attr, &app->attributes.super, prte_attribute_t) {
         if (PRTE_APP_SET_ENVAR == attr->key) {
             prte_setenv(attr->data.data.envar.envar, attr->data.data.envar.value, true, &app->env);
         } else if (PRTE_APP_ADD_ENVAR == attr->key) {
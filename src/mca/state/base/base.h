@@ -40,6 +40,17 @@ PRTE_EXPORT void prte_state_base_print_job_state_machine(void);
 
 PRTE_EXPORT void prte_state_base_print_proc_state_machine(void);
 
+/* apply a batch of proc state updates for a job in one pass */
+PRTE_EXPORT void prte_state_base_batch_add(prte_state_batch_t *batch, pmix_rank_t rank,
+                                           prte_proc_state_t state);
+PRTE_EXPORT void prte_state_base_activate_proc_batch(prte_state_batch_t *batch);
+
+/* daemons combine the per-job proc state updates they send to
+ * the HNP - the section must contain the job's nspace followed
+ * by its proc updates and terminated by an invalid rank */
+PRTE_EXPORT void prte_state_base_queue_update(pmix_data_buffer_t *section);
+PRTE_EXPORT void prte_state_base_flush_updates(void);
+
 PRTE_EXPORT extern int prte_state_base_parent_fd;
 PRTE_EXPORT extern bool prte_state_base_ready_msg;
 
@@ -18,6 +18,7 @@
 #include "prte_config.h"
 #include "constants.h"
 
+#include <string.h>
 #if HAVE_UNISTD_H
 #include <unistd.h>
 #endif
@@ -50,69 +51,231 @@
 #include "src/mca/state/base/base.h"
 #include "src/mca/state/base/state_private.h"
 
-void prte_state_base_activate_job_state(prte_job_t *jdata,
-                                        prte_job_state_t state)
+/****    DISPATCH TABLES    ****/
+
+/* the job and proc state lists are compiled into tables indexed
+ * directly by state value. Unregistered states within the table
+ * hold the ERROR or ANY default they would resolve to, so an
+ * activation is a single lookup
+ */
+typedef struct {
+    prte_state_t **table;
+    int32_t size;
+    prte_state_t *any;
+    prte_state_t *error;
+} prte_state_dispatch_t;
+
+static prte_state_dispatch_t job_dispatch = {NULL, 0, NULL, NULL};
+static prte_state_dispatch_t proc_dispatch = {NULL, 0, NULL, NULL};
+
+static void dispatch_compile(prte_state_dispatch_t *d, prte_list_t *states,
+                             bool jobs)
 {
-    prte_list_item_t *itm, *any=NULL, *error=NULL;
     prte_state_t *s;
-    prte_state_caddy_t *caddy;
-
-    for (itm = prte_list_get_first(&prte_job_states);
-         itm != prte_list_get_end(&prte_job_states);
-         itm = prte_list_get_next(itm)) {
-        s = (prte_state_t*)itm;
-        if (s->job_state == PRTE_JOB_STATE_ANY) {
-            /* save this place */
-            any = itm;
+    int32_t st, any, error, max = -1;
+    int32_t n;
+
+    any = jobs ? PRTE_JOB_STATE_ANY : PRTE_PROC_STATE_ANY;
+    error = jobs ? PRTE_JOB_STATE_ERROR : PRTE_PROC_STATE_ERROR;
+
+    d->any = NULL;
+    d->error = NULL;
+    PRTE_LIST_FOREACH(s, states, prte_state_t) {
+        st = jobs ? s->job_state : s->proc_state;
+        if (any == st) {
+            d->any = s;
+        } else if (max < st) {
+            max = st;
         }
-        if (s->job_state == PRTE_JOB_STATE_ERROR) {
-            error = itm;
+        if (error == st) {
+            d->error = s;
         }
-        if (s->job_state == state) {
-            PRTE_REACHING_JOB_STATE(jdata, state, s->priority);
-            if (NULL == s->cbfunc) {
-                PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
-                                     "%s NULL CBFUNC FOR JOB %s STATE %s",
-                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                     (NULL == jdata) ? "ALL" : PRTE_JOBID_PRINT(jdata->nspace),
-                                     prte_job_state_to_str(state)));
-                return;
-            }
-            caddy = PRTE_NEW(prte_state_caddy_t);
-            if (NULL != jdata) {
-                caddy->jdata = jdata;
-                caddy->job_state = state;
-                PRTE_RETAIN(jdata);
-            }
-            PRTE_THREADSHIFT(caddy, prte_event_base, s->cbfunc, s->priority);
-            return;
+    }
+    if (d->size < max + 1) {
+        d->table = (prte_state_t**)realloc(d->table, (max + 1) * sizeof(prte_state_t*));
+        d->size = max + 1;
+    }
+    for (n=0; n < d->size; n++) {
+        if (error < n && NULL != d->error) {
+            d->table[n] = d->error;
+        } else {
+            d->table[n] = d->any;
         }
     }
-    /* if we get here, then the state wasn't found, so execute
-     * the default handler if it is defined
+    PRTE_LIST_FOREACH(s, states, prte_state_t) {
+        st = jobs ? s->job_state : s->proc_state;
+        if (0 <= st && st < d->size) {
+            d->table[st] = s;
+        }
+    }
+}
+
+static inline prte_state_t* dispatch_lookup(prte_state_dispatch_t *d,
+                                            int32_t state, int32_t any,
+                                            int32_t error)
+{
+    if (0 <= state && state < d->size) {
+        return d->table[state];
+    }
+    if (any == state) {
+        return d->any;
+    }
+    if (error < state && NULL != d->error) {
+        return d->error;
+    }
+    return d->any;
+}
+
+/****    CADDY CACHE    ****/
+
+static prte_state_caddy_t* caddy_get(void)
+{
+    prte_state_caddy_t *caddy;
+
+    caddy = (prte_state_caddy_t*)prte_lifo_pop(&prte_state_base_caddies);
+    if (NULL == caddy) {
+        return PRTE_NEW(prte_state_caddy_t);
+    }
+    (void)prte_atomic_add_fetch_32(&prte_state_base_ncaddies, -1);
+    return caddy;
+}
+
+static void caddy_return(prte_state_caddy_t *caddy)
+{
+    /* if someone else still holds the caddy (e.g., the handler
+     * shifted it to another event), then just drop our reference
      */
-    if (PRTE_JOB_STATE_ERROR < state && NULL != error) {
-        s = (prte_state_t*)error;
-    } else if (NULL != any) {
-        s = (prte_state_t*)any;
-    } else {
+    if (1 < caddy->super.super.obj_reference_count ||
+        PRTE_STATE_CADDY_CACHE_MAX <= prte_state_base_ncaddies) {
+        PRTE_RELEASE(caddy);
+        return;
+    }
+    /* we hold the only reference - clean it up for the next user */
+    if (NULL != caddy->jdata) {
+        PRTE_RELEASE(caddy->jdata);
+        caddy->jdata = NULL;
+    }
+    if (NULL != caddy->state) {
+        PRTE_RELEASE(caddy->state);
+        caddy->state = NULL;
+    }
+    caddy->cbfunc = NULL;
+    (void)prte_atomic_add_fetch_32(&prte_state_base_ncaddies, 1);
+    prte_lifo_push(&prte_state_base_caddies, &caddy->super);
+}
+
+static void state_latency(prte_state_t *s, struct timeval *start)
+{
+    struct timeval now;
+    uint64_t usec;
+    int bin;
+
+    gettimeofday(&now, NULL);
+    usec = (uint64_t)(now.tv_sec - start->tv_sec) * 1000000 +
+           (int64_t)(now.tv_usec - start->tv_usec);
+    for (bin=0; 0 < usec && bin < PRTE_STATE_LATENCY_BINS-1; bin++) {
+        usec >>= 1;
+    }
+    s->latency[bin]++;
+}
+
+/* all state handlers are executed thru here so we can track
+ * them and recover the caddy once the handler is done with it
+ */
+static void state_dispatch(int fd, short args, void *cbdata)
+{
+    prte_state_caddy_t *caddy = (prte_state_caddy_t*)cbdata;
+    prte_state_t *s;
+
+    PRTE_ACQUIRE_OBJECT(caddy);
+    s = caddy->state;
+    s->count++;
+
+    /* hold the caddy across the handler, which releases it */
+    PRTE_RETAIN(caddy);
+    caddy->cbfunc(fd, args, caddy);
+
+    if (prte_state_base_collect_latency) {
+        state_latency(s, &caddy->activated);
+    }
+    caddy_return(caddy);
+}
+
+static void state_activate(prte_state_caddy_t *caddy, prte_state_t *s)
+{
+    PRTE_RETAIN(s);
+    caddy->state = s;
+    caddy->cbfunc = s->cbfunc;
+    if (prte_state_base_collect_latency) {
+        gettimeofday(&caddy->activated, NULL);
+    }
+    PRTE_THREADSHIFT(caddy, prte_event_base, state_dispatch, s->priority);
+}
+
+static void print_latency(prte_state_t *st)
+{
+    char line[512];
+    size_t len = 0;
+    int n;
+
+    if (!prte_state_base_collect_latency || 0 == st->count) {
+        return;
+    }
+    for (n=0; n < PRTE_STATE_LATENCY_BINS && len < sizeof(line); n++) {
+        if (0 == st->latency[n]) {
+            continue;
+        }
+        if (0 == n) {
+            len += snprintf(&line[len], sizeof(line) - len, " <1:%lu",
+                            (unsigned long)st->latency[n]);
+        } else if (PRTE_STATE_LATENCY_BINS-1 == n) {
+            len += snprintf(&line[len], sizeof(line) - len, " >=%lu:%lu",
+                            1UL << (n-1), (unsigned long)st->latency[n]);
+        } else {
+            len += snprintf(&line[len], sizeof(line) - len, " <%lu:%lu",
+                            1UL << n, (unsigned long)st->latency[n]);
+        }
+    }
+    if (0 < len) {
+        prte_output(0, "\t\tLatency (usec):%s", line);
+    }
+}
+
+/****    JOB STATE MACHINE    ****/
+void prte_state_base_activate_job_state(prte_job_t *jdata,
+                                        prte_job_state_t state)
+{
+    prte_state_t *s;
+    prte_state_caddy_t *caddy;
+
+    s = dispatch_lookup(&job_dispatch, state, PRTE_JOB_STATE_ANY, PRTE_JOB_STATE_ERROR);
+    if (NULL == s) {
         PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
                              "ACTIVATE: JOB STATE %s NOT REGISTERED", prte_job_state_to_str(state)));
         return;
     }
     if (NULL == s->cbfunc) {
-        PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
-                             "ACTIVATE: ANY STATE HANDLER NOT DEFINED"));
+        if (s->job_state == state) {
+            PRTE_REACHING_JOB_STATE(jdata, state, s->priority);
+            PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
+                                 "%s NULL CBFUNC FOR JOB %s STATE %s",
+                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                                 (NULL == jdata) ? "ALL" : PRTE_JOBID_PRINT(jdata->nspace),
+                                 prte_job_state_to_str(state)));
+        } else {
+            PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
+                                 "ACTIVATE: ANY STATE HANDLER NOT DEFINED"));
+        }
         return;
     }
-    caddy = PRTE_NEW(prte_state_caddy_t);
+    caddy = caddy_get();
     if (NULL != jdata) {
         caddy->jdata = jdata;
         caddy->job_state = state;
         PRTE_RETAIN(jdata);
     }
     PRTE_REACHING_JOB_STATE(jdata, state, s->priority);
-    PRTE_THREADSHIFT(caddy, prte_event_base, s->cbfunc, s->priority);
+    state_activate(caddy, s);
 }
 
 
@@ -141,6 +304,7 @@ int prte_state_base_add_job_state(prte_job_state_t state,
     st->cbfunc = cbfunc;
     st->priority = priority;
     prte_list_append(&prte_job_states, &(st->super));
+    dispatch_compile(&job_dispatch, &prte_job_states, true);
 
     return PRTE_SUCCESS;
 }
@@ -167,6 +331,7 @@ int prte_state_base_set_job_state_callback(prte_job_state_t state,
     st->cbfunc = cbfunc;
     st->priority = PRTE_SYS_PRI;
     prte_list_append(&prte_job_states, &(st->super));
+    dispatch_compile(&job_dispatch, &prte_job_states, true);
 
     return PRTE_SUCCESS;
 }
@@ -200,6 +365,7 @@ int prte_state_base_remove_job_state(prte_job_state_t state)
         st = (prte_state_t*)item;
         if (st->job_state == state) {
             prte_list_remove_item(&prte_job_states, item);
+            dispatch_compile(&job_dispatch, &prte_job_states, true);
             PRTE_RELEASE(item);
             return PRTE_SUCCESS;
         }
@@ -217,9 +383,11 @@ void prte_state_base_print_job_state_machine(void)
          item != prte_list_get_end(&prte_job_states);
          item = prte_list_get_next(item)) {
         st = (prte_state_t*)item;
-        prte_output(0, "\tState: %s cbfunc: %s",
+        prte_output(0, "\tState: %s cbfunc: %s count: %lu",
                     prte_job_state_to_str(st->job_state),
-                    (NULL == st->cbfunc) ? "NULL" : "DEFINED");
+                    (NULL == st->cbfunc) ? "NULL" : "DEFINED",
+                    (unsigned long)st->count);
+        print_latency(st);
     }
 }
 
@@ -228,60 +396,34 @@ void prte_state_base_print_job_state_machine(void)
 void prte_state_base_activate_proc_state(pmix_proc_t *proc,
                                          prte_proc_state_t state)
 {
-    prte_list_item_t *itm, *any=NULL, *error=NULL;
     prte_state_t *s;
     prte_state_caddy_t *caddy;
 
-    for (itm = prte_list_get_first(&prte_proc_states);
-         itm != prte_list_get_end(&prte_proc_states);
-         itm = prte_list_get_next(itm)) {
-        s = (prte_state_t*)itm;
-        if (s->proc_state == PRTE_PROC_STATE_ANY) {
-            /* save this place */
-            any = itm;
-        }
-        if (s->proc_state == PRTE_PROC_STATE_ERROR) {
-            error = itm;
-        }
-        if (s->proc_state == state) {
-            PRTE_REACHING_PROC_STATE(proc, state, s->priority);
-            if (NULL == s->cbfunc) {
-                PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
-                                     "%s NULL CBFUNC FOR PROC %s STATE %s",
-                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                     PRTE_NAME_PRINT(proc),
-                                     prte_proc_state_to_str(state)));
-                return;
-            }
-            caddy = PRTE_NEW(prte_state_caddy_t);
-            caddy->name = *proc;
-            caddy->proc_state = state;
-            PRTE_THREADSHIFT(caddy, prte_event_base, s->cbfunc, s->priority);
-            return;
-        }
-    }
-    /* if we get here, then the state wasn't found, so execute
-     * the default handler if it is defined
-     */
-    if (PRTE_PROC_STATE_ERROR < state && NULL != error) {
-        s = (prte_state_t*)error;
-    } else if (NULL != any) {
-        s = (prte_state_t*)any;
-    } else {
+    s = dispatch_lookup(&proc_dispatch, state, PRTE_PROC_STATE_ANY, PRTE_PROC_STATE_ERROR);
+    if (NULL == s) {
         PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
                              "INCREMENT: ANY STATE NOT FOUND"));
         return;
     }
     if (NULL == s->cbfunc) {
-        PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
-                             "ACTIVATE: ANY STATE HANDLER NOT DEFINED"));
+        if (s->proc_state == state) {
+            PRTE_REACHING_PROC_STATE(proc, state, s->priority);
+            PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
+                                 "%s NULL CBFUNC FOR PROC %s STATE %s",
+                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                                 PRTE_NAME_PRINT(proc),
+                                 prte_proc_state_to_str(state)));
+        } else {
+            PRTE_OUTPUT_VERBOSE((1, prte_state_base_framework.framework_output,
+                                 "ACTIVATE: ANY STATE HANDLER NOT DEFINED"));
+        }
         return;
     }
-    caddy = PRTE_NEW(prte_state_caddy_t);
+    caddy = caddy_get();
     caddy->name = *proc;
     caddy->proc_state = state;
     PRTE_REACHING_PROC_STATE(proc, state, s->priority);
-    PRTE_THREADSHIFT(caddy, prte_event_base, s->cbfunc, s->priority);
+    state_activate(caddy, s);
 }
 
 int prte_state_base_add_proc_state(prte_proc_state_t state,
@@ -309,6 +451,7 @@ int prte_state_base_add_proc_state(prte_proc_state_t state,
     st->cbfunc = cbfunc;
     st->priority = priority;
     prte_list_append(&prte_proc_states, &(st->super));
+    dispatch_compile(&proc_dispatch, &prte_proc_states, false);
 
     return PRTE_SUCCESS;
 }
@@ -360,6 +503,7 @@ int prte_state_base_remove_proc_state(prte_proc_state_t state)
         st = (prte_state_t*)item;
         if (st->proc_state == state) {
             prte_list_remove_item(&prte_proc_states, item);
+            dispatch_compile(&proc_dispatch, &prte_proc_states, false);
             PRTE_RELEASE(item);
             return PRTE_SUCCESS;
         }
@@ -377,9 +521,11 @@ void prte_state_base_print_proc_state_machine(void)
          item != prte_list_get_end(&prte_proc_states);
          item = prte_list_get_next(item)) {
         st = (prte_state_t*)item;
-        prte_output(0, "\tState: %s cbfunc: %s",
+        prte_output(0, "\tState: %s cbfunc: %s count: %lu",
                     prte_proc_state_to_str(st->proc_state),
-                    (NULL == st->cbfunc) ? "NULL" : "DEFINED");
+                    (NULL == st->cbfunc) ? "NULL" : "DEFINED",
+                    (unsigned long)st->count);
+        print_latency(st);
     }
 }
 
@@ -431,6 +577,119 @@ void prte_state_base_report_progress(int fd, short argc, void *cbdata)
     PRTE_RELEASE(caddy);
 }
 
+/****    UPDATE BATCHING    ****/
+
+static pmix_data_buffer_t *update_batch = NULL;
+static int update_count = 0;
+static prte_event_t update_ev;
+static bool update_ev_set = false;
+static bool update_timer_active = false;
+
+static void update_timeout(int fd, short args, void *cbdata)
+{
+    update_timer_active = false;
+    prte_state_base_flush_updates();
+}
+
+/* send all the queued job updates to the HNP in a single message -
+ * the receiver processes the sections in order, so the updates
+ * for any given job remain in sequence
+ */
+void prte_state_base_flush_updates(void)
+{
+    int rc;
+
+    if (update_timer_active) {
+        prte_event_evtimer_del(&update_ev);
+        update_timer_active = false;
+    }
+    if (NULL == update_batch) {
+        return;
+    }
+
+    PRTE_OUTPUT_VERBOSE((5, prte_state_base_framework.framework_output,
+                         "%s state:base:flush sending %d job updates to HNP",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), update_count));
+
+    if (0 > (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, update_batch,
+                                          PRTE_RML_TAG_PLM,
+                                          prte_rml_send_callback, NULL))) {
+        PRTE_ERROR_LOG(rc);
+    }
+    PMIX_DATA_BUFFER_RELEASE(update_batch);
+    update_batch = NULL;
+    update_count = 0;
+}
+
+void prte_state_base_queue_update(pmix_data_buffer_t *section)
+{
+    prte_plm_cmd_flag_t cmd = PRTE_PLM_UPDATE_PROC_STATE;
+    struct timeval tv;
+    int rc;
+
+    if (NULL == update_batch) {
+        PMIX_DATA_BUFFER_CREATE(update_batch);
+        rc = PMIx_Data_pack(NULL, update_batch, &cmd, 1, PMIX_UINT8);
+        if (PMIX_SUCCESS != rc) {
+            PMIX_ERROR_LOG(rc);
+            PMIX_DATA_BUFFER_RELEASE(update_batch);
+            update_batch = NULL;
+            PMIX_DATA_BUFFER_RELEASE(section);
+            return;
+        }
+    }
+    rc = PMIx_Data_copy_payload(update_batch, section);
+    PMIX_DATA_BUFFER_RELEASE(section);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        return;
+    }
+    update_count++;
+
+    if (0 >= prte_state_base_update_batch_usec ||
+        update_count >= prte_state_base_update_batch_size) {
+        prte_state_base_flush_updates();
+    } else if (!update_timer_active) {
+        /* bound the time these updates can sit here */
+        if (!update_ev_set) {
+            prte_event_evtimer_set(prte_event_base, &update_ev, update_timeout, NULL);
+            update_ev_set = true;
+        }
+        tv.tv_sec = prte_state_base_update_batch_usec / 1000000;
+        tv.tv_usec = prte_state_base_update_batch_usec % 1000000;
+        prte_event_evtimer_add(&update_ev, &tv);
+        update_timer_active = true;
+    }
+}
+
+void prte_state_base_cleanup(void)
+{
+    prte_list_item_t *item;
+
+    if (NULL != job_dispatch.table) {
+        free(job_dispatch.table);
+    }
+    if (NULL != proc_dispatch.table) {
+        free(proc_dispatch.table);
+    }
+    memset(&job_dispatch, 0, sizeof(prte_state_dispatch_t));
+    memset(&proc_dispatch, 0, sizeof(prte_state_dispatch_t));
+    while (NULL != (item = prte_lifo_pop(&prte_state_base_caddies))) {
+        PRTE_RELEASE(item);
+    }
+    prte_state_base_ncaddies = 0;
+
+    if (update_timer_active) {
+        prte_event_evtimer_del(&update_ev);
+        update_timer_active = false;
+    }
+    if (NULL != update_batch) {
+        PMIX_DATA_BUFFER_RELEASE(update_batch);
+        update_batch = NULL;
+        update_count = 0;
+    }
+}
+
 void prte_state_base_notify_data_server(pmix_proc_t *target)
 {
     pmix_data_buffer_t *buf;
@@ -588,36 +847,15 @@ static void opcbfunc(pmix_status_t status, void *cbdata)
     PRTE_PMIX_WAKEUP_THREAD(lock);
 }
 
-void prte_state_base_track_procs(int fd, short argc, void *cbdata)
+/* apply a state update to a proc that is being tracked by the
+ * generic state machine */
+static void track_proc(prte_job_t *jdata, prte_proc_t *pdata,
+                       pmix_proc_t *proc, prte_proc_state_t state)
 {
-    prte_state_caddy_t *caddy = (prte_state_caddy_t*)cbdata;
-    pmix_proc_t *proc;
-    prte_proc_state_t state;
-    prte_job_t *jdata;
-    prte_proc_t *pdata;
     int i;
     pmix_proc_t parent, target;
     prte_pmix_lock_t lock;
 
-    PRTE_ACQUIRE_OBJECT(caddy);
-    proc = &caddy->name;
-    state = caddy->proc_state;
-
-    prte_output_verbose(5, prte_state_base_framework.framework_output,
-                        "%s state:base:track_procs called for proc %s state %s",
-                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                        PRTE_NAME_PRINT(proc),
-                        prte_proc_state_to_str(state));
-
-    /* get the job object for this proc */
-    if (NULL == (jdata = prte_get_job_data_object(proc->nspace))) {
-        goto cleanup;
-    }
-    pdata = (prte_proc_t*)prte_pointer_array_get_item(jdata->procs, proc->rank);
-    if (NULL == pdata) {
-        goto cleanup;
-    }
-
     if (PRTE_PROC_STATE_RUNNING == state) {
         /* update the proc state */
         if (pdata->state < PRTE_PROC_STATE_TERMINATED) {
@@ -668,7 +906,7 @@ void prte_state_base_track_procs(int fd, short argc, void *cbdata)
                                  PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                                  PRTE_NAME_PRINT(proc),
                                  prte_proc_state_to_str(state));
-            goto cleanup;
+            return;
         }
 
         /* update the proc state */
@@ -701,7 +939,7 @@ void prte_state_base_track_procs(int fd, short argc, void *cbdata)
                 if (NULL != (pdata = (prte_proc_t*)prte_pointer_array_get_item(prte_local_children, i)) &&
                     PRTE_FLAG_TEST(pdata, PRTE_PROC_FLAG_ALIVE)) {
                     /* at least one is still alive */
-                    goto cleanup;
+                    return;
                 }
             }
             /* call our appropriate exit procedure */
@@ -709,7 +947,7 @@ void prte_state_base_track_procs(int fd, short argc, void *cbdata)
                                  "%s state:base all routes and children gone - exiting",
                                  PRTE_NAME_PRINT(PRTE_PROC_MY_NAME)));
             PRTE_ACTIVATE_JOB_STATE(NULL, PRTE_JOB_STATE_DAEMONS_TERMINATED);
-            goto cleanup;
+            return;
         }
         /* track job status */
         jdata->num_terminated++;
@@ -737,11 +975,101 @@ void prte_state_base_track_procs(int fd, short argc, void *cbdata)
             }
         }
     }
+}
+
+void prte_state_base_track_procs(int fd, short argc, void *cbdata)
+{
+    prte_state_caddy_t *caddy = (prte_state_caddy_t*)cbdata;
+    pmix_proc_t *proc;
+    prte_proc_state_t state;
+    prte_job_t *jdata;
+    prte_proc_t *pdata;
+
+    PRTE_ACQUIRE_OBJECT(caddy);
+    proc = &caddy->name;
+    state = caddy->proc_state;
+
+    prte_output_verbose(5, prte_state_base_framework.framework_output,
+                        "%s state:base:track_procs called for proc %s state %s",
+                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                        PRTE_NAME_PRINT(proc),
+                        prte_proc_state_to_str(state));
+
+    /* get the job object for this proc */
+    if (NULL == (jdata = prte_get_job_data_object(proc->nspace))) {
+        goto cleanup;
+    }
+    pdata = (prte_proc_t*)prte_pointer_array_get_item(jdata->procs, proc->rank);
+    if (NULL == pdata) {
+        goto cleanup;
+    }
+    track_proc(jdata, pdata, proc, state);
 
  cleanup:
     PRTE_RELEASE(caddy);
 }
 
+/* apply all the updates a daemon reported for a job in one pass -
+ * the updates the generic tracker would handle are applied directly,
+ * and anything else is passed thru the state machine as usual
+ */
+static void track_batch(int fd, short argc, void *cbdata)
+{
+    prte_state_batch_t *batch = (prte_state_batch_t*)cbdata;
+    prte_job_t *jdata = batch->jdata;
+    prte_state_t *s;
+    prte_proc_t *pdata;
+    prte_proc_state_t state;
+    pmix_proc_t name;
+    int32_t n;
+
+    PRTE_ACQUIRE_OBJECT(batch);
+
+    prte_output_verbose(5, prte_state_base_framework.framework_output,
+                        "%s state:base:track_batch applying %d updates for job %s",
+                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), batch->num,
+                        PRTE_JOBID_PRINT(jdata->nspace));
+
+    PMIX_LOAD_NSPACE(name.nspace, jdata->nspace);
+    for (n=0; n < batch->num; n++) {
+        name.rank = batch->ranks[n];
+        state = batch->states[n];
+        s = dispatch_lookup(&proc_dispatch, state, PRTE_PROC_STATE_ANY, PRTE_PROC_STATE_ERROR);
+        if (NULL == s || s->proc_state != state ||
+            prte_state_base_track_procs != s->cbfunc ||
+            NULL == (pdata = (prte_proc_t*)prte_pointer_array_get_item(jdata->procs, name.rank))) {
+            PRTE_ACTIVATE_PROC_STATE(&name, state);
+            continue;
+        }
+        PRTE_REACHING_PROC_STATE(&name, state, s->priority);
+        s->count++;
+        track_proc(jdata, pdata, &name, state);
+    }
+    PRTE_RELEASE(batch);
+}
+
+void prte_state_base_batch_add(prte_state_batch_t *batch, pmix_rank_t rank,
+                               prte_proc_state_t state)
+{
+    if (batch->num == batch->size) {
+        batch->size = (0 == batch->size) ? 16 : 2 * batch->size;
+        batch->ranks = (pmix_rank_t*)realloc(batch->ranks, batch->size * sizeof(pmix_rank_t));
+        batch->states = (prte_proc_state_t*)realloc(batch->states, batch->size * sizeof(prte_proc_state_t));
+    }
+    batch->ranks[batch->num] = rank;
+    batch->states[batch->num] = state;
+    batch->num++;
+}
+
+void prte_state_base_activate_proc_batch(prte_state_batch_t *batch)
+{
+    if (0 == batch->num) {
+        PRTE_RELEASE(batch);
+        return;
+    }
+    PRTE_THREADSHIFT(batch, prte_event_base, track_batch, PRTE_SYS_PRI);
+}
+
 void prte_state_base_check_all_complete(int fd, short args, void *cbdata)
 {
     prte_state_caddy_t *caddy = (prte_state_caddy_t*)cbdata;
@@ -940,7 +1268,7 @@ void prte_state_base_check_all_complete(int fd, short args, void *cbdata)
                  * pointer array internal accounting
                  * is maintained!
                  */
-                prte_pointer_array_set_item(prte_job_data, j, NULL);
+                prte_remove_job_data_object(jdata);
                 PRTE_RELEASE(jdata);
             }
             continue;
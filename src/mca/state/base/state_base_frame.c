@@ -29,6 +29,7 @@
 #include "src/mca/base/base.h"
 
 #include "src/class/prte_list.h"
+#include "src/class/prte_lifo.h"
 #include "src/util/output.h"
 
 #include "src/mca/plm/plm_types.h"
@@ -46,6 +47,11 @@ prte_state_base_module_t prte_state = {0};
 bool prte_state_base_run_fdcheck = false;
 int prte_state_base_parent_fd = -1;
 bool prte_state_base_ready_msg = true;
+bool prte_state_base_collect_latency = false;
+int prte_state_base_update_batch_size = 32;
+int prte_state_base_update_batch_usec = 1000;
+prte_lifo_t prte_state_base_caddies;
+prte_atomic_int32_t prte_state_base_ncaddies = 0;
 
 static int prte_state_base_register(prte_mca_base_register_flag_t flags)
 {
@@ -58,6 +64,33 @@ static int prte_state_base_register(prte_mca_base_register_flag_t flags)
                                 PRTE_MCA_BASE_VAR_SCOPE_READONLY,
                                 &prte_state_base_run_fdcheck);
 
+    prte_state_base_collect_latency = false;
+    prte_mca_base_var_register("prte", "state", "base", "collect_latency",
+                                "Track a histogram of the time from activation of each state until its handler completes",
+                                PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0,
+                                PRTE_MCA_BASE_VAR_FLAG_NONE,
+                                PRTE_INFO_LVL_9,
+                                PRTE_MCA_BASE_VAR_SCOPE_READONLY,
+                                &prte_state_base_collect_latency);
+
+    prte_state_base_update_batch_size = 32;
+    prte_mca_base_var_register("prte", "state", "base", "update_batch_size",
+                                "Max number of job state updates a daemon holds before sending them to the HNP",
+                                PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0,
+                                PRTE_MCA_BASE_VAR_FLAG_NONE,
+                                PRTE_INFO_LVL_9,
+                                PRTE_MCA_BASE_VAR_SCOPE_READONLY,
+                                &prte_state_base_update_batch_size);
+
+    prte_state_base_update_batch_usec = 1000;
+    prte_mca_base_var_register("prte", "state", "base", "update_batch_usec",
+                                "Max time (in usec) a daemon holds job state updates before sending them to the HNP (0 => send immediately)",
+                                PRTE_MCA_BASE_VAR_TYPE_INT, NULL, 0,
+                                PRTE_MCA_BASE_VAR_FLAG_NONE,
+                                PRTE_INFO_LVL_9,
+                                PRTE_MCA_BASE_VAR_SCOPE_READONLY,
+                                &prte_state_base_update_batch_usec);
+
     return PRTE_SUCCESS;
 }
 
@@ -68,6 +101,11 @@ static int prte_state_base_close(void)
         prte_state.finalize();
     }
 
+    /* the state machines are gone, so is everything the base
+     * kept to run them */
+    prte_state_base_cleanup();
+    PRTE_DESTRUCT(&prte_state_base_caddies);
+
     return prte_mca_base_framework_components_close(&prte_state_base_framework, NULL);
 }
 
@@ -77,6 +115,9 @@ static int prte_state_base_close(void)
  *    */
 static int prte_state_base_open(prte_mca_base_open_flag_t flags)
 {
+    PRTE_CONSTRUCT(&prte_state_base_caddies, prte_lifo_t);
+    prte_state_base_ncaddies = 0;
+
     /* Open up all available components */
     return prte_mca_base_framework_components_open(&prte_state_base_framework, flags);
 }
@@ -93,6 +134,8 @@ static void prte_state_construct(prte_state_t *state)
     state->proc_state = PRTE_PROC_STATE_UNDEF;
     state->cbfunc = NULL;
     state->priority = PRTE_INFO_PRI;
+    state->count = 0;
+    memset(state->latency, 0, sizeof(state->latency));
 }
 PRTE_CLASS_INSTANCE(prte_state_t,
                    prte_list_item_t,
@@ -103,6 +146,8 @@ static void prte_state_caddy_construct(prte_state_caddy_t *caddy)
 {
     memset(&caddy->ev, 0, sizeof(prte_event_t));
     caddy->jdata = NULL;
+    caddy->state = NULL;
+    caddy->cbfunc = NULL;
 }
 static void prte_state_caddy_destruct(prte_state_caddy_t *caddy)
 {
@@ -110,8 +155,38 @@ static void prte_state_caddy_destruct(prte_state_caddy_t *caddy)
     if (NULL != caddy->jdata) {
         PRTE_RELEASE(caddy->jdata);
     }
+    if (NULL != caddy->state) {
+        PRTE_RELEASE(caddy->state);
+    }
 }
 PRTE_CLASS_INSTANCE(prte_state_caddy_t,
-                   prte_object_t,
+                   prte_list_item_t,
                    prte_state_caddy_construct,
                    prte_state_caddy_destruct);
+
+static void prte_state_batch_construct(prte_state_batch_t *batch)
+{
+    memset(&batch->ev, 0, sizeof(prte_event_t));
+    batch->jdata = NULL;
+    batch->num = 0;
+    batch->size = 0;
+    batch->ranks = NULL;
+    batch->states = NULL;
+}
+static void prte_state_batch_destruct(prte_state_batch_t *batch)
+{
+    prte_event_del(&batch->ev);
+    if (NULL != batch->jdata) {
+        PRTE_RELEASE(batch->jdata);
+    }
+    if (NULL != batch->ranks) {
+        free(batch->ranks);
+    }
+    if (NULL != batch->states) {
+        free(batch->states);
+    }
+}
+PRTE_CLASS_INSTANCE(prte_state_batch_t,
+                   prte_object_t,
+                   prte_state_batch_construct,
+                   prte_state_batch_destruct);
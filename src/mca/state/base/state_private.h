@@ -29,6 +29,8 @@
 #include <unistd.h>
 #endif  /* HAVE_UNISTD_H */
 
+#include "src/class/prte_lifo.h"
+#include "src/sys/atomic.h"
 #include "src/mca/plm/plm_types.h"
 #include "src/runtime/prte_globals.h"
 
@@ -37,6 +39,20 @@
 BEGIN_C_DECLS
 
 PRTE_EXPORT extern bool prte_state_base_run_fdcheck;
+PRTE_EXPORT extern bool prte_state_base_collect_latency;
+PRTE_EXPORT extern int prte_state_base_update_batch_size;
+PRTE_EXPORT extern int prte_state_base_update_batch_usec;
+/* recycled state caddies, and how many are cached */
+PRTE_EXPORT extern prte_lifo_t prte_state_base_caddies;
+PRTE_EXPORT extern prte_atomic_int32_t prte_state_base_ncaddies;
+
+/* max number of caddies held for reuse */
+#define PRTE_STATE_CADDY_CACHE_MAX  1024
+
+/* release everything the base holds to run the state machines -
+ * the compiled dispatch tables, the cached caddies and any updates
+ * still queued for the HNP */
+PRTE_EXPORT void prte_state_base_cleanup(void);
 /*
  * Base functions
  */
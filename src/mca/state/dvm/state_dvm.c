@@ -274,7 +274,7 @@ static void vm_ready(int fd, short args, void *cbdata)
              * do this here so we don't have to do it for every
              * job we are going to launch */
             PMIX_DATA_BUFFER_CONSTRUCT(&buf);
-            rc = prte_util_nidmap_create(prte_node_pool, &buf);
+            rc = prte_util_nidmap_update(prte_node_pool, &buf);
             if (PRTE_SUCCESS != rc) {
                 PRTE_ERROR_LOG(rc);
                 PMIX_DATA_BUFFER_DESTRUCT(&buf);
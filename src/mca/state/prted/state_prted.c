@@ -179,16 +179,11 @@ static void track_jobs(int fd, short argc, void *cbdata)
                                 "%s state:prted:track_jobs sending local launch complete for job %s",
                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                                 PRTE_JOBID_PRINT(caddy->jdata->nspace)));
-            /* update the HNP with all proc states for this job */
+            /* update the HNP with all proc states for this job - this
+             * gets combined with updates for other jobs, so the
+             * command is added when the batch is sent
+             */
             PMIX_DATA_BUFFER_CREATE(alert);
-             /* pack update state command */
-            cmd = PRTE_PLM_UPDATE_PROC_STATE;
-            rc = PMIx_Data_pack(NULL, alert, &cmd, 1, PMIX_UINT8);
-            if (PMIX_SUCCESS != rc) {
-                PMIX_ERROR_LOG(rc);
-                PMIX_DATA_BUFFER_RELEASE(alert);
-                goto cleanup;
-            }
             /* pack the jobid */
             rc = PMIx_Data_pack(NULL, alert, &caddy->jdata->nspace, 1, PMIX_PROC_NSPACE);
             if (PMIX_SUCCESS != rc) {
@@ -255,6 +250,8 @@ static void track_jobs(int fd, short argc, void *cbdata)
                 PMIX_DATA_BUFFER_RELEASE(alert);
                 goto cleanup;
             }
+            prte_state_base_queue_update(alert);
+            alert = NULL;
             break;
 
         case PRTE_JOB_STATE_READY_FOR_DEBUG:
@@ -323,6 +320,8 @@ static void track_jobs(int fd, short argc, void *cbdata)
     }
 
     if (NULL != alert) {
+        /* anything queued for the HNP has to get there first */
+        prte_state_base_flush_updates();
         /* send it */
         if (0 > (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, alert,
                                               PRTE_RML_TAG_PLM,
@@ -435,6 +434,8 @@ static void track_procs(int fd, short argc, void *cbdata)
                     }
                 }
             }
+            /* the launch reports queued for the HNP have to get there first */
+            prte_state_base_flush_updates();
             /* send it */
             if (0 > (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, alert,
                                                   PRTE_RML_TAG_PLM,
@@ -520,31 +521,19 @@ static void track_procs(int fd, short argc, void *cbdata)
         /* track job status */
         if (jdata->num_terminated == jdata->num_local_procs &&
             !prte_get_attribute(&jdata->attributes, PRTE_JOB_TERM_NOTIFIED, NULL, PMIX_BOOL)) {
-            /* pack update state command */
-            cmd = PRTE_PLM_UPDATE_PROC_STATE;
-            PMIX_DATA_BUFFER_CREATE(alert);
-            rc = PMIx_Data_pack(NULL, alert, &cmd, 1, PMIX_UINT8);
-            if (PMIX_SUCCESS != rc) {
-                PMIX_ERROR_LOG(rc);
-                PMIX_DATA_BUFFER_RELEASE(alert);
-                goto cleanup;
-            }
             /* pack the job info */
+            PMIX_DATA_BUFFER_CREATE(alert);
             if (PRTE_SUCCESS != (rc = pack_state_update(alert, jdata))) {
                 PRTE_ERROR_LOG(rc);
                 PMIX_DATA_BUFFER_RELEASE(alert);
                 goto cleanup;
             }
-            /* send it */
+            /* queue it for the HNP */
             PRTE_OUTPUT_VERBOSE((5, prte_state_base_framework.framework_output,
-                                 "%s state:prted: SENDING JOB LOCAL TERMINATION UPDATE FOR JOB %s",
+                                 "%s state:prted: QUEUEING JOB LOCAL TERMINATION UPDATE FOR JOB %s",
                                  PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                                  PRTE_JOBID_PRINT(jdata->nspace)));
-            if (0 > (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, alert,
-                                                  PRTE_RML_TAG_PLM,
-                                                  prte_rml_send_callback, NULL))) {
-                PRTE_ERROR_LOG(rc);
-            }
+            prte_state_base_queue_update(alert);
             /* mark that we sent it so we ensure we don't do it again */
             prte_set_attribute(&jdata->attributes, PRTE_JOB_TERM_NOTIFIED, PRTE_ATTR_LOCAL, NULL, PMIX_BOOL);
             /* cleanup the procs as these are gone */
@@ -627,7 +616,7 @@ static void track_procs(int fd, short argc, void *cbdata)
             }
 
             /* cleanup the job info */
-            prte_pointer_array_set_item(prte_job_data, jdata->index, NULL);
+            prte_remove_job_data_object(jdata);
             PRTE_RELEASE(jdata);
         }
     }
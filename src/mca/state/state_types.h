@@ -39,6 +39,11 @@
  * will cause this default action to be executed. Thus, you
  * don't have to explicitly define a state-cbfunc pair
  * for every job or process state.
+ *
+ * Whenever a state is added to or removed from either list, the
+ * base compiles the list into a table indexed directly by state
+ * value (with the ANY/ERROR defaults already resolved) so that
+ * activating a state does not require searching the list.
  */
 
 #ifndef _PRTE_STATE_TYPES_H_
@@ -46,6 +51,10 @@
 
 #include "prte_config.h"
 
+#ifdef HAVE_SYS_TIME_H
+#include <sys/time.h>
+#endif
+
 #include "src/class/prte_list.h"
 #include "src/event/event-internal.h"
 
@@ -56,25 +65,52 @@ BEGIN_C_DECLS
 
 typedef void (*prte_state_cbfunc_t)(int fd, short args, void* cb);
 
+/* number of log2(usec) bins in the per-state latency histogram - the
+ * last bin collects everything at or above 2^(N-2) usec */
+#define PRTE_STATE_LATENCY_BINS 20
+
 typedef struct {
     prte_list_item_t super;
     prte_job_state_t job_state;
     prte_proc_state_t proc_state;
     prte_state_cbfunc_t cbfunc;
     int priority;
+    /* number of times the handler has been executed */
+    uint64_t count;
+    /* time from activation until the handler returned */
+    uint64_t latency[PRTE_STATE_LATENCY_BINS];
 } prte_state_t;
 PRTE_EXPORT PRTE_CLASS_DECLARATION(prte_state_t);
 
-/* caddy for passing job and proc data to state event handlers */
+/* caddy for passing job and proc data to state event handlers - these
+ * are recycled once the handler has released them, so handlers must
+ * not hold onto one without retaining it */
 typedef struct {
-    prte_object_t super;
+    prte_list_item_t super;
     prte_event_t ev;
     prte_job_t *jdata;
     prte_job_state_t job_state;
     pmix_proc_t name;
     prte_proc_state_t proc_state;
+    /* the state entry that is handling this caddy */
+    prte_state_t *state;
+    prte_state_cbfunc_t cbfunc;
+    struct timeval activated;
 } prte_state_caddy_t;
 PRTE_EXPORT PRTE_CLASS_DECLARATION(prte_state_caddy_t);
 
+/* batch of proc state updates for a single job, as
+ * reported by a daemon */
+typedef struct {
+    prte_object_t super;
+    prte_event_t ev;
+    prte_job_t *jdata;
+    int32_t num;
+    int32_t size;
+    pmix_rank_t *ranks;
+    prte_proc_state_t *states;
+} prte_state_batch_t;
+PRTE_EXPORT PRTE_CLASS_DECLARATION(prte_state_batch_t);
+
 END_C_DECLS
 #endif
@@ -287,6 +287,16 @@ void pmix_server_register_params(void)
                                   PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE,
                                   PRTE_INFO_LVL_9, PRTE_MCA_BASE_VAR_SCOPE_ALL,
                                   &prte_pmix_server_globals.system_server);
+
+    /* whether or not to register per-proc info for remote procs */
+    prte_pmix_server_globals.lazy_remote_info = false;
+    (void) prte_mca_base_var_register ("prte", "pmix", NULL, "server_lazy_remote_info",
+                                  "Only register per-proc info for local procs when registering a job "
+                                  "with the PMIx server. Info on remote procs is then derived from the "
+                                  "job's node and proc maps, or retrieved from their daemon when requested",
+                                  PRTE_MCA_BASE_VAR_TYPE_BOOL, NULL, 0, PRTE_MCA_BASE_VAR_FLAG_NONE,
+                                  PRTE_INFO_LVL_9, PRTE_MCA_BASE_VAR_SCOPE_ALL,
+                                  &prte_pmix_server_globals.lazy_remote_info);
 }
 
 static void eviction_cbfunc(struct prte_hotel_t *hotel,
@@ -365,22 +375,129 @@ static void eviction_cbfunc(struct prte_hotel_t *hotel,
     PRTE_RELEASE(req);
 }
 
+/* the dmdx index is keyed by the complete proc struct, so
+ * clear any trailing garbage in the nspace before using it */
+static void dmdx_key(pmix_proc_t *key, const pmix_proc_t *tproc)
+{
+    memset(key, 0, sizeof(pmix_proc_t));
+    PMIX_LOAD_PROCID(key, tproc->nspace, tproc->rank);
+}
+
+pmix_server_dmdx_t* pmix_server_dmdx_lookup(const pmix_proc_t *tproc,
+                                            bool create)
+{
+    pmix_server_dmdx_t *dmdx = NULL;
+    pmix_proc_t key;
+    int rc;
+
+    dmdx_key(&key, tproc);
+    rc = prte_hash_table_get_value_ptr(&prte_pmix_server_globals.dmdx,
+                                       &key, sizeof(pmix_proc_t), (void**)&dmdx);
+    if (PRTE_SUCCESS == rc || !create) {
+        return dmdx;
+    }
+    dmdx = PRTE_NEW(pmix_server_dmdx_t);
+    memcpy(&dmdx->tproc, &key, sizeof(pmix_proc_t));
+    rc = prte_hash_table_set_value_ptr(&prte_pmix_server_globals.dmdx,
+                                       &key, sizeof(pmix_proc_t), dmdx);
+    if (PRTE_SUCCESS != rc) {
+        PRTE_ERROR_LOG(rc);
+        PRTE_RELEASE(dmdx);
+        return NULL;
+    }
+    return dmdx;
+}
+
+static void dmdx_remove(pmix_server_dmdx_t *dmdx)
+{
+    prte_hash_table_remove_value_ptr(&prte_pmix_server_globals.dmdx,
+                                     &dmdx->tproc, sizeof(pmix_proc_t));
+    PRTE_RELEASE(dmdx);
+}
+
+int pmix_server_dmdx_track(pmix_server_req_t *req)
+{
+    pmix_server_dmdx_t *dmdx;
+
+    if (NULL != req->dmdx) {
+        return PRTE_SUCCESS;
+    }
+    if (NULL == (dmdx = pmix_server_dmdx_lookup(&req->tproc, true))) {
+        return PRTE_ERR_OUT_OF_RESOURCE;
+    }
+    prte_list_append(&dmdx->reqs, &req->super);
+    req->dmdx = dmdx;
+    return PRTE_SUCCESS;
+}
+
+void pmix_server_dmdx_untrack(pmix_server_req_t *req)
+{
+    pmix_server_dmdx_t *dmdx = req->dmdx;
+
+    if (NULL == dmdx) {
+        return;
+    }
+    prte_list_remove_item(&dmdx->reqs, &req->super);
+    req->dmdx = NULL;
+    if (0 == prte_list_get_size(&dmdx->reqs)) {
+        dmdx_remove(dmdx);
+    }
+}
+
+/* check out and release every request waiting on the given
+ * target, removing the tracker from the index */
+static void dmdx_clear(pmix_server_dmdx_t *dmdx)
+{
+    pmix_server_req_t *req;
+
+    while (NULL != (req = (pmix_server_req_t*)prte_list_remove_first(&dmdx->reqs))) {
+        req->dmdx = NULL;
+        prte_hotel_checkout(&prte_pmix_server_globals.reqs, req->room_num);
+        PRTE_RELEASE(req);
+    }
+    dmdx_remove(dmdx);
+}
+
 /* NOTE: this function must be called from within an event! */
 void prte_pmix_server_clear(pmix_proc_t *pname)
 {
-    int n;
-    pmix_server_req_t *req;
+    pmix_server_dmdx_t *dmdx;
+    pmix_proc_t wild;
+    prte_list_t found;
+    void *key, *node, *next;
+    size_t keylen;
+    int rc;
 
-    for (n=0; n < prte_pmix_server_globals.reqs.num_rooms; n++) {
-        prte_hotel_knock(&prte_pmix_server_globals.reqs, n, (void**)&req);
-        if (NULL != req) {
-            if (PMIX_CHECK_PROCID(&req->tproc, pname)) {
-                prte_hotel_checkout(&prte_pmix_server_globals.reqs, n);
-                PRTE_RELEASE(req);
-            }
+    if (PMIX_RANK_WILDCARD != pname->rank) {
+        if (NULL != (dmdx = pmix_server_dmdx_lookup(pname, false))) {
+            dmdx_clear(dmdx);
+        }
+        PMIX_LOAD_PROCID(&wild, pname->nspace, PMIX_RANK_WILDCARD);
+        if (NULL != (dmdx = pmix_server_dmdx_lookup(&wild, false))) {
+            dmdx_clear(dmdx);
+        }
+        return;
+    }
+
+    /* collect every target in the nspace before touching the
+     * index as we cannot modify it while iterating over it */
+    PRTE_CONSTRUCT(&found, prte_list_t);
+    rc = prte_hash_table_get_first_key_ptr(&prte_pmix_server_globals.dmdx, &key, &keylen,
+                                           (void**)&dmdx, &node);
+    while (PRTE_SUCCESS == rc) {
+        if (PMIX_CHECK_NSPACE(dmdx->tproc.nspace, pname->nspace)) {
+            prte_list_append(&found, &dmdx->super);
         }
+        rc = prte_hash_table_get_next_key_ptr(&prte_pmix_server_globals.dmdx, &key, &keylen,
+                                              (void**)&dmdx, node, &next);
+        node = next;
     }
+    while (NULL != (dmdx = (pmix_server_dmdx_t*)prte_list_remove_first(&found))) {
+        dmdx_clear(dmdx);
+    }
+    PRTE_DESTRUCT(&found);
 }
+
 /*
  * Initialize global variables used w/in the server.
  */
@@ -401,6 +518,8 @@ int pmix_server_init(void)
 
     /* setup the server's state variables */
     PRTE_CONSTRUCT(&prte_pmix_server_globals.reqs, prte_hotel_t);
+    PRTE_CONSTRUCT(&prte_pmix_server_globals.dmdx, prte_hash_table_t);
+    prte_hash_table_init(&prte_pmix_server_globals.dmdx, 256);
     PRTE_CONSTRUCT(&prte_pmix_server_globals.psets, prte_list_t);
 
     /* by the time we init the server, we should know how many nodes we
@@ -627,6 +746,7 @@ void pmix_server_finalize(void)
 
     /* cleanup collectives */
     PRTE_DESTRUCT(&prte_pmix_server_globals.reqs);
+    PRTE_DESTRUCT(&prte_pmix_server_globals.dmdx);
     PRTE_LIST_DESTRUCT(&prte_pmix_server_globals.notifications);
     PRTE_LIST_DESTRUCT(&prte_pmix_server_globals.psets);
     free(mytopology.source);
@@ -833,7 +953,9 @@ static void pmix_server_dmdx_recv(int status, pmix_proc_t* sender,
             prte_show_help("help-prted.txt", "noroom", true, req->operation, prte_pmix_server_globals.num_rooms);
             PRTE_RELEASE(req);
             send_error(rc, &pproc, sender, room_num);
+            return;
         }
+        pmix_server_dmdx_track(req);
         return;
     }
     if (NULL == (proc = (prte_proc_t*)prte_pointer_array_get_item(jdata->procs, pproc.rank))) {
@@ -875,8 +997,10 @@ static void pmix_server_dmdx_recv(int status, pmix_proc_t* sender,
                 prte_show_help("help-prted.txt", "noroom", true, req->operation, prte_pmix_server_globals.num_rooms);
                 PRTE_RELEASE(req);
                 send_error(rc, &pproc, sender, room_num);
+                return;
             }
-                prte_output_verbose(2, prte_pmix_server_globals.output,
+            pmix_server_dmdx_track(req);
+            prte_output_verbose(2, prte_pmix_server_globals.output,
                                      "%s:%d CHECKING REQ FOR KEY %s TO %d REMOTE ROOM %d",
                                      __FILE__, __LINE__, req->key, req->room_num, req->remote_room_num);
             return;
@@ -949,9 +1073,10 @@ static void pmix_server_dmdx_resp(int status, pmix_proc_t* sender,
                                   pmix_data_buffer_t *buffer,
                                   prte_rml_tag_t tg, void *cbdata)
 {
-    int room_num, rnum;
+    int room_num;
     int32_t cnt;
     pmix_server_req_t *req;
+    pmix_server_dmdx_t *dmdx;
     datacaddy_t *d;
     pmix_proc_t pproc;
     size_t psz;
@@ -1026,19 +1151,17 @@ static void pmix_server_dmdx_resp(int status, pmix_proc_t* sender,
     }
 
     /* now see if anyone else was waiting for data from this target */
-    for (rnum=0; rnum < prte_pmix_server_globals.reqs.num_rooms; rnum++) {
-        prte_hotel_knock(&prte_pmix_server_globals.reqs, rnum, (void**)&req);
-        if (NULL == req) {
-            continue;
-        }
-        if (PMIX_CHECK_PROCID(&req->tproc, &pproc)) {
+    if (NULL != (dmdx = pmix_server_dmdx_lookup(&pproc, false))) {
+        while (NULL != (req = (pmix_server_req_t*)prte_list_remove_first(&dmdx->reqs))) {
+            req->dmdx = NULL;
             if (NULL != req->mdxcbfunc) {
                 PRTE_RETAIN(d);
                 req->mdxcbfunc(pret, d->data, d->ndata, req->cbdata, relcbfunc, d);
             }
-            prte_hotel_checkout(&prte_pmix_server_globals.reqs, rnum);
+            prte_hotel_checkout(&prte_pmix_server_globals.reqs, req->room_num);
             PRTE_RELEASE(req);
         }
+        dmdx_remove(dmdx);
     }
     PRTE_RELEASE(d);  // maintain accounting
 }
@@ -1152,9 +1275,11 @@ static void rqcon(pmix_server_req_t *p)
     p->rlcbfunc = NULL;
     p->toolcbfunc = NULL;
     p->cbdata = NULL;
+    p->dmdx = NULL;
 }
 static void rqdes(pmix_server_req_t *p)
 {
+    pmix_server_dmdx_untrack(p);
     if (NULL != p->operation) {
         free(p->operation);
     }
@@ -1170,9 +1295,23 @@ static void rqdes(pmix_server_req_t *p)
     PMIX_DATA_BUFFER_DESTRUCT(&p->msg);
 }
 PRTE_CLASS_INSTANCE(pmix_server_req_t,
-                   prte_object_t,
+                   prte_list_item_t,
                    rqcon, rqdes);
 
+static void dmcon(pmix_server_dmdx_t *p)
+{
+    memset(&p->tproc, 0, sizeof(pmix_proc_t));
+    p->requested = false;
+    PRTE_CONSTRUCT(&p->reqs, prte_list_t);
+}
+static void dmdes(pmix_server_dmdx_t *p)
+{
+    PRTE_DESTRUCT(&p->reqs);
+}
+PRTE_CLASS_INSTANCE(pmix_server_dmdx_t,
+                   prte_list_item_t,
+                   dmcon, dmdes);
+
 static void mdcon(prte_pmix_mdx_caddy_t *p)
 {
     p->sig = NULL;
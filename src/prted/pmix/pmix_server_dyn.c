@@ -44,6 +44,7 @@
 #include "src/mca/errmgr/errmgr.h"
 #include "src/mca/rmaps/base/base.h"
 #include "src/mca/state/state.h"
+#include "src/mca/state/base/base.h"
 #include "src/util/name_fns.h"
 #include "src/util/show_help.h"
 #include "src/threads/threads.h"
@@ -158,7 +159,9 @@ static void spawn(int sd, short args, void *cbdata)
         goto callback;
     }
 
-    /* send it to the HNP for processing - might be myself! */
+    /* send it to the HNP for processing - might be myself! Any
+     * queued state updates must get there first */
+    prte_state_base_flush_updates();
     if (PRTE_SUCCESS != (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, buf,
                                                       PRTE_RML_TAG_PLM,
                                                       prte_rml_send_callback, NULL))) {
@@ -177,10 +177,10 @@ static void modex_resp(pmix_status_t status,
 static void dmodex_req(int sd, short args, void *cbdata)
 {
     pmix_server_req_t *req = (pmix_server_req_t*)cbdata;
-    pmix_server_req_t *r;
+    pmix_server_dmdx_t *dmdx;
     prte_job_t *jdata;
     prte_proc_t *proct, *dmn;
-    int rc, rnum;
+    int rc;
     pmix_data_buffer_t *buf;
     pmix_status_t prc = PMIX_ERROR;
     bool refresh_cache = false;
@@ -251,23 +251,19 @@ static void dmodex_req(int sd, short args, void *cbdata)
 
     /* has anyone already requested data for this target? If so,
      * then the data is already on its way */
-    for (rnum=0; rnum < prte_pmix_server_globals.reqs.num_rooms; rnum++) {
-        prte_hotel_knock(&prte_pmix_server_globals.reqs, rnum, (void**)&r);
-        if (NULL == r) {
-            continue;
-        }
-        if (PMIX_CHECK_PROCID(&r->target, &req->tproc)) {
-            /* save the request in the hotel until the
-             * data is returned */
-            if (PRTE_SUCCESS != (rc = prte_hotel_checkin(&prte_pmix_server_globals.reqs, req, &req->room_num))) {
-                prte_show_help("help-prted.txt", "noroom", true, req->operation, prte_pmix_server_globals.num_rooms);
-                /* can't just return as that would cause the requestor
-                 * to hang, so instead execute the callback */
-                prc = prte_pmix_convert_rc(rc);
-                goto callback;
-            }
-            return;
+    dmdx = pmix_server_dmdx_lookup(&req->tproc, false);
+    if (NULL != dmdx && dmdx->requested) {
+        /* save the request in the hotel until the
+         * data is returned */
+        if (PRTE_SUCCESS != (rc = prte_hotel_checkin(&prte_pmix_server_globals.reqs, req, &req->room_num))) {
+            prte_show_help("help-prted.txt", "noroom", true, req->operation, prte_pmix_server_globals.num_rooms);
+            /* can't just return as that would cause the requestor
+             * to hang, so instead execute the callback */
+            prc = prte_pmix_convert_rc(rc);
+            goto callback;
         }
+        pmix_server_dmdx_track(req);
+        return;
     }
 
     /* lookup who is hosting this proc */
@@ -283,6 +279,7 @@ static void dmodex_req(int sd, short args, void *cbdata)
             prc = prte_pmix_convert_rc(rc);
             goto callback;
         }
+        pmix_server_dmdx_track(req);
         return;
     }
     /* if this is a request for rank=WILDCARD, then they want the job-level data
@@ -331,6 +328,7 @@ static void dmodex_req(int sd, short args, void *cbdata)
         prc = prte_pmix_convert_rc(rc);
         goto callback;
     }
+    pmix_server_dmdx_track(req);
     prte_output_verbose(2, prte_pmix_server_globals.output,
                         "%s:%d MY REQ ROOM IS %d FOR KEY %s",
                         __FILE__, __LINE__, req->room_num,
@@ -346,6 +344,7 @@ static void dmodex_req(int sd, short args, void *cbdata)
     if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, buf, &req->tproc, 1, PMIX_PROC))) {
         PMIX_ERROR_LOG(prc);
         prte_hotel_checkout(&prte_pmix_server_globals.reqs, req->room_num);
+        pmix_server_dmdx_untrack(req);
         PMIX_DATA_BUFFER_RELEASE(buf);
         goto callback;
     }
@@ -353,6 +352,7 @@ static void dmodex_req(int sd, short args, void *cbdata)
     if (PMIX_SUCCESS != (prc = PMIx_Data_pack(NULL, buf, &req->room_num, 1, PMIX_INT))) {
         PMIX_ERROR_LOG(prc);
         prte_hotel_checkout(&prte_pmix_server_globals.reqs, req->room_num);
+        pmix_server_dmdx_untrack(req);
         PMIX_DATA_BUFFER_RELEASE(buf);
         goto callback;
     }
@@ -360,6 +360,7 @@ static void dmodex_req(int sd, short args, void *cbdata)
     if (PRTE_SUCCESS != (prc = PMIx_Data_pack(NULL, buf, &req->ninfo, 1, PMIX_SIZE))) {
         PMIX_ERROR_LOG(prc);
         prte_hotel_checkout(&prte_pmix_server_globals.reqs, req->room_num);
+        pmix_server_dmdx_untrack(req);
         PMIX_DATA_BUFFER_RELEASE(buf);
         goto callback;
     }
@@ -367,6 +368,7 @@ static void dmodex_req(int sd, short args, void *cbdata)
         if (PRTE_SUCCESS != (prc = PMIx_Data_pack(NULL, buf, req->info, req->ninfo, PMIX_INFO))) {
             PMIX_ERROR_LOG(prc);
             prte_hotel_checkout(&prte_pmix_server_globals.reqs, req->room_num);
+            pmix_server_dmdx_untrack(req);
             PMIX_DATA_BUFFER_RELEASE(buf);
             goto callback;
         }
@@ -377,10 +379,15 @@ static void dmodex_req(int sd, short args, void *cbdata)
                                                       prte_rml_send_callback, NULL))) {
         PRTE_ERROR_LOG(rc);
         prte_hotel_checkout(&prte_pmix_server_globals.reqs, req->room_num);
+        pmix_server_dmdx_untrack(req);
         PRTE_RELEASE(buf);
         prc = prte_pmix_convert_rc(rc);
         goto callback;
     }
+    /* anyone else asking for this target can now wait for our reply */
+    if (NULL != req->dmdx) {
+        req->dmdx->requested = true;
+    }
     return;
 
   callback:
@@ -44,6 +44,7 @@
 #include "src/mca/rmaps/rmaps_types.h"
 #include "src/mca/schizo/schizo.h"
 #include "src/mca/state/state.h"
+#include "src/mca/state/base/base.h"
 #include "src/util/name_fns.h"
 #include "src/util/show_help.h"
 #include "src/threads/threads.h"
@@ -654,7 +655,9 @@ static void _toolconn(int sd, short args, void *cbdata)
             if (PMIX_SUCCESS != rc) {
                 PMIX_ERROR_LOG(rc);
             }
-           /* send it to the HNP for processing - might be myself! */
+            /* send it to the HNP for processing - might be myself! Any
+             * queued state updates must get there first */
+            prte_state_base_flush_updates();
             if (PRTE_SUCCESS != (rc = prte_rml.send_buffer_nb(PRTE_PROC_MY_HNP, buf,
                                                               PRTE_RML_TAG_PLM,
                                                               prte_rml_send_callback, NULL))) {
@@ -41,6 +41,7 @@
 #include <pmix_server.h>
 
 #include "types.h"
+#include "src/class/prte_hash_table.h"
 #include "src/class/prte_hotel.h"
 #include "src/mca/base/base.h"
 #include "src/event/event-internal.h"
@@ -78,8 +79,8 @@ BEGIN_C_DECLS
 
 /* object for tracking requests so we can
  * correctly route the eventual reply */
- typedef struct {
-    prte_object_t super;
+typedef struct {
+    prte_list_item_t super;
     prte_event_t ev;
     char *operation;
     char *cmdline;
@@ -111,9 +112,23 @@ BEGIN_C_DECLS
     pmix_release_cbfunc_t rlcbfunc;
     pmix_tool_connection_cbfunc_t toolcbfunc;
     void *cbdata;
+    struct pmix_server_dmdx_t *dmdx;
 } pmix_server_req_t;
 PRTE_CLASS_DECLARATION(pmix_server_req_t);
 
+/* index of the direct modex requests waiting on data
+ * from a given proc - the requests themselves remain
+ * in the hotel so they are subject to its timeouts */
+typedef struct pmix_server_dmdx_t {
+    prte_list_item_t super;
+    pmix_proc_t tproc;
+    /* true if a request for this proc's data is in flight */
+    bool requested;
+    /* the pmix_server_req_t waiting on it */
+    prte_list_t reqs;
+} pmix_server_dmdx_t;
+PRTE_CLASS_DECLARATION(pmix_server_dmdx_t);
+
 /* object for thread-shifting server operations */
 typedef struct {
     prte_object_t super;
@@ -326,6 +341,12 @@ PRTE_EXPORT extern pmix_status_t pmix_server_group_fn(pmix_group_operation_t op,
                                                        const pmix_info_t directives[], size_t ndirs,
                                                        pmix_info_cbfunc_t cbfunc, void *cbdata);
 
+/* direct modex request index */
+PRTE_EXPORT pmix_server_dmdx_t* pmix_server_dmdx_lookup(const pmix_proc_t *tproc,
+                                                        bool create);
+PRTE_EXPORT int pmix_server_dmdx_track(pmix_server_req_t *req);
+PRTE_EXPORT void pmix_server_dmdx_untrack(pmix_server_req_t *req);
+
 PRTE_EXPORT void prte_pmix_server_tool_conn_complete(prte_job_t *jdata,
                                                        pmix_server_req_t *req);
 
@@ -356,6 +377,7 @@ typedef struct {
     int verbosity;
     int output;
     prte_hotel_t reqs;
+    prte_hash_table_t dmdx;
     int num_rooms;
     int timeout;
     bool wait_for_server;
@@ -365,6 +387,7 @@ typedef struct {
     bool session_server;
     bool system_server;
     bool legacy;
+    bool lazy_remote_info;
     prte_list_t psets;
 } pmix_server_globals_t;
 
@@ -56,14 +56,72 @@
 
 static void opcbfunc(pmix_status_t status, void *cbdata);
 
+/* the most info we provide for any one proc */
+#define PRTE_PMIX_MAX_PROC_INFO 13
+
+/* the per-proc info for all the procs described in a
+ * registration is carved out of a single block, with one
+ * block of data array headers pointing into it, instead of
+ * being built from a list of individually allocated items.
+ * Only the slots actually used are touched */
+typedef struct {
+    pmix_info_t *infos;
+    size_t ninfos;
+    pmix_data_array_t *arrays;
+    size_t narrays;
+} proc_info_arena_t;
+
+static pmix_info_t* proc_info_next(proc_info_arena_t *arena)
+{
+    pmix_info_t *iptr = &arena->infos[arena->ninfos++];
+
+    PMIX_INFO_CONSTRUCT(iptr);
+    return iptr;
+}
+
+static void proc_info_release(proc_info_arena_t *arena)
+{
+    size_t n;
+
+    if (NULL != arena->infos) {
+        for (n=0; n < arena->ninfos; n++) {
+            PMIX_INFO_DESTRUCT(&arena->infos[n]);
+        }
+        free(arena->infos);
+        arena->infos = NULL;
+    }
+    if (NULL != arena->arrays) {
+        free(arena->arrays);
+        arena->arrays = NULL;
+    }
+    arena->ninfos = 0;
+    arena->narrays = 0;
+}
+
+/* release the info array passed to the PMIx server - the
+ * proc data entries start at "first" and point into the
+ * arena, so detach them first */
+static void release_job_info(pmix_info_t *pinfo, size_t ninfo,
+                             size_t first, proc_info_arena_t *arena)
+{
+    size_t n;
+
+    for (n=0; n < arena->narrays; n++) {
+        pinfo[first+n].value.type = PMIX_UNDEF;
+        pinfo[first+n].value.data.darray = NULL;
+    }
+    PMIX_INFO_FREE(pinfo, ninfo);
+    proc_info_release(arena);
+}
+
 /* stuff proc attributes for sending back to a proc */
 int prte_pmix_server_register_nspace(prte_job_t *jdata)
 {
     int rc;
     prte_proc_t *pptr;
-    int i, k, n, p;
-    prte_list_t *info, *pmap, nodeinfo, appinfo;
-    prte_info_item_t *kv, *kptr;
+    int i, k, n;
+    prte_list_t *info, nodeinfo, appinfo;
+    prte_info_item_t *kv;
     prte_info_array_item_t *iarray;
     prte_node_t *node;
     pmix_rank_t vpid;
@@ -86,6 +144,10 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
     pmix_cpuset_t cpuset;
     uint32_t ui32;
     prte_job_t *parent = NULL;
+    proc_info_arena_t arena;
+    size_t nprocdata, first;
+    pmix_data_array_t *darray;
+    bool local;
 
     prte_output_verbose(2, prte_pmix_server_globals.output,
                         "%s register nspace for %s",
@@ -142,8 +204,11 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
     map = jdata->map;
     PMIX_LOAD_NSPACE(pproc.nspace, jdata->nspace);
     PRTE_CONSTRUCT(&local_procs, prte_list_t);
+    memset(&arena, 0, sizeof(arena));
+    nprocdata = 0;
     for (i=0; i < map->nodes->size; i++) {
         if (NULL != (node = (prte_node_t*)prte_pointer_array_get_item(map->nodes, i))) {
+            local = (PRTE_PROC_MY_NAME->rank == node->daemon->name.rank);
             micro = NULL;
             tmp = NULL;
             vpid = PMIX_RANK_VALID;
@@ -176,6 +241,10 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
                     }
                 }
             }
+            /* count the procs we will describe */
+            if (local || !prte_pmix_server_globals.lazy_remote_info) {
+                nprocdata += ui32;
+            }
             /* assemble the rank/node map */
             if (NULL != micro) {
                 tmp = prte_argv_join(micro, ',');
@@ -212,11 +281,15 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
             kv = PRTE_NEW(prte_info_item_t);
             PMIX_INFO_LOAD(&kv->info, PMIX_LOCALLDR, &vpid, PMIX_PROC_RANK);
             prte_list_append(&iarray->infolist, &kv->super);
-            /* add the local peers */
+            /* add the local peers - if we are not describing remote
+             * procs, leave the PMIx server to derive them from the
+             * proc map for other nodes */
             if (NULL != tmp) {
-                kv = PRTE_NEW(prte_info_item_t);
-                PMIX_INFO_LOAD(&kv->info, PMIX_LOCAL_PEERS, tmp, PMIX_STRING);
-                prte_list_append(&iarray->infolist, &kv->super);
+                if (local || !prte_pmix_server_globals.lazy_remote_info) {
+                    kv = PRTE_NEW(prte_info_item_t);
+                    PMIX_INFO_LOAD(&kv->info, PMIX_LOCAL_PEERS, tmp, PMIX_STRING);
+                    prte_list_append(&iarray->infolist, &kv->super);
+                }
                 free(tmp);
             }
             /* add to the overall payload */
@@ -404,12 +477,29 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
      * picture. This allows procs to connect to each other without
      * any further info exchange, assuming the underlying transports
      * support it. We also pass all the proc-specific data here so
-     * that each proc can lookup info about every other proc in the job */
+     * that each proc can lookup info about every other proc in the job,
+     * unless we have been asked to only describe our local procs */
+    if (0 < nprocdata) {
+        arena.infos = (pmix_info_t*)malloc(nprocdata * PRTE_PMIX_MAX_PROC_INFO * sizeof(pmix_info_t));
+        arena.arrays = (pmix_data_array_t*)calloc(nprocdata, sizeof(pmix_data_array_t));
+        if (NULL == arena.infos || NULL == arena.arrays) {
+            PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+            proc_info_release(&arena);
+            PRTE_LIST_DESTRUCT(&appinfo);
+            PRTE_LIST_DESTRUCT(&nodeinfo);
+            PRTE_LIST_RELEASE(info);
+            return PRTE_ERR_OUT_OF_RESOURCE;
+        }
+    }
 
     for (n=0; n < map->nodes->size; n++) {
         if (NULL == (node = (prte_node_t*)prte_pointer_array_get_item(map->nodes, n))) {
             continue;
         }
+        local = (PRTE_PROC_MY_NAME->rank == node->daemon->name.rank);
+        if (!local && prte_pmix_server_globals.lazy_remote_info) {
+            continue;
+        }
         /* cycle across each proc on this node, passing all data that
          * varies by proc */
         for (i=0; i < node->procs->size; i++) {
@@ -420,23 +510,28 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
             if (!PMIX_CHECK_NSPACE(pptr->name.nspace, jdata->nspace)) {
                 continue;
             }
+            if (arena.narrays == nprocdata) {
+                /* the map changed under us */
+                PRTE_ERROR_LOG(PRTE_ERR_BAD_PARAM);
+                break;
+            }
             /* setup the proc map object */
-            pmap = PRTE_NEW(prte_list_t);
+            darray = &arena.arrays[arena.narrays++];
+            darray->type = PMIX_INFO;
+            darray->array = &arena.infos[arena.ninfos];
 
             /* must start with rank */
-            kv = PRTE_NEW(prte_info_item_t);
-            PMIX_INFO_LOAD(&kv->info, PMIX_RANK, &pptr->name.rank, PMIX_PROC_RANK);
-            prte_list_append(pmap, &kv->super);
+            iptr = proc_info_next(&arena);
+            PMIX_INFO_LOAD(iptr, PMIX_RANK, &pptr->name.rank, PMIX_PROC_RANK);
 
             /* location, for local procs */
-            if (PRTE_PROC_MY_NAME->rank == node->daemon->name.rank) {
+            if (local) {
                 tmp = NULL;
                 if (prte_get_attribute(&pptr->attributes, PRTE_PROC_CPU_BITMAP, (void**)&tmp, PMIX_STRING) &&
                     NULL != tmp) {
                     /* provide the cpuset string for this proc */
-                    kv = PRTE_NEW(prte_info_item_t);
-                    PMIX_INFO_LOAD(&kv->info, PMIX_CPUSET, tmp, PMIX_STRING);
-                    prte_list_append(pmap, &kv->super);
+                    iptr = proc_info_next(&arena);
+                    PMIX_INFO_LOAD(iptr, PMIX_CPUSET, tmp, PMIX_STRING);
                     /* let PMIx generate the locality string */
                     PMIX_CPUSET_CONSTRUCT(&cpuset);
                     cpuset.source = "hwloc";
@@ -446,20 +541,19 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
                     ret = PMIx_server_generate_locality_string(&cpuset, &tmp);
                     if (PMIX_SUCCESS != ret) {
                         PMIX_ERROR_LOG(ret);
-                        PRTE_LIST_RELEASE(pmap);
+                        proc_info_release(&arena);
                         PRTE_LIST_DESTRUCT(&appinfo);
+                        PRTE_LIST_DESTRUCT(&nodeinfo);
                         PRTE_LIST_RELEASE(info);
                         return prte_pmix_convert_status(ret);
                     }
-                    kv = PRTE_NEW(prte_info_item_t);
-                    PMIX_INFO_LOAD(&kv->info, PMIX_LOCALITY_STRING, tmp, PMIX_STRING);
-                    prte_list_append(pmap, &kv->super);
+                    iptr = proc_info_next(&arena);
+                    PMIX_INFO_LOAD(iptr, PMIX_LOCALITY_STRING, tmp, PMIX_STRING);
                     free(tmp);
                 } else {
                     /* the proc is not bound */
-                    kv = PRTE_NEW(prte_info_item_t);
-                    PMIX_INFO_LOAD(&kv->info, PMIX_LOCALITY_STRING, NULL, PMIX_STRING);
-                    prte_list_append(pmap, &kv->super);
+                    iptr = proc_info_next(&arena);
+                    PMIX_INFO_LOAD(iptr, PMIX_LOCALITY_STRING, NULL, PMIX_STRING);
                 }
                 /* debugger daemons and tools don't get session directories */
                 if (!PRTE_FLAG_TEST(jdata, PRTE_JOB_FLAG_DEBUGGER_DAEMON) &&
@@ -469,87 +563,72 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
                                            prte_process_info.jobfam_session_dir,
                                            PRTE_LOCAL_JOBID(jdata->nspace), pptr->name.rank)) {
                         PRTE_ERROR_LOG(PRTE_ERR_OUT_OF_RESOURCE);
+                        proc_info_release(&arena);
+                        PRTE_LIST_DESTRUCT(&appinfo);
+                        PRTE_LIST_DESTRUCT(&nodeinfo);
+                        PRTE_LIST_RELEASE(info);
                         return PRTE_ERR_OUT_OF_RESOURCE;
                     }
                     if (PRTE_SUCCESS != (rc = prte_os_dirpath_create(tmp, S_IRWXU))) {
                         PRTE_ERROR_LOG(rc);
+                        free(tmp);
+                        proc_info_release(&arena);
+                        PRTE_LIST_DESTRUCT(&appinfo);
+                        PRTE_LIST_DESTRUCT(&nodeinfo);
+                        PRTE_LIST_RELEASE(info);
                         return rc;
                     }
-                    kv = PRTE_NEW(prte_info_item_t);
-                    PMIX_INFO_LOAD(&kv->info, PMIX_PROCDIR, tmp, PMIX_STRING);
+                    iptr = proc_info_next(&arena);
+                    PMIX_INFO_LOAD(iptr, PMIX_PROCDIR, tmp, PMIX_STRING);
                     free(tmp);
-                    prte_list_append(pmap, &kv->super);
                 }
             }
 
             /* global/univ rank */
-            kv = PRTE_NEW(prte_info_item_t);
             vpid = pptr->name.rank + jdata->offset;
-            PMIX_INFO_LOAD(&kv->info, PMIX_GLOBAL_RANK, &vpid, PMIX_PROC_RANK);
-            prte_list_append(pmap, &kv->super);
+            iptr = proc_info_next(&arena);
+            PMIX_INFO_LOAD(iptr, PMIX_GLOBAL_RANK, &vpid, PMIX_PROC_RANK);
 
             /* parent ID, if we were spawned by a non-tool */
             if (NULL != parent) {
-                kv = PRTE_NEW(prte_info_item_t);
-                PMIX_INFO_LOAD(&kv->info, PMIX_PARENT_ID, parentproc, PMIX_PROC);
-                prte_list_append(pmap, &kv->super);
+                iptr = proc_info_next(&arena);
+                PMIX_INFO_LOAD(iptr, PMIX_PARENT_ID, parentproc, PMIX_PROC);
             }
 
             /* appnum */
-            kv = PRTE_NEW(prte_info_item_t);
-            PMIX_INFO_LOAD(&kv->info, PMIX_APPNUM, &pptr->app_idx, PMIX_UINT32);
-            prte_list_append(pmap, &kv->super);
+            iptr = proc_info_next(&arena);
+            PMIX_INFO_LOAD(iptr, PMIX_APPNUM, &pptr->app_idx, PMIX_UINT32);
 
             /* app rank */
-            kv = PRTE_NEW(prte_info_item_t);
-            PMIX_INFO_LOAD(&kv->info, PMIX_APP_RANK, &pptr->app_rank, PMIX_PROC_RANK);
-            prte_list_append(pmap, &kv->super);
+            iptr = proc_info_next(&arena);
+            PMIX_INFO_LOAD(iptr, PMIX_APP_RANK, &pptr->app_rank, PMIX_PROC_RANK);
 
             /* local rank */
             if (PRTE_LOCAL_RANK_INVALID != pptr->local_rank) {
-                kv = PRTE_NEW(prte_info_item_t);
-                PMIX_INFO_LOAD(&kv->info, PMIX_LOCAL_RANK, &pptr->local_rank, PMIX_UINT16);
-                prte_list_append(pmap, &kv->super);
+                iptr = proc_info_next(&arena);
+                PMIX_INFO_LOAD(iptr, PMIX_LOCAL_RANK, &pptr->local_rank, PMIX_UINT16);
             }
 
             /* node rank */
             if (PRTE_NODE_RANK_INVALID != pptr->node_rank) {
-                kv = PRTE_NEW(prte_info_item_t);
-                PMIX_INFO_LOAD(&kv->info, PMIX_NODE_RANK, &pptr->node_rank, PMIX_UINT16);
-                prte_list_append(pmap, &kv->super);
+                iptr = proc_info_next(&arena);
+                PMIX_INFO_LOAD(iptr, PMIX_NODE_RANK, &pptr->node_rank, PMIX_UINT16);
             }
 
             /* node ID */
-            kv = PRTE_NEW(prte_info_item_t);
-            PMIX_INFO_LOAD(&kv->info, PMIX_NODEID, &pptr->node->index, PMIX_UINT32);
-            prte_list_append(pmap, &kv->super);
+            iptr = proc_info_next(&arena);
+            PMIX_INFO_LOAD(iptr, PMIX_NODEID, &pptr->node->index, PMIX_UINT32);
 
             /* reincarnation number */
             ui32 = 0;  // we are starting this proc for the first time
-            kv = PRTE_NEW(prte_info_item_t);
-            PMIX_INFO_LOAD(&kv->info, PMIX_REINCARNATION, &ui32, PMIX_UINT32);
-            prte_list_append(pmap, &kv->super);
+            iptr = proc_info_next(&arena);
+            PMIX_INFO_LOAD(iptr, PMIX_REINCARNATION, &ui32, PMIX_UINT32);
 
             if (map->num_nodes < prte_hostname_cutoff) {
-                kv = PRTE_NEW(prte_info_item_t);
-                PMIX_INFO_LOAD(&kv->info, PMIX_HOSTNAME, pptr->node->name, PMIX_STRING);
-                prte_list_append(pmap, &kv->super);
+                iptr = proc_info_next(&arena);
+                PMIX_INFO_LOAD(iptr, PMIX_HOSTNAME, pptr->node->name, PMIX_STRING);
             }
-            kv = PRTE_NEW(prte_info_item_t);
-            PMIX_LOAD_KEY(kv->info.key, PMIX_PROC_DATA);
-            kv->info.value.type = PMIX_DATA_ARRAY;
-            ninfo = prte_list_get_size(pmap);
-            if (0 < ninfo) {
-                PMIX_DATA_ARRAY_CREATE(kv->info.value.data.darray, ninfo, PMIX_INFO);
-                pinfo = (pmix_info_t*)kv->info.value.data.darray->array;
-                p = 0;
-                while (NULL != (kptr = (prte_info_item_t*)prte_list_remove_first(pmap))) {
-                    PMIX_INFO_XFER(&pinfo[p], &kptr->info);
-                    PRTE_RELEASE(kptr);
-                    ++p;
-                }
-            }
-            prte_list_append(info, &kv->super);
+            darray->size = &arena.infos[arena.ninfos] - (pmix_info_t*)darray->array;
         }
     }
     if (NULL != parent) {
@@ -560,7 +639,7 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
     prte_set_attribute(&jdata->attributes, PRTE_JOB_NSPACE_REGISTERED, PRTE_ATTR_LOCAL, NULL, PMIX_BOOL);
 
     /* pass it down */
-    ninfo = prte_list_get_size(info) + prte_list_get_size(&nodeinfo) + prte_list_get_size(&appinfo);
+    ninfo = prte_list_get_size(info) + arena.narrays + prte_list_get_size(&nodeinfo) + prte_list_get_size(&appinfo);
     /* if there are local procs, then we add that here */
     if (0 < (nmsize = prte_list_get_size(&local_procs))) {
         ++ninfo;
@@ -595,6 +674,15 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
     }
     PRTE_LIST_RELEASE(info);
 
+    /* now point at the proc data */
+    first = n;
+    for (k=0; k < (int)arena.narrays; k++) {
+        PMIX_LOAD_KEY(pinfo[n].key, PMIX_PROC_DATA);
+        pinfo[n].value.type = PMIX_DATA_ARRAY;
+        pinfo[n].value.data.darray = &arena.arrays[k];
+        ++n;
+    }
+
     /* now load the node info */
     PRTE_LIST_FOREACH(iarray, &nodeinfo, prte_info_array_item_t) {
         nmsize = prte_list_get_size(&iarray->infolist);
@@ -635,8 +723,7 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
     if (PMIX_SUCCESS != ret) {
         PMIX_ERROR_LOG(ret);
         rc = prte_pmix_convert_status(ret);
-        PMIX_INFO_FREE(pinfo, ninfo);
-        PRTE_LIST_RELEASE(info);
+        release_job_info(pinfo, ninfo, first, &arena);
         PRTE_PMIX_DESTRUCT_LOCK(&lock);
         return rc;
     }
@@ -644,7 +731,7 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
     rc = lock.status;
     PRTE_PMIX_DESTRUCT_LOCK(&lock);
     if (PRTE_SUCCESS != rc) {
-        PMIX_INFO_FREE(pinfo, ninfo);
+        release_job_info(pinfo, ninfo, first, &arena);
         return rc;
     }
 
@@ -665,18 +752,18 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
         if (PMIX_SUCCESS != ret) {
             PMIX_ERROR_LOG(ret);
             rc = prte_pmix_convert_status(ret);
-            PMIX_INFO_FREE(pinfo, ninfo);
+            release_job_info(pinfo, ninfo, first, &arena);
             return rc;
         }
         ret = PMIx_Data_pack(NULL, &pbkt, pinfo, ninfo, PMIX_INFO);
         if (PMIX_SUCCESS != ret) {
             PMIX_ERROR_LOG(ret);
             rc = prte_pmix_convert_status(ret);
-            PMIX_INFO_FREE(pinfo, ninfo);
+            release_job_info(pinfo, ninfo, first, &arena);
             PMIX_DATA_BUFFER_DESTRUCT(&pbkt);
             return rc;
         }
-        PMIX_INFO_FREE(pinfo, ninfo);
+        release_job_info(pinfo, ninfo, first, &arena);
         ret = PMIx_Data_unload(&pbkt, &pbo);
         if (PMIX_SUCCESS != ret) {
             PMIX_ERROR_LOG(ret);
@@ -713,15 +800,16 @@ int prte_pmix_server_register_nspace(prte_job_t *jdata)
             PMIX_ERROR_LOG(ret);
             rc = prte_pmix_convert_status(ret);
             PMIX_INFO_FREE(pinfo, ninfo);
-            PRTE_LIST_RELEASE(info);
             PRTE_PMIX_DESTRUCT_LOCK(&lock);
             return rc;
         }
         PRTE_PMIX_WAIT_THREAD(&lock);
         rc = lock.status;
         PRTE_PMIX_DESTRUCT_LOCK(&lock);
+        PMIX_INFO_FREE(pinfo, ninfo);
+        return rc;
     }
-    PMIX_INFO_FREE(pinfo, ninfo);
+    release_job_info(pinfo, ninfo, first, &arena);
 
     return rc;
 }
@@ -255,6 +255,12 @@ void prte_daemon_recv(int status, pmix_proc_t* sender,
                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME));
         }
 
+        /* if this launch depends on jobs we have yet to hear
+         * about, it will be launched once we have them */
+        if (prte_odls_base_hold_launch(buffer)) {
+            break;
+        }
+
         /* launch the processes */
         if (PRTE_SUCCESS != (ret = prte_odls.launch_local_procs(buffer))) {
             PRTE_OUTPUT_VERBOSE((1, prte_debug_output,
@@ -615,6 +621,37 @@ void prte_daemon_recv(int status, pmix_proc_t* sender,
         }
         break;
 
+        /****     JOB CATALOG REQUEST    ****/
+    case PRTE_DAEMON_JOB_CATALOG_CMD:
+        {
+            uint32_t lo, hi;
+
+            n = 1;
+            ret = PMIx_Data_unpack(NULL, buffer, &lo, &n, PMIX_UINT32);
+            if (PMIX_SUCCESS != ret) {
+                PMIX_ERROR_LOG(ret);
+                goto CLEANUP;
+            }
+            n = 1;
+            ret = PMIx_Data_unpack(NULL, buffer, &hi, &n, PMIX_UINT32);
+            if (PMIX_SUCCESS != ret) {
+                PMIX_ERROR_LOG(ret);
+                goto CLEANUP;
+            }
+            PMIX_DATA_BUFFER_CREATE(answer);
+            if (PRTE_SUCCESS != (ret = prte_odls_base_pack_job_catalog(answer, lo, hi))) {
+                PRTE_ERROR_LOG(ret);
+                PMIX_DATA_BUFFER_RELEASE(answer);
+                goto CLEANUP;
+            }
+            if (0 > (ret = prte_rml.send_buffer_nb(sender, answer, PRTE_RML_TAG_JOB_CATALOG,
+                                                   prte_rml_send_callback, NULL))) {
+                PRTE_ERROR_LOG(ret);
+                PMIX_DATA_BUFFER_RELEASE(answer);
+            }
+        }
+        break;
+
     case PRTE_DAEMON_GET_STACK_TRACES:
         /* prep the response */
         PMIX_DATA_BUFFER_CREATE(answer);
@@ -767,6 +804,9 @@ static char *get_prted_comm_cmd_str(int command)
     case PRTE_DAEMON_DVM_CLEANUP_JOB_CMD:
         return strdup("PRTE_DAEMON_DVM_CLEANUP_JOB_CMD");
 
+    case PRTE_DAEMON_JOB_CATALOG_CMD:
+        return strdup("PRTE_DAEMON_JOB_CATALOG_CMD");
+
     default:
         return strdup("Unknown Command!");
     }
@@ -68,7 +68,7 @@ int prte_job_pack(pmix_data_buffer_t *bkt,
 
     /* pack the attributes that need to be sent */
     count = 0;
-    PRTE_LIST_FOREACH(kv, &job->attributes, prte_attribute_t) {
+    PRTE_LIST_FOREACH(kv, &job->attributes.super, prte_attribute_t) {
         if (PRTE_ATTR_GLOBAL == kv->local) {
             ++count;
         }
@@ -78,7 +78,7 @@ int prte_job_pack(pmix_data_buffer_t *bkt,
         PMIX_ERROR_LOG(rc);
         return prte_pmix_convert_status(rc);
     }
-    PRTE_LIST_FOREACH(kv, &job->attributes, prte_attribute_t) {
+    PRTE_LIST_FOREACH(kv, &job->attributes.super, prte_attribute_t) {
         if (PRTE_ATTR_GLOBAL == kv->local) {
             rc = PMIx_Data_pack(NULL, bkt, (void*)&kv->key, 1, PMIX_UINT16);
             if (PMIX_SUCCESS != rc) {
@@ -306,7 +306,7 @@ int prte_node_pack(pmix_data_buffer_t *bkt,
 
     /* pack any shared attributes */
     count = 0;
-    PRTE_LIST_FOREACH(kv, &node->attributes, prte_attribute_t) {
+    PRTE_LIST_FOREACH(kv, &node->attributes.super, prte_attribute_t) {
         if (PRTE_ATTR_GLOBAL == kv->local) {
             ++count;
         }
@@ -317,7 +317,7 @@ int prte_node_pack(pmix_data_buffer_t *bkt,
         return prte_pmix_convert_status(rc);
     }
     if (0 < count) {
-        PRTE_LIST_FOREACH(kv, &node->attributes, prte_attribute_t) {
+        PRTE_LIST_FOREACH(kv, &node->attributes.super, prte_attribute_t) {
             if (PRTE_ATTR_GLOBAL == kv->local) {
                 rc = PMIx_Data_pack(NULL, bkt, (void*)&kv->key, 1, PMIX_UINT16);
                 if (PMIX_SUCCESS != rc) {
@@ -395,7 +395,7 @@ int prte_proc_pack(pmix_data_buffer_t *bkt,
 
     /* pack the attributes that will go */
     count = 0;
-    PRTE_LIST_FOREACH(kv, &proc->attributes, prte_attribute_t) {
+    PRTE_LIST_FOREACH(kv, &proc->attributes.super, prte_attribute_t) {
         if (PRTE_ATTR_GLOBAL == kv->local) {
             ++count;
         }
@@ -406,7 +406,7 @@ int prte_proc_pack(pmix_data_buffer_t *bkt,
         return prte_pmix_convert_status(rc);
     }
     if (0 < count) {
-        PRTE_LIST_FOREACH(kv, &proc->attributes, prte_attribute_t) {
+        PRTE_LIST_FOREACH(kv, &proc->attributes.super, prte_attribute_t) {
             if (PRTE_ATTR_GLOBAL == kv->local) {
                 rc = PMIx_Data_pack(NULL, bkt, (void*)&kv->key, 1, PMIX_UINT16);
                 if (PMIX_SUCCESS != rc) {
@@ -506,7 +506,7 @@ int prte_app_pack(pmix_data_buffer_t *bkt,
 
     /* pack attributes */
     count = 0;
-    PRTE_LIST_FOREACH(kv, &app->attributes, prte_attribute_t) {
+    PRTE_LIST_FOREACH(kv, &app->attributes.super, prte_attribute_t) {
         if (PRTE_ATTR_GLOBAL == kv->local) {
             ++count;
         }
@@ -517,7 +517,7 @@ int prte_app_pack(pmix_data_buffer_t *bkt,
         return prte_pmix_convert_status(rc);
     }
     if (0 < count) {
-        PRTE_LIST_FOREACH(kv, &app->attributes, prte_attribute_t) {
+        PRTE_LIST_FOREACH(kv, &app->attributes.super, prte_attribute_t) {
             if (PRTE_ATTR_GLOBAL == kv->local) {
                 rc = PMIx_Data_pack(NULL, bkt, (void*)&kv->key, 1, PMIX_UINT16);
                 if (PMIX_SUCCESS != rc) {
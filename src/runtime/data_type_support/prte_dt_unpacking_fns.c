@@ -106,7 +106,7 @@ int prte_job_unpack(pmix_data_buffer_t *bkt,
             return prte_pmix_convert_status(rc);
         }
         kv->local = PRTE_ATTR_GLOBAL;  // obviously not a local value
-        prte_list_append(&jptr->attributes, &kv->super);
+        prte_attr_list_append(&jptr->attributes, kv);
     }
     /* unpack any job info */
     n=1;
@@ -370,7 +370,7 @@ int prte_node_unpack(pmix_data_buffer_t *bkt,
             return prte_pmix_convert_status(rc);
         }
         kv->local = PRTE_ATTR_GLOBAL;  // obviously not a local value
-        prte_list_append(&node->attributes, &kv->super);
+        prte_attr_list_append(&node->attributes, kv);
     }
     *nd = node;
     return PRTE_SUCCESS;
@@ -482,7 +482,7 @@ int prte_proc_unpack(pmix_data_buffer_t *bkt,
             return prte_pmix_convert_status(rc);
         }
         kv->local = PRTE_ATTR_GLOBAL;  // obviously not a local value
-        prte_list_append(&proc->attributes, &kv->super);
+        prte_attr_list_append(&proc->attributes, kv);
     }
     *pc = proc;
     return PRTE_SUCCESS;
@@ -616,7 +616,7 @@ int prte_app_unpack(pmix_data_buffer_t *bkt,
             return prte_pmix_convert_status(rc);
         }
         kv->local = PRTE_ATTR_GLOBAL;  // obviously not a local value
-        prte_list_append(&app->attributes, &kv->super);
+        prte_attr_list_append(&app->attributes, kv);
     }
     *ap = app;
     return PRTE_SUCCESS;
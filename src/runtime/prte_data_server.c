@@ -35,6 +35,7 @@
 
 #include "src/util/argv.h"
 #include "src/util/output.h"
+#include "src/class/prte_hash_table.h"
 #include "src/class/prte_pointer_array.h"
 #include "src/pmix/pmix-internal.h"
 
@@ -115,13 +116,266 @@ static PRTE_CLASS_INSTANCE(prte_data_req_t,
                           prte_list_item_t,
                           rqcon, rqdes);
 
+/* define an object to track an individual published
+ * value so it can be found by its key */
+typedef struct {
+    prte_list_item_t super;
+    prte_data_object_t *data;
+    pmix_info_t *info;
+} prte_data_posting_t;
+static PRTE_CLASS_INSTANCE(prte_data_posting_t,
+                          prte_list_item_t,
+                          NULL, NULL);
+
+/* define an object to track a pending request
+ * that is waiting for a key to be published */
+typedef struct {
+    prte_list_item_t super;
+    prte_data_req_t *req;
+} prte_data_waiter_t;
+static void wtcon(prte_data_waiter_t *p)
+{
+    p->req = NULL;
+}
+static void wtdes(prte_data_waiter_t *p)
+{
+    if (NULL != p->req) {
+        PRTE_RELEASE(p->req);
+    }
+}
+static PRTE_CLASS_INSTANCE(prte_data_waiter_t,
+                          prte_list_item_t,
+                          wtcon, wtdes);
+
+/* define an object to hold everything we know
+ * about a given (uid, key) pair */
+typedef struct {
+    prte_object_t super;
+    prte_list_t postings;
+    prte_list_t waiters;
+} prte_data_bucket_t;
+static void bkcon(prte_data_bucket_t *p)
+{
+    PRTE_CONSTRUCT(&p->postings, prte_list_t);
+    PRTE_CONSTRUCT(&p->waiters, prte_list_t);
+}
+static void bkdes(prte_data_bucket_t *p)
+{
+    PRTE_LIST_DESTRUCT(&p->postings);
+    PRTE_LIST_DESTRUCT(&p->waiters);
+}
+static PRTE_CLASS_INSTANCE(prte_data_bucket_t,
+                          prte_object_t,
+                          bkcon, bkdes);
+
 /* local globals */
 static prte_pointer_array_t prte_data_server_store;
+static prte_hash_table_t prte_data_server_index;
 static prte_list_t pending;
 static bool initialized = false;
 static int prte_data_server_output = -1;
 static int prte_data_server_verbosity = -1;
 
+/* the index is keyed by the uid of the publisher followed by the key
+ * itself - the uid is part of the key because data can only be
+ * accessed by the user that posted it */
+#define PRTE_DS_KEYLEN (sizeof(uint32_t) + PMIX_MAX_KEYLEN + 1)
+
+static size_t ds_key(char *kbuf, uint32_t uid, const char *key)
+{
+    size_t len;
+
+    len = strnlen(key, PMIX_MAX_KEYLEN);
+    memcpy(kbuf, &uid, sizeof(uint32_t));
+    memcpy(kbuf + sizeof(uint32_t), key, len);
+    return sizeof(uint32_t) + len;
+}
+
+static prte_data_bucket_t* get_bucket(uint32_t uid, const char *key, bool create)
+{
+    char kbuf[PRTE_DS_KEYLEN];
+    size_t klen;
+    prte_data_bucket_t *bucket = NULL;
+
+    klen = ds_key(kbuf, uid, key);
+    if (PRTE_SUCCESS == prte_hash_table_get_value_ptr(&prte_data_server_index, kbuf,
+                                                      klen, (void**)&bucket)) {
+        return bucket;
+    }
+    if (!create) {
+        return NULL;
+    }
+    bucket = PRTE_NEW(prte_data_bucket_t);
+    prte_hash_table_set_value_ptr(&prte_data_server_index, kbuf, klen, bucket);
+    return bucket;
+}
+
+/* drop a bucket once nothing is posted to it and nobody is waiting on it */
+static void prune_bucket(uint32_t uid, const char *key, prte_data_bucket_t *bucket)
+{
+    char kbuf[PRTE_DS_KEYLEN];
+    size_t klen;
+
+    if (0 < prte_list_get_size(&bucket->postings) ||
+        0 < prte_list_get_size(&bucket->waiters)) {
+        return;
+    }
+    klen = ds_key(kbuf, uid, key);
+    prte_hash_table_remove_value_ptr(&prte_data_server_index, kbuf, klen);
+    PRTE_RELEASE(bucket);
+}
+
+/* remove a published value from the index - must be
+ * called before the key is cleared */
+static void unindex(uint32_t uid, pmix_info_t *info)
+{
+    prte_data_bucket_t *bucket;
+    prte_data_posting_t *posting;
+
+    if (NULL == (bucket = get_bucket(uid, info->key, false))) {
+        return;
+    }
+    PRTE_LIST_FOREACH(posting, &bucket->postings, prte_data_posting_t) {
+        if (posting->info == info) {
+            prte_list_remove_item(&bucket->postings, &posting->super);
+            PRTE_RELEASE(posting);
+            break;
+        }
+    }
+    prune_bucket(uid, info->key, bucket);
+}
+
+/* remove a data object and all of its remaining values */
+static void release_data(prte_data_object_t *data)
+{
+    size_t n;
+
+    for (n=0; n < data->ninfo; n++) {
+        if (0 < strlen(data->info[n].key)) {
+            unindex(data->uid, &data->info[n]);
+        }
+    }
+    prte_pointer_array_set_item(&prte_data_server_store, data->index, NULL);
+    PRTE_RELEASE(data);
+}
+
+/* remove a request from the wait queue of each of its keys */
+static void remove_waiters(prte_data_req_t *req)
+{
+    prte_data_bucket_t *bucket;
+    prte_data_waiter_t *waiter, *wnext;
+    int i;
+
+    for (i=0; NULL != req->keys[i]; i++) {
+        if (NULL == (bucket = get_bucket(req->uid, req->keys[i], false))) {
+            continue;
+        }
+        PRTE_LIST_FOREACH_SAFE(waiter, wnext, &bucket->waiters, prte_data_waiter_t) {
+            if (waiter->req == req) {
+                prte_list_remove_item(&bucket->waiters, &waiter->super);
+                PRTE_RELEASE(waiter);
+            }
+        }
+        prune_bucket(req->uid, req->keys[i], bucket);
+    }
+}
+
+/* send the data collected for a pending request back to the requestor */
+static void send_pending(prte_data_req_t *req)
+{
+    pmix_data_buffer_t *reply, pbkt;
+    pmix_byte_object_t pbo;
+    prte_ds_info_t *rinfo;
+    uint8_t command;
+    size_t n;
+    int rc, status;
+
+    n = prte_list_get_size(&req->answers);
+
+    prte_output_verbose(1, prte_data_server_output,
+                         "%s data server: returning data to %s:%d",
+                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
+                         req->requestor.nspace, req->requestor.rank);
+
+    PMIX_DATA_BUFFER_CREATE(reply);
+    /* start with their room number */
+    rc = PMIx_Data_pack(NULL, reply, &req->room_number, 1, PMIX_INT);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        PMIX_DATA_BUFFER_RELEASE(reply);
+        return;
+    }
+    /* we are responding to a lookup cmd */
+    command = PRTE_PMIX_LOOKUP_CMD;
+    rc = PMIx_Data_pack(NULL, reply, &command, 1, PMIX_UINT8);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        PMIX_DATA_BUFFER_RELEASE(reply);
+        return;
+    }
+    /* if we found all of the requested keys, then indicate so */
+    if (n == (size_t)prte_argv_count(req->keys)) {
+        status = PRTE_SUCCESS;
+    } else {
+        status = PRTE_ERR_PARTIAL_SUCCESS;
+    }
+    /* return the status */
+    rc = PMIx_Data_pack(NULL, reply, &status, 1, PMIX_INT);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        PMIX_DATA_BUFFER_RELEASE(reply);
+        return;
+    }
+
+    /* pack the rest into a pmix_data_buffer_t */
+    PMIX_DATA_BUFFER_CONSTRUCT(&pbkt);
+
+    /* pack the number of returned info's */
+    if (PMIX_SUCCESS != (rc = PMIx_Data_pack(NULL, &pbkt, &n, 1, PMIX_SIZE))) {
+        PMIX_ERROR_LOG(rc);
+        PMIX_DATA_BUFFER_DESTRUCT(&pbkt);
+        PMIX_DATA_BUFFER_RELEASE(reply);
+        return;
+    }
+    /* loop thru and pack the individual responses - this is somewhat less
+     * efficient than packing an info array, but avoids another malloc
+     * operation just to assemble all the return values into a contiguous
+     * array */
+    PRTE_LIST_FOREACH(rinfo, &req->answers, prte_ds_info_t) {
+        /* pack the data owner */
+        if (PMIX_SUCCESS != (rc = PMIx_Data_pack(NULL, &pbkt, &rinfo->source, 1, PMIX_PROC))) {
+            PMIX_ERROR_LOG(rc);
+            PMIX_DATA_BUFFER_DESTRUCT(&pbkt);
+            PMIX_DATA_BUFFER_RELEASE(reply);
+            return;
+        }
+        /* pack the data */
+        if (PMIX_SUCCESS != (rc = PMIx_Data_pack(NULL, &pbkt, rinfo->info, 1, PMIX_INFO))) {
+            PMIX_ERROR_LOG(rc);
+            PMIX_DATA_BUFFER_DESTRUCT(&pbkt);
+            PMIX_DATA_BUFFER_RELEASE(reply);
+            return;
+        }
+    }
+
+    /* unload the pmix buffer */
+    rc = PMIx_Data_unload(&pbkt, &pbo);
+
+    /* pack it into our reply */
+    rc = PMIx_Data_pack(NULL, reply, &pbo, 1, PMIX_BYTE_OBJECT);
+    PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
+    if (PMIX_SUCCESS != rc) {
+        PMIX_ERROR_LOG(rc);
+        PMIX_DATA_BUFFER_RELEASE(reply);
+        return;
+    }
+    if (0 > (rc = prte_rml.send_buffer_nb(&req->proxy, reply, PRTE_RML_TAG_DATA_CLIENT,
+                                          prte_rml_send_callback, NULL))) {
+        PRTE_ERROR_LOG(rc);
+        PMIX_DATA_BUFFER_RELEASE(reply);
+    }
+}
+
 int prte_data_server_init(void)
 {
     int rc;
@@ -154,6 +408,9 @@ int prte_data_server_init(void)
         return rc;
     }
 
+    PRTE_CONSTRUCT(&prte_data_server_index, prte_hash_table_t);
+    prte_hash_table_init(&prte_data_server_index, 1024);
+
     PRTE_CONSTRUCT(&pending, prte_list_t);
 
     prte_rml.recv_buffer_nb(PRTE_NAME_WILDCARD,
@@ -169,12 +426,24 @@ void prte_data_server_finalize(void)
 {
     int32_t i;
     prte_data_object_t *data;
+    prte_data_bucket_t *bucket;
+    void *key, *nptr;
+    size_t size;
 
     if (!initialized) {
         return;
     }
     initialized = false;
 
+    if (PRTE_SUCCESS == prte_hash_table_get_first_key_ptr(&prte_data_server_index, &key, &size,
+                                                          (void**)&bucket, &nptr)) {
+        do {
+            PRTE_RELEASE(bucket);
+        } while (PRTE_SUCCESS == prte_hash_table_get_next_key_ptr(&prte_data_server_index, &key, &size,
+                                                                  (void**)&bucket, nptr, &nptr));
+    }
+    PRTE_DESTRUCT(&prte_data_server_index);
+
     for (i=0; i < prte_data_server_store.size; i++) {
         if (NULL != (data = (prte_data_object_t*)prte_pointer_array_get_item(&prte_data_server_store, i))) {
             PRTE_RELEASE(data);
@@ -191,7 +460,7 @@ void prte_data_server(int status, pmix_proc_t* sender,
     uint8_t command;
     int32_t count;
     prte_data_object_t *data;
-    pmix_data_buffer_t *answer, *reply;
+    pmix_data_buffer_t *answer;
     int rc, k;
     uint32_t ninfo, i;
     char **keys = NULL, *str;
@@ -199,7 +468,11 @@ void prte_data_server(int status, pmix_proc_t* sender,
     int room_number;
     uint32_t uid = UINT32_MAX;
     pmix_data_range_t range;
-    prte_data_req_t *req, *rqnext;
+    prte_data_req_t *req;
+    prte_data_bucket_t *bucket;
+    prte_data_posting_t *posting, *pnext, *dup, *dnext;
+    prte_data_waiter_t *waiter;
+    prte_list_t ready;
     pmix_data_buffer_t pbkt;
     pmix_byte_object_t pbo;
     pmix_status_t ret;
@@ -332,129 +605,51 @@ void prte_data_server(int status, pmix_proc_t* sender,
                             "%s data server: checking for pending requests",
                             PRTE_NAME_PRINT(PRTE_PROC_MY_NAME));
 
-        /* check for pending requests that match this data */
-        reply = NULL;
-        PRTE_LIST_FOREACH_SAFE(req, rqnext, &pending, prte_data_req_t) {
-            if (req->uid != data->uid) {
-                continue;
-            }
-            /* if the published range is constrained to namespace, then only
-             * consider this data if the publisher is
-             * in the same namespace as the requestor */
-            if (PMIX_RANGE_NAMESPACE == data->range) {
-                if (0 != strncmp(req->requestor.nspace, data->owner.nspace, PMIX_MAX_NSLEN)) {
+        /* index each of the values, checking for pending requests
+         * that are waiting on it as we go */
+        PRTE_CONSTRUCT(&ready, prte_list_t);
+        for (n=0; n < data->ninfo; n++) {
+            bucket = get_bucket(data->uid, data->info[n].key, true);
+            posting = PRTE_NEW(prte_data_posting_t);
+            posting->data = data;
+            posting->info = &data->info[n];
+            prte_list_append(&bucket->postings, &posting->super);
+
+            PRTE_LIST_FOREACH(waiter, &bucket->waiters, prte_data_waiter_t) {
+                req = waiter->req;
+                /* if the published range is constrained to namespace, then only
+                 * consider this data if the publisher is
+                 * in the same namespace as the requestor */
+                if (PMIX_RANGE_NAMESPACE == data->range &&
+                    0 != strncmp(req->requestor.nspace, data->owner.nspace, PMIX_MAX_NSLEN)) {
                     continue;
                 }
-            }
-            for (i=0; NULL != req->keys[i]; i++) {
-                /* cycle thru the data keys for matches */
-                for (n=0; n < data->ninfo; n++) {
-                    prte_output_verbose(10, prte_data_server_output,
-                                        "%s\tCHECKING %s TO %s",
-                                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                        data->info[n].key, req->keys[i]);
-                    if (0 == strncmp(data->info[n].key, req->keys[i], PMIX_MAX_KEYLEN)) {
-                        prte_output_verbose(10, prte_data_server_output,
-                                            "%s data server: packaging return",
-                                            PRTE_NAME_PRINT(PRTE_PROC_MY_NAME));
-                        /* track this response */
-                        prte_output_verbose(10, prte_data_server_output,
-                                            "%s data server: adding %s data %s from %s:%d to response",
-                                            PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), data->info[n].key,
-                                            PMIx_Data_type_string(data->info[n].value.type),
-                                            data->owner.nspace, data->owner.rank);
-                        rinfo = PRTE_NEW(prte_ds_info_t);
-                        memcpy(&rinfo->source, &data->owner, sizeof(pmix_proc_t));
-                        rinfo->info = &data->info[n];
-                        prte_list_append(&req->answers, &rinfo->super);
-                        break;  // a key can only occur once
-                    }
-                }
-            }
-            if (0 < (n = prte_list_get_size(&req->answers))) {
-                /* send it back to the requestor */
-                prte_output_verbose(1, prte_data_server_output,
-                                     "%s data server: returning data to %s:%d",
-                                     PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                     req->requestor.nspace, req->requestor.rank);
-
-                PMIX_DATA_BUFFER_CREATE(reply);
-                /* start with their room number */
-                rc = PMIx_Data_pack(NULL, reply, &req->room_number, 1, PMIX_INT);
-                if (PMIX_SUCCESS != rc) {
-                    PMIX_ERROR_LOG(rc);
-                    goto SEND_ERROR;
-                }
-                /* we are responding to a lookup cmd */
-                command = PRTE_PMIX_LOOKUP_CMD;
-                rc = PMIx_Data_pack(NULL, reply, &command, 1, PMIX_UINT8);
-                if (PMIX_SUCCESS != rc) {
-                    PMIX_ERROR_LOG(rc);
-                    goto SEND_ERROR;
-                }
-                /* if we found all of the requested keys, then indicate so */
-                if (n == (size_t)prte_argv_count(req->keys)) {
-                    i = PRTE_SUCCESS;
-                } else {
-                    i = (uint32_t) PRTE_ERR_PARTIAL_SUCCESS;
-                }
-                /* return the status */
-                rc = PMIx_Data_pack(NULL, reply, &i, 1, PMIX_INT);
-                if (PMIX_SUCCESS != rc) {
-                    PMIX_ERROR_LOG(rc);
-                    goto SEND_ERROR;
-                }
-
-                /* pack the rest into a pmix_data_buffer_t */
-                PMIX_DATA_BUFFER_CONSTRUCT(&pbkt);
-
-                /* pack the number of returned info's */
-                if (PMIX_SUCCESS != (ret = PMIx_Data_pack(NULL, &pbkt, &n, 1, PMIX_SIZE))) {
-                    PMIX_ERROR_LOG(ret);
-                    PMIX_DATA_BUFFER_DESTRUCT(&pbkt);
-                    rc = PRTE_ERR_PACK_FAILURE;
-                    goto SEND_ERROR;
-                }
-                /* loop thru and pack the individual responses - this is somewhat less
-                 * efficient than packing an info array, but avoids another malloc
-                 * operation just to assemble all the return values into a contiguous
-                 * array */
-                while (NULL != (rinfo = (prte_ds_info_t*)prte_list_remove_first(&req->answers))) {
-                    /* pack the data owner */
-                    if (PMIX_SUCCESS != (ret = PMIx_Data_pack(NULL, &pbkt, &rinfo->source, 1, PMIX_PROC))) {
-                        PMIX_ERROR_LOG(ret);
-                        PMIX_DATA_BUFFER_DESTRUCT(&pbkt);
-                        rc = PRTE_ERR_PACK_FAILURE;
-                        goto SEND_ERROR;
-                    }
-                    /* pack the data */
-                    if (PMIX_SUCCESS != (ret = PMIx_Data_pack(NULL, &pbkt, rinfo->info, 1, PMIX_INFO))) {
-                        PMIX_ERROR_LOG(ret);
-                        PMIX_DATA_BUFFER_DESTRUCT(&pbkt);
-                        rc = PRTE_ERR_PACK_FAILURE;
-                        goto SEND_ERROR;
-                    }
-                }
-                PRTE_LIST_DESTRUCT(&req->answers);
-                PRTE_CONSTRUCT(&req->answers, prte_list_t);
-
-                /* unload the pmix buffer */
-                rc = PMIx_Data_unload(&pbkt, &pbo);
-
-                /* pack it into our reply */
-                rc = PMIx_Data_pack(NULL, reply, &pbo, 1, PMIX_BYTE_OBJECT);
-                PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
-                if (PMIX_SUCCESS != rc) {
-                    PMIX_ERROR_LOG(rc);
-                    goto SEND_ERROR;
-                }
-                if (0 > (rc = prte_rml.send_buffer_nb(&req->proxy, reply, PRTE_RML_TAG_DATA_CLIENT,
-                                                      prte_rml_send_callback, NULL))) {
-                    PRTE_ERROR_LOG(rc);
-                    PRTE_RELEASE(reply);
+                /* track this response */
+                prte_output_verbose(10, prte_data_server_output,
+                                    "%s data server: adding %s data %s from %s:%d to response",
+                                    PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), data->info[n].key,
+                                    PMIx_Data_type_string(data->info[n].value.type),
+                                    data->owner.nspace, data->owner.rank);
+                if (0 == prte_list_get_size(&req->answers)) {
+                    /* first match for this request - it will be answered
+                     * once we have looked at all the values */
+                    prte_list_remove_item(&pending, &req->super);
+                    prte_list_append(&ready, &req->super);
                 }
+                rinfo = PRTE_NEW(prte_ds_info_t);
+                memcpy(&rinfo->source, &data->owner, sizeof(pmix_proc_t));
+                rinfo->info = &data->info[n];
+                prte_list_append(&req->answers, &rinfo->super);
             }
         }
+        /* send the answers back to the requestors - each request
+         * is satisfied once it receives a response */
+        while (NULL != (req = (prte_data_req_t*)prte_list_remove_first(&ready))) {
+            remove_waiters(req);
+            send_pending(req);
+            PRTE_RELEASE(req);
+        }
+        PRTE_DESTRUCT(&ready);
 
         /* tell the user it was wonderful... */
         rc = PRTE_SUCCESS;
@@ -544,20 +739,13 @@ void prte_data_server(int status, pmix_proc_t* sender,
             prte_output_verbose(10, prte_data_server_output,
                                 "%s data server: looking for %s",
                                 PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), keys[i]);
-            /* cycle across the stored data, looking for a match */
-            for (k=0; k < prte_data_server_store.size; k++) {
-                data = (prte_data_object_t*)prte_pointer_array_get_item(&prte_data_server_store, k);
-                if (NULL == data) {
-                    continue;
-                }
-                /* for security reasons, can only access data posted by the same user id */
-                if (uid != data->uid) {
-                    prte_output_verbose(10, prte_data_server_output,
-                                        "%s\tMISMATCH UID %u %u",
-                                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                        (unsigned)uid, (unsigned)data->uid);
-                    continue;
-                }
+            /* for security reasons, can only access data posted by the
+             * same user id - so only look at the values they posted */
+            if (NULL == (bucket = get_bucket(uid, keys[i], false))) {
+                continue;
+            }
+            PRTE_LIST_FOREACH(posting, &bucket->postings, prte_data_posting_t) {
+                data = posting->data;
                 /* if the published range is constrained to namespace, then only
                  * consider this data if the publisher is
                  * in the same namespace as the requestor */
@@ -570,25 +758,16 @@ void prte_data_server(int status, pmix_proc_t* sender,
                         continue;
                     }
                 }
-                /* see if we have this key */
-                for (n=0; n < data->ninfo; n++) {
-                    prte_output_verbose(10, prte_data_server_output,
-                                        "%s COMPARING %s %s",
-                                        PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
-                                        keys[i], data->info[n].key);
-                    if (PMIX_CHECK_KEY(&data->info[n], keys[i])) {
-                        rinfo = PRTE_NEW(prte_ds_info_t);
-                        memcpy(&rinfo->source, &data->owner, sizeof(pmix_proc_t));
-                        rinfo->info = &data->info[n];
-                        rinfo->persistence = data->persistence;
-                        prte_list_append(&answers, &rinfo->super);
-                        prte_output_verbose(1, prte_data_server_output,
-                                            "%s data server: adding %s to data from %s:%d",
-                                            PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), data->info[n].key,
-                                            PRTE_NAME_PRINT(&data->owner));
-                    }
-                }
-            }  // loop over stored data
+                rinfo = PRTE_NEW(prte_ds_info_t);
+                memcpy(&rinfo->source, &data->owner, sizeof(pmix_proc_t));
+                rinfo->info = posting->info;
+                rinfo->persistence = data->persistence;
+                prte_list_append(&answers, &rinfo->super);
+                prte_output_verbose(1, prte_data_server_output,
+                                    "%s data server: adding %s to data from %s",
+                                    PRTE_NAME_PRINT(PRTE_PROC_MY_NAME), posting->info->key,
+                                    PRTE_NAME_PRINT(&data->owner));
+            }
         }  // loop over keys
 
         if (0 < (nanswers = prte_list_get_size(&answers))) {
@@ -626,6 +805,7 @@ void prte_data_server(int status, pmix_proc_t* sender,
                                         PRTE_NAME_PRINT(PRTE_PROC_MY_NAME),
                                         PRTE_NAME_PRINT(&rinfo->source),
                                         rinfo->info->key);
+                    unindex(uid, rinfo->info);
                     memset(rinfo->info->key, 0, PMIX_MAX_KEYLEN+1);
                 }
             }
@@ -654,6 +834,14 @@ void prte_data_server(int status, pmix_proc_t* sender,
                 req->range = range;
                 req->keys = keys;
                 prte_list_append(&pending, &req->super);
+                /* queue it on each of the keys it is waiting for */
+                for (i=0; NULL != keys[i]; i++) {
+                    bucket = get_bucket(uid, keys[i], true);
+                    waiter = PRTE_NEW(prte_data_waiter_t);
+                    PRTE_RETAIN(req);
+                    waiter->req = req;
+                    prte_list_append(&bucket->waiters, &waiter->super);
+                }
                 /* drop the partial response we have - we'll build it when everything
                  * becomes available */
                 PMIX_DATA_BUFFER_DESTRUCT(&pbkt);
@@ -766,16 +954,12 @@ void prte_data_server(int status, pmix_proc_t* sender,
 
         /* cycle across the provided keys */
         for (i=0; NULL != keys[i]; i++) {
-            /* cycle across the stored data, looking for a match */
-            for (k=0; k < prte_data_server_store.size; k++) {
-                data = (prte_data_object_t*)prte_pointer_array_get_item(&prte_data_server_store, k);
-                if (NULL == data) {
-                    continue;
-                }
-                /* can only access data posted by the same user id */
-                if (uid != data->uid) {
-                    continue;
-                }
+            /* can only access data posted by the same user id */
+            if (NULL == (bucket = get_bucket(uid, keys[i], false))) {
+                continue;
+            }
+            PRTE_LIST_FOREACH_SAFE(posting, pnext, &bucket->postings, prte_data_posting_t) {
+                data = posting->data;
                 /* can only access data posted by the same process */
                 if (0 != strncmp(requestor.nspace, data->owner.nspace, PMIX_MAX_NSLEN) ||
                     requestor.rank != data->owner.rank) {
@@ -785,25 +969,40 @@ void prte_data_server(int status, pmix_proc_t* sender,
                 if (range != data->range) {
                     continue;
                 }
-                /* see if we have this key */
-                nanswers = 0;
-                for (n=0; n < data->ninfo; n++) {
-                    if (0 == strlen(data->info[n].key)) {
-                        ++nanswers;
+                /* found it -  delete the value from the data store, along
+                 * with any duplicates of the key posted in the same object
+                 * so that no posting left in the bucket refers to the
+                 * object once it has been released */
+                pnext = NULL;
+                for (dup = posting; dup != (prte_data_posting_t*)prte_list_get_end(&bucket->postings); dup = dnext) {
+                    dnext = (prte_data_posting_t*)prte_list_get_next(&dup->super);
+                    if (dup->data != data) {
+                        if (NULL == pnext) {
+                            pnext = dup;
+                        }
                         continue;
                     }
-                    if (0 == strncmp(data->info[n].key, keys[i], PMIX_MAX_KEYLEN)) {
-                        /* found it -  delete the object from the data store */
-                        memset(data->info[n].key, 0, PMIX_MAX_KEYLEN+1);
-                        ++nanswers;
-                    }
+                    memset(dup->info->key, 0, PMIX_MAX_KEYLEN+1);
+                    prte_list_remove_item(&bucket->postings, &dup->super);
+                    PRTE_RELEASE(dup);
+                }
+                if (NULL == pnext) {
+                    pnext = (prte_data_posting_t*)prte_list_get_end(&bucket->postings);
                 }
                 /* if all the data has been removed, then remove the object */
-                if (nanswers == data->ninfo) {
-                    prte_pointer_array_set_item(&prte_data_server_store, k, NULL);
+                for (n=0; n < data->ninfo; n++) {
+                    if (0 < strlen(data->info[n].key)) {
+                        break;
+                    }
+                }
+                if (n == data->ninfo) {
+                    prte_pointer_array_set_item(&prte_data_server_store, data->index, NULL);
                     PRTE_RELEASE(data);
+                    /* done with this object - move on */
+                    continue;
                 }
             }
+            prune_bucket(uid, keys[i], bucket);
         }
         prte_argv_free(keys);
 
@@ -850,8 +1049,7 @@ void prte_data_server(int status, pmix_proc_t* sender,
                 continue;
             }
             /* remove the object */
-            prte_pointer_array_set_item(&prte_data_server_store, k, NULL);
-            PRTE_RELEASE(data);
+            release_data(data);
         }
         /* no response is required */
         PRTE_RELEASE(answer);
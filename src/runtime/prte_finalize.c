@@ -42,6 +42,7 @@
 #include "src/runtime/runtime.h"
 #include "src/util/listener.h"
 #include "src/util/name_fns.h"
+#include "src/util/nidmap.h"
 #include "src/util/proc_info.h"
 #include "src/util/show_help.h"
 
@@ -98,6 +99,7 @@ int prte_finalize(void)
         PRTE_RELEASE(jdata);
     }
     PRTE_RELEASE(prte_job_data);
+    PRTE_RELEASE(prte_job_index);
 
 {
     prte_pointer_array_t * array = prte_node_topologies;
@@ -118,6 +120,8 @@ int prte_finalize(void)
     }
 }
     PRTE_RELEASE(prte_node_topologies);
+    PRTE_RELEASE(prte_topology_index);
+    prte_util_nidmap_finalize();
 
 {
     prte_pointer_array_t * array = prte_node_pool;
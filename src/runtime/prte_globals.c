@@ -29,6 +29,7 @@
 #include "constants.h"
 #include "types.h"
 
+#include <string.h>
 #ifdef HAVE_SYS_TIME_H
 #include <sys/time.h>
 #endif
@@ -119,8 +120,10 @@ int prte_stack_trace_wait_timeout = 30;
 
 /* global arrays for data storage */
 prte_pointer_array_t *prte_job_data = NULL;
+prte_hash_table_t *prte_job_index = NULL;
 prte_pointer_array_t *prte_node_pool = NULL;
 prte_pointer_array_t *prte_node_topologies = NULL;
+prte_hash_table_t *prte_topology_index = NULL;
 prte_pointer_array_t *prte_local_children = NULL;
 pmix_rank_t prte_total_procs = 0;
 char *prte_base_compute_node_sig = NULL;
@@ -208,12 +211,24 @@ int prte_dt_init(void)
 prte_job_t* prte_get_job_data_object(const pmix_nspace_t job)
 {
     prte_job_t *jptr;
+    void *ptr;
     int i;
 
     /* if the job data wasn't setup, we cannot provide the data */
     if (NULL == prte_job_data) {
         return NULL;
     }
+    /* a valid nspace can be looked up directly in the index - an
+     * invalid one matches anything, so we have to preserve the
+     * historical behavior of returning the first job we find */
+    if (NULL != prte_job_index && !PMIX_NSPACE_INVALID(job)) {
+        ptr = NULL;
+        if (PRTE_SUCCESS != prte_hash_table_get_value_ptr(prte_job_index, job,
+                                                          strnlen(job, PMIX_MAX_NSLEN), &ptr)) {
+            return NULL;
+        }
+        return (prte_job_t*)ptr;
+    }
     for (i=0; i < prte_job_data->size; i++) {
         if (NULL == (jptr = (prte_job_t*)prte_pointer_array_get_item(prte_job_data, i))) {
             continue;
@@ -227,37 +242,107 @@ prte_job_t* prte_get_job_data_object(const pmix_nspace_t job)
 
 int prte_set_job_data_object(prte_job_t *jdata)
 {
-    prte_job_t *jptr;
-    int i, save = -1;
+    int rc;
 
     /* if the job data wasn't setup, we cannot set the data */
-    if (NULL == prte_job_data) {
+    if (NULL == prte_job_data || NULL == prte_job_index) {
         return PRTE_ERROR;
     }
 
     /* verify that we don't already have this object */
-    for (i=0; i < prte_job_data->size; i++) {
-        if (NULL == (jptr = (prte_job_t*)prte_pointer_array_get_item(prte_job_data, i))) {
-            if (0 > save) {
-                save = i;
-            }
+    if (NULL != prte_get_job_data_object(jdata->nspace)) {
+        return PRTE_EXISTS;
+    }
+
+    /* the pointer array reuses the lowest free slot for us */
+    jdata->index = prte_pointer_array_add(prte_job_data, jdata);
+    if (0 > jdata->index) {
+        return PRTE_ERROR;
+    }
+    if (PMIX_NSPACE_INVALID(jdata->nspace)) {
+        return PRTE_SUCCESS;
+    }
+    rc = prte_hash_table_set_value_ptr(prte_job_index, jdata->nspace,
+                                       strnlen(jdata->nspace, PMIX_MAX_NSLEN), jdata);
+    if (PRTE_SUCCESS != rc) {
+        prte_pointer_array_set_item(prte_job_data, jdata->index, NULL);
+        jdata->index = -1;
+        return rc;
+    }
+    return PRTE_SUCCESS;
+}
+
+void prte_remove_job_data_object(prte_job_t *jdata)
+{
+    void *ptr;
+    size_t len;
+
+    if (NULL != prte_job_data && 0 <= jdata->index &&
+        jdata == prte_pointer_array_get_item(prte_job_data, jdata->index)) {
+        prte_pointer_array_set_item(prte_job_data, jdata->index, NULL);
+    }
+    /* only remove the index entry if it refers to this object - a
+     * copy of a job may carry the same nspace without having
+     * been registered */
+    if (NULL != prte_job_index && !PMIX_NSPACE_INVALID(jdata->nspace)) {
+        len = strnlen(jdata->nspace, PMIX_MAX_NSLEN);
+        ptr = NULL;
+        if (PRTE_SUCCESS == prte_hash_table_get_value_ptr(prte_job_index, jdata->nspace, len, &ptr) &&
+            ptr == (void*)jdata) {
+            prte_hash_table_remove_value_ptr(prte_job_index, jdata->nspace, len);
+        }
+    }
+}
+
+prte_topology_t* prte_get_topology(const char *sig)
+{
+    prte_topology_t *t;
+    void *ptr;
+    int i;
+
+    if (NULL == prte_node_topologies || NULL == sig) {
+        return NULL;
+    }
+    if (NULL != prte_topology_index) {
+        ptr = NULL;
+        if (PRTE_SUCCESS != prte_hash_table_get_value_ptr(prte_topology_index, sig,
+                                                          strlen(sig), &ptr)) {
+            return NULL;
+        }
+        return (prte_topology_t*)ptr;
+    }
+    for (i=0; i < prte_node_topologies->size; i++) {
+        if (NULL == (t = (prte_topology_t*)prte_pointer_array_get_item(prte_node_topologies, i))) {
             continue;
         }
-        if (PMIX_CHECK_NSPACE(jptr->nspace, jdata->nspace)) {
-            return PRTE_EXISTS;
+        if (NULL != t->sig && 0 == strcmp(sig, t->sig)) {
+            return t;
         }
     }
+    return NULL;
+}
 
-    if (-1 == save) {
-        jdata->index = prte_pointer_array_add(prte_job_data, jdata);
-    } else {
-        jdata->index = save;
-        prte_pointer_array_set_item(prte_job_data, save, jdata);
+int prte_add_topology(prte_topology_t *t)
+{
+    int rc;
+
+    if (NULL == prte_node_topologies) {
+        return PRTE_ERROR;
     }
-    if (0 > jdata->index) {
+    t->index = prte_pointer_array_add(prte_node_topologies, t);
+    if (0 > t->index) {
         return PRTE_ERROR;
     }
-    return PRTE_SUCCESS;
+    if (NULL == prte_topology_index || NULL == t->sig ||
+        NULL != prte_get_topology(t->sig)) {
+        return PRTE_SUCCESS;
+    }
+    rc = prte_hash_table_set_value_ptr(prte_topology_index, t->sig, strlen(t->sig), t);
+    if (PRTE_SUCCESS != rc) {
+        prte_pointer_array_set_item(prte_node_topologies, t->index, NULL);
+        t->index = -1;
+    }
+    return rc;
 }
 
 prte_proc_t* prte_get_proc_object(const pmix_proc_t *proc)
@@ -421,7 +506,8 @@ static void prte_app_context_construct(prte_app_context_t* app_context)
     app_context->env=NULL;
     app_context->cwd=NULL;
     app_context->flags = 0;
-    PRTE_CONSTRUCT(&app_context->attributes, prte_list_t);
+    PRTE_CONSTRUCT(&app_context->attributes, prte_attr_list_t);
+    prte_attr_list_init(&app_context->attributes, PRTE_ATTR_KEY_BASE, PRTE_APP_MAX_KEY);
 }
 
 static void prte_app_context_destructor(prte_app_context_t* app_context)
@@ -457,7 +543,7 @@ static void prte_app_context_destructor(prte_app_context_t* app_context)
         app_context->cwd = NULL;
     }
 
-    PRTE_LIST_DESTRUCT(&app_context->attributes);
+    PRTE_DESTRUCT(&app_context->attributes);
 }
 
 PRTE_CLASS_INSTANCE(prte_app_context_t,
@@ -504,7 +590,8 @@ static void prte_job_construct(prte_job_t* job)
     job->flags = 0;
     PRTE_FLAG_SET(job, PRTE_JOB_FLAG_FORWARD_OUTPUT);
 
-    PRTE_CONSTRUCT(&job->attributes, prte_list_t);
+    PRTE_CONSTRUCT(&job->attributes, prte_attr_list_t);
+    prte_attr_list_init(&job->attributes, PRTE_JOB_START_KEY, PRTE_JOB_MAX_KEY);
     PMIX_DATA_BUFFER_CONSTRUCT(&job->launch_msg);
     PRTE_CONSTRUCT(&job->children, prte_list_t);
     PMIX_LOAD_NSPACE(job->launcher, NULL);
@@ -569,7 +656,7 @@ static void prte_job_destruct(prte_job_t* job)
     PRTE_RELEASE(job->procs);
 
     /* release the attributes */
-    PRTE_LIST_DESTRUCT(&job->attributes);
+    PRTE_DESTRUCT(&job->attributes);
 
     PMIX_DATA_BUFFER_DESTRUCT(&job->launch_msg);
 
@@ -580,10 +667,8 @@ static void prte_job_destruct(prte_job_t* job)
 
     PRTE_LIST_DESTRUCT(&job->children);
 
-    if (NULL != prte_job_data && 0 <= job->index) {
-        /* remove the job from the global array */
-        prte_pointer_array_set_item(prte_job_data, job->index, NULL);
-    }
+    /* remove the job from the global array and index */
+    prte_remove_job_data_object(job);
 }
 
 PRTE_CLASS_INSTANCE(prte_job_t,
@@ -614,7 +699,8 @@ static void prte_node_construct(prte_node_t* node)
     node->topology = NULL;
 
     node->flags = 0;
-    PRTE_CONSTRUCT(&node->attributes, prte_list_t);
+    PRTE_CONSTRUCT(&node->attributes, prte_attr_list_t);
+    prte_attr_list_init(&node->attributes, PRTE_NODE_START_KEY, PRTE_NODE_MAX_KEY);
 }
 
 static void prte_node_destruct(prte_node_t* node)
@@ -644,7 +730,7 @@ static void prte_node_destruct(prte_node_t* node)
     /* do NOT destroy the topology */
 
     /* release the attributes */
-    PRTE_LIST_DESTRUCT(&node->attributes);
+    PRTE_DESTRUCT(&node->attributes);
 }
 
 
@@ -673,7 +759,8 @@ static void prte_proc_construct(prte_proc_t* proc)
     proc->exit_code = 0;      /* Assume we won't fail unless otherwise notified */
     proc->rml_uri = NULL;
     proc->flags = 0;
-    PRTE_CONSTRUCT(&proc->attributes, prte_list_t);
+    PRTE_CONSTRUCT(&proc->attributes, prte_attr_list_t);
+    prte_attr_list_init(&proc->attributes, PRTE_PROC_START_KEY, PRTE_PROC_MAX_KEY);
 }
 
 static void prte_proc_destruct(prte_proc_t* proc)
@@ -688,7 +775,7 @@ static void prte_proc_destruct(prte_proc_t* proc)
         proc->rml_uri = NULL;
     }
 
-    PRTE_LIST_DESTRUCT(&proc->attributes);
+    PRTE_DESTRUCT(&proc->attributes);
 }
 
 PRTE_CLASS_INSTANCE(prte_proc_t,
@@ -754,6 +841,7 @@ PRTE_CLASS_INSTANCE(prte_attribute_t,
 
 static void tcon(prte_topology_t *t)
 {
+    t->index = -1;
     t->topo = NULL;
     t->sig = NULL;
 }
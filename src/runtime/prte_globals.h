@@ -250,7 +250,7 @@ typedef struct {
      * flexibility without constantly expanding the memory footprint
      * every time we want some new (rarely used) option
      */
-    prte_list_t attributes;
+    prte_attr_list_t attributes;
 } prte_app_context_t;
 
 PRTE_EXPORT PRTE_CLASS_DECLARATION(prte_app_context_t);
@@ -301,7 +301,7 @@ typedef struct {
     /* flags */
     prte_node_flags_t flags;
     /* list of prte_attribute_t */
-    prte_list_t attributes;
+    prte_attr_list_t attributes;
 } prte_node_t;
 PRTE_EXPORT PRTE_CLASS_DECLARATION(prte_node_t);
 
@@ -362,7 +362,7 @@ typedef struct {
     /* flags */
     prte_job_flags_t flags;
     /* attributes */
-    prte_list_t attributes;
+    prte_attr_list_t attributes;
     /* launch msg buffer */
     pmix_data_buffer_t launch_msg;
     /* track children of this job */
@@ -420,8 +420,8 @@ struct prte_proc_t {
     char *rml_uri;
     /* some boolean flags */
     prte_proc_flags_t flags;
-    /* list of prte_value_t attributes */
-    prte_list_t attributes;
+    /* list of prte_attribute_t */
+    prte_attr_list_t attributes;
 };
 typedef struct prte_proc_t prte_proc_t;
 PRTE_EXPORT PRTE_CLASS_DECLARATION(prte_proc_t);
@@ -442,6 +442,25 @@ PRTE_EXPORT prte_job_t* prte_get_job_data_object(const pmix_nspace_t job);
  */
 PRTE_EXPORT int prte_set_job_data_object(prte_job_t *jdata);
 
+/**
+ * Remove a job data object from the global array and the
+ * nspace index. The object itself is not released.
+ */
+PRTE_EXPORT void prte_remove_job_data_object(prte_job_t *jdata);
+
+/**
+ * Get the topology object with the given signature, or NULL
+ * if no such topology has been recorded
+ */
+PRTE_EXPORT prte_topology_t* prte_get_topology(const char *sig);
+
+/**
+ * Add a topology object to the global array and the signature
+ * index. If a topology with the same signature was already
+ * recorded, the index continues to refer to that one.
+ */
+PRTE_EXPORT int prte_add_topology(prte_topology_t *t);
+
 /** Pack/unpack a job object */
 PRTE_EXPORT int prte_job_pack(pmix_data_buffer_t *bkt,
                               prte_job_t *job);
@@ -574,8 +593,12 @@ PRTE_EXPORT extern prte_timer_t *prte_mpiexec_timeout;
 
 /* global arrays for data storage */
 PRTE_EXPORT extern prte_pointer_array_t *prte_job_data;
+/* index of prte_job_data by nspace */
+PRTE_EXPORT extern prte_hash_table_t *prte_job_index;
 PRTE_EXPORT extern prte_pointer_array_t *prte_node_pool;
 PRTE_EXPORT extern prte_pointer_array_t *prte_node_topologies;
+/* index of prte_node_topologies by signature */
+PRTE_EXPORT extern prte_hash_table_t *prte_topology_index;
 PRTE_EXPORT extern prte_pointer_array_t *prte_local_children;
 PRTE_EXPORT extern pmix_rank_t prte_total_procs;
 PRTE_EXPORT extern char *prte_base_compute_node_sig;
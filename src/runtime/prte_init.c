@@ -291,6 +291,12 @@ int prte_init(int* pargc, char*** pargv, prte_proc_type_t flags)
         error = "setup job array";
         goto error;
     }
+    prte_job_index = PRTE_NEW(prte_hash_table_t);
+    if (PRTE_SUCCESS != (ret = prte_hash_table_init(prte_job_index, 128))) {
+        PRTE_ERROR_LOG(ret);
+        error = "setup job index";
+        goto error;
+    }
     prte_node_pool = PRTE_NEW(prte_pointer_array_t);
     if (PRTE_SUCCESS != (ret = prte_pointer_array_init(prte_node_pool,
                                PRTE_GLOBAL_ARRAY_BLOCK_SIZE,
@@ -309,6 +315,12 @@ int prte_init(int* pargc, char*** pargv, prte_proc_type_t flags)
         error = "setup node topologies array";
         goto error;
     }
+    prte_topology_index = PRTE_NEW(prte_hash_table_t);
+    if (PRTE_SUCCESS != (ret = prte_hash_table_init(prte_topology_index, 32))) {
+        PRTE_ERROR_LOG(ret);
+        error = "setup node topology index";
+        goto error;
+    }
 
     /* open the SCHIZO framework as everyone needs it, and the
      * ess will use it to help select its component */
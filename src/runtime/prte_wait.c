@@ -49,10 +49,14 @@
 #ifdef HAVE_SYS_WAIT_H
 #include <sys/wait.h>
 #endif
+#ifdef HAVE_SYS_SYSCALL_H
+#include <sys/syscall.h>
+#endif
 
 #include "src/class/prte_object.h"
 #include "src/util/output.h"
 #include "src/class/prte_list.h"
+#include "src/class/prte_hash_table.h"
 #include "src/event/event-internal.h"
 #include "src/threads/mutex.h"
 #include "src/sys/atomic.h"
@@ -81,17 +85,30 @@ PRTE_CLASS_INSTANCE(prte_timer_t,
                    timer_dest);
 
 
+/* pidfds let us watch each child individually from the event
+ * base instead of reaping everything on SIGCHLD */
+#if defined(HAVE_SYS_SYSCALL_H) && defined(SYS_pidfd_open)
+#define PRTE_WAIT_HAVE_PIDFD 1
+#else
+#define PRTE_WAIT_HAVE_PIDFD 0
+#endif
+
 static void wccon(prte_wait_tracker_t *p)
 {
     p->child = NULL;
     p->cbfunc = NULL;
     p->cbdata = NULL;
+    p->pidfd = -1;
+    p->unstarted = false;
 }
 static void wcdes(prte_wait_tracker_t *p)
 {
     if (NULL != p->child) {
         PRTE_RELEASE(p->child);
     }
+    if (0 <= p->pidfd) {
+        close(p->pidfd);
+    }
 }
 PRTE_CLASS_INSTANCE(prte_wait_tracker_t,
                    prte_list_item_t,
@@ -99,10 +116,18 @@ PRTE_CLASS_INSTANCE(prte_wait_tracker_t,
 
 /* Local Variables */
 static prte_event_t handler;
-static prte_list_t pending_cbs;
+/* pending trackers, indexed by pid */
+static prte_hash_table_t pending_cbs;
+/* trackers for children that have yet to be given a pid */
+static prte_list_t unstarted;
+#if PRTE_WAIT_HAVE_PIDFD
+static bool use_pidfd = true;
+#endif
 
 /* Local Function Prototypes */
 static void wait_signal_callback(int fd, short event, void *arg);
+static void untrack(prte_wait_tracker_t *t2);
+static void reap_children(void);
 
 /* Interface Functions */
 
@@ -118,7 +143,9 @@ void prte_wait_enable(void)
 
 int prte_wait_init(void)
 {
-    PRTE_CONSTRUCT(&pending_cbs, prte_list_t);
+    PRTE_CONSTRUCT(&pending_cbs, prte_hash_table_t);
+    prte_hash_table_init(&pending_cbs, 1024);
+    PRTE_CONSTRUCT(&unstarted, prte_list_t);
 
     prte_event_set(prte_event_base,
                    &handler, SIGCHLD, PRTE_EV_SIGNAL|PRTE_EV_PERSIST,
@@ -133,14 +160,174 @@ int prte_wait_init(void)
 
 int prte_wait_finalize(void)
 {
+    prte_wait_tracker_t *t2;
+    uint32_t key;
+    void *node;
+
     prte_event_del(&handler);
 
     /* clear out the pending cbs */
-    PRTE_LIST_DESTRUCT(&pending_cbs);
+    while (PRTE_SUCCESS == prte_hash_table_get_first_key_uint32(&pending_cbs, &key,
+                                                                (void**)&t2, &node)) {
+        untrack(t2);
+        PRTE_RELEASE(t2);
+    }
+    PRTE_DESTRUCT(&pending_cbs);
+    while (NULL != (t2 = (prte_wait_tracker_t*)prte_list_remove_first(&unstarted))) {
+        PRTE_RELEASE(t2);
+    }
+    PRTE_DESTRUCT(&unstarted);
 
     return PRTE_SUCCESS;
 }
 
+/* stop watching a child - must be called from
+ * within an event in the prte_event_base */
+static void untrack(prte_wait_tracker_t *t2)
+{
+    if (t2->unstarted) {
+        prte_list_remove_item(&unstarted, &t2->super);
+        t2->unstarted = false;
+    } else {
+        prte_hash_table_remove_value_uint32(&pending_cbs, (uint32_t)t2->child->pid);
+    }
+    if (0 <= t2->pidfd) {
+        prte_event_del(&t2->pidev);
+        close(t2->pidfd);
+        t2->pidfd = -1;
+    }
+}
+
+/* the child was reaped - pass it along to the callback */
+static void complete(prte_wait_tracker_t *t2, int status)
+{
+    t2->child->exit_code = status;
+    untrack(t2);
+    if (NULL != t2->cbfunc) {
+        prte_event_set(t2->evb, &t2->ev, -1,
+                       PRTE_EV_WRITE, t2->cbfunc, t2);
+        prte_event_set_priority(&t2->ev, PRTE_MSG_PRI);
+        prte_event_active(&t2->ev, PRTE_EV_WRITE, 1);
+    } else {
+        PRTE_RELEASE(t2);
+    }
+}
+
+#if PRTE_WAIT_HAVE_PIDFD
+#ifndef P_PIDFD
+#define P_PIDFD 3
+#endif
+
+/* convert the siginfo from waitid into the status waitpid
+ * would have given us */
+static int siginfo_to_status(siginfo_t *info)
+{
+    switch (info->si_code) {
+    case CLD_EXITED:
+        return (info->si_status & 0xff) << 8;
+    case CLD_DUMPED:
+        return (info->si_status & 0x7f) | 0x80;
+    default:
+        return info->si_status & 0x7f;
+    }
+}
+
+/* callback from the event library when a child's pidfd
+ * becomes readable - i.e., the child has terminated */
+static void pidfd_callback(int fd, short event, void *arg)
+{
+    prte_wait_tracker_t *t2 = (prte_wait_tracker_t*)arg;
+    siginfo_t info;
+    int rc;
+
+    PRTE_ACQUIRE_OBJECT(t2);
+
+    /* reap through the pidfd so we cannot pick up some other
+     * process that was later given the same pid */
+    memset(&info, 0, sizeof(info));
+    do {
+        rc = waitid((idtype_t)P_PIDFD, (id_t)t2->pidfd, &info, WEXITED | WNOHANG);
+    } while (-1 == rc && EINTR == errno);
+
+    if (0 == rc && 0 != info.si_pid) {
+        complete(t2, siginfo_to_status(&info));
+    } else if (0 > rc) {
+        if (EINVAL == errno) {
+            /* the kernel can't wait on a pidfd - the child
+             * will be reaped below and we rely on SIGCHLD
+             * from here on */
+            use_pidfd = false;
+        }
+        /* otherwise someone else reaped it - either way there
+         * is nothing more we can learn from the pidfd */
+        prte_event_del(&t2->pidev);
+        close(t2->pidfd);
+        t2->pidfd = -1;
+    }
+
+    /* any children that exited behind this one were left
+     * for us by the SIGCHLD handler */
+    reap_children();
+}
+#endif
+
+static prte_wait_tracker_t *find_unstarted(prte_proc_t *child)
+{
+    prte_wait_tracker_t *t2;
+
+    PRTE_LIST_FOREACH(t2, &unstarted, prte_wait_tracker_t) {
+        if (child == t2->child) {
+            return t2;
+        }
+    }
+    return NULL;
+}
+
+/* find the tracker for a reaped pid - a child we have yet to be
+ * told about may already have been given it */
+static prte_wait_tracker_t *lookup(pid_t pid)
+{
+    prte_wait_tracker_t *t2;
+
+    if (PRTE_SUCCESS == prte_hash_table_get_value_uint32(&pending_cbs, (uint32_t)pid,
+                                                         (void**)&t2)) {
+        return t2;
+    }
+    PRTE_LIST_FOREACH(t2, &unstarted, prte_wait_tracker_t) {
+        if (pid == t2->child->pid) {
+            return t2;
+        }
+    }
+    return NULL;
+}
+
+/* start watching a child whose pid is known. The child cannot have
+ * been reaped yet as we only reap tracked children once we find
+ * their tracker, so the pidfd is guaranteed to refer to it */
+static void watch(prte_wait_tracker_t *t2)
+{
+    prte_hash_table_set_value_uint32(&pending_cbs, (uint32_t)t2->child->pid, t2);
+
+#if PRTE_WAIT_HAVE_PIDFD
+    if (!use_pidfd) {
+        return;
+    }
+    t2->pidfd = syscall(SYS_pidfd_open, t2->child->pid, 0);
+    if (0 > t2->pidfd) {
+        if (ENOSYS == errno) {
+            /* the kernel doesn't support it - rely on SIGCHLD */
+            use_pidfd = false;
+        }
+        t2->pidfd = -1;
+        return;
+    }
+    prte_event_set(prte_event_base, &t2->pidev, t2->pidfd,
+                   PRTE_EV_READ|PRTE_EV_PERSIST, pidfd_callback, t2);
+    prte_event_set_priority(&t2->pidev, PRTE_SYS_PRI);
+    prte_event_add(&t2->pidev, NULL);
+#endif
+}
+
 /* this function *must* always be called from
  * within an event in the prte_event_base */
 void prte_wait_cb(prte_proc_t *child, prte_wait_cbfunc_t callback,
@@ -172,13 +359,23 @@ void prte_wait_cb(prte_proc_t *child, prte_wait_cbfunc_t callback,
         return;
     }
 
-   /* we just override any existing registration */
-    PRTE_LIST_FOREACH(t2, &pending_cbs, prte_wait_tracker_t) {
+    /* we just override any existing registration */
+    if (NULL != (t2 = find_unstarted(child))) {
+        t2->cbfunc = callback;
+        t2->cbdata = data;
+        return;
+    }
+    if (0 != child->pid &&
+        PRTE_SUCCESS == prte_hash_table_get_value_uint32(&pending_cbs, (uint32_t)child->pid,
+                                                         (void**)&t2)) {
         if (t2->child == child) {
             t2->cbfunc = callback;
             t2->cbdata = data;
             return;
         }
+        /* stale entry for a prior holder of this pid */
+        untrack(t2);
+        PRTE_RELEASE(t2);
     }
     /* get here if this is a new registration */
     t2 = PRTE_NEW(prte_wait_tracker_t);
@@ -187,7 +384,48 @@ void prte_wait_cb(prte_proc_t *child, prte_wait_cbfunc_t callback,
     t2->evb = evb;
     t2->cbfunc = callback;
     t2->cbdata = data;
-    prte_list_append(&pending_cbs, &t2->super);
+    if (0 == child->pid) {
+        /* not started yet - we will be told its pid */
+        t2->unstarted = true;
+        prte_list_append(&unstarted, &t2->super);
+        return;
+    }
+    watch(t2);
+}
+
+static void started_callback(int fd, short args, void *cbdata)
+{
+    prte_wait_tracker_t *trk = (prte_wait_tracker_t*)cbdata;
+    prte_wait_tracker_t *t2;
+
+    PRTE_ACQUIRE_OBJECT(trk);
+
+    /* if the child already exited, it was found and reaped
+     * through the unstarted list and is no longer on it */
+    if (NULL != (t2 = find_unstarted(trk->child))) {
+        prte_list_remove_item(&unstarted, &t2->super);
+        t2->unstarted = false;
+        watch(t2);
+    }
+
+    PRTE_RELEASE(trk);
+}
+
+void prte_wait_cb_started(prte_proc_t *child)
+{
+    prte_wait_tracker_t *trk;
+
+    if (NULL == child) {
+        /* bozo protection */
+        PRTE_ERROR_LOG(PRTE_ERR_BAD_PARAM);
+        return;
+    }
+
+    /* push this into the event library for handling */
+    trk = PRTE_NEW(prte_wait_tracker_t);
+    PRTE_RETAIN(child);  // protect against race conditions
+    trk->child = child;
+    PRTE_THREADSHIFT(trk, prte_event_base, started_callback, PRTE_SYS_PRI);
 }
 
 static void cancel_callback(int fd, short args, void *cbdata)
@@ -197,13 +435,12 @@ static void cancel_callback(int fd, short args, void *cbdata)
 
     PRTE_ACQUIRE_OBJECT(trk);
 
-    PRTE_LIST_FOREACH(t2, &pending_cbs, prte_wait_tracker_t) {
-        if (t2->child == trk->child) {
-            prte_list_remove_item(&pending_cbs, &t2->super);
-            PRTE_RELEASE(t2);
-            PRTE_RELEASE(trk);
-            return;
-        }
+    if (NULL != (t2 = find_unstarted(trk->child)) ||
+        (PRTE_SUCCESS == prte_hash_table_get_value_uint32(&pending_cbs, (uint32_t)trk->child->pid,
+                                                          (void**)&t2) &&
+         t2->child == trk->child)) {
+        untrack(t2);
+        PRTE_RELEASE(t2);
     }
 
     PRTE_RELEASE(trk);
@@ -227,24 +464,43 @@ void prte_wait_cb_cancel(prte_proc_t *child)
 }
 
 
-/* callback from the event library whenever a SIGCHLD is received */
-static void wait_signal_callback(int fd, short event, void *arg)
+/* reap every child that has exited, except those being watched
+ * through a pidfd - those are reaped by their own event so that
+ * we never wait on a pid that might have been reused. Must be
+ * called from within an event in the prte_event_base */
+static void reap_children(void)
 {
-    prte_event_t *signal = (prte_event_t*) arg;
     int status;
     pid_t pid;
     prte_wait_tracker_t *t2;
-
-    PRTE_ACQUIRE_OBJECT(signal);
-
-    if (SIGCHLD != PRTE_EVENT_SIGNAL(signal)) {
-        return;
-    }
+#if PRTE_WAIT_HAVE_PIDFD
+    siginfo_t info;
+    int rc;
+#endif
 
     /* we can have multiple children leave but only get one
      * sigchild callback, so reap all the waitpids until we
      * don't get anything valid back */
     while (1) {
+#if PRTE_WAIT_HAVE_PIDFD
+        if (use_pidfd) {
+            /* see who is next without reaping it */
+            memset(&info, 0, sizeof(info));
+            rc = waitid(P_ALL, 0, &info, WEXITED | WNOHANG | WNOWAIT);
+            if (-1 == rc && EINTR == errno) {
+                continue;
+            }
+            if (0 != rc || 0 >= info.si_pid) {
+                return;
+            }
+            if (NULL != (t2 = lookup(info.si_pid)) && 0 <= t2->pidfd) {
+                /* its pidfd event will reap it, and then come
+                 * back here for anyone behind it */
+                return;
+            }
+            pid = waitpid(info.si_pid, &status, WNOHANG);
+        } else
+#endif
         pid = waitpid(-1, &status, WNOHANG);
         if (-1 == pid && EINTR == errno) {
             /* try it again */
@@ -255,22 +511,23 @@ static void wait_signal_callback(int fd, short event, void *arg)
             return;
         }
 
-        /* we are already in an event, so it is safe to access the list */
-        PRTE_LIST_FOREACH(t2, &pending_cbs, prte_wait_tracker_t) {
-            if (pid == t2->child->pid) {
-                /* found it! */
-                t2->child->exit_code = status;
-                prte_list_remove_item(&pending_cbs, &t2->super);
-                if (NULL != t2->cbfunc) {
-                    prte_event_set(t2->evb, &t2->ev, -1,
-                                   PRTE_EV_WRITE, t2->cbfunc, t2);
-                    prte_event_set_priority(&t2->ev, PRTE_MSG_PRI);
-                    prte_event_active(&t2->ev, PRTE_EV_WRITE, 1);
-                } else {
-                    PRTE_RELEASE(t2);
-                }
-                break;
-            }
+        /* we are already in an event, so it is safe to access the table */
+        if (NULL != (t2 = lookup(pid))) {
+            complete(t2, status);
         }
     }
 }
+
+/* callback from the event library whenever a SIGCHLD is received */
+static void wait_signal_callback(int fd, short event, void *arg)
+{
+    prte_event_t *signal = (prte_event_t*) arg;
+
+    PRTE_ACQUIRE_OBJECT(signal);
+
+    if (SIGCHLD != PRTE_EVENT_SIGNAL(signal)) {
+        return;
+    }
+
+    reap_children();
+}
@@ -66,6 +66,11 @@ typedef struct {
     prte_proc_t *child;
     prte_wait_cbfunc_t cbfunc;
     void *cbdata;
+    /* pidfd of the child, if it is being watched that way */
+    int pidfd;
+    prte_event_t pidev;
+    /* registered before the child was started */
+    bool unstarted;
 } prte_wait_tracker_t;
 PRTE_EXPORT PRTE_CLASS_DECLARATION(prte_wait_tracker_t);
 
@@ -90,6 +95,12 @@ PRTE_EXPORT void prte_wait_cb(prte_proc_t *proc, prte_wait_cbfunc_t callback,
 
 PRTE_EXPORT void prte_wait_cb_cancel(prte_proc_t *proc);
 
+/**
+ * Tell the wait system that a proc registered with \c prte_wait_cb
+ * before it was started now has a pid. Safe to call from any thread.
+ */
+PRTE_EXPORT void prte_wait_cb_started(prte_proc_t *proc);
+
 
 /* In a few places, we need to barrier until something happens
  * that changes a flag to indicate we can release - e.g., waiting
@@ -38,81 +38,161 @@ typedef struct {
 /* all default to NULL */
 static prte_attr_converter_t converters[MAX_CONVERTERS];
 
-bool prte_get_attribute(prte_list_t *attributes,
+/* return the index slot for the given key, or NULL if
+ * the key isn't covered by an allocated index */
+static inline prte_attribute_t** attr_slot(prte_attr_list_t *attributes,
+                                           prte_attribute_key_t key)
+{
+    if (NULL == attributes->index || key < attributes->base ||
+        key >= attributes->base + attributes->span) {
+        return NULL;
+    }
+    return &attributes->index[key - attributes->base];
+}
+
+static void attr_index_build(prte_attr_list_t *attributes)
+{
+    prte_attribute_t *kv, **slot;
+
+    if (NULL != attributes->index || 0 == attributes->span ||
+        prte_list_get_size(&attributes->super) <= PRTE_ATTR_INDEX_THRESHOLD) {
+        return;
+    }
+    attributes->index = (prte_attribute_t**)calloc(attributes->span, sizeof(prte_attribute_t*));
+    if (NULL == attributes->index) {
+        /* we can still operate off the list */
+        return;
+    }
+    PRTE_LIST_FOREACH(kv, &attributes->super, prte_attribute_t) {
+        slot = attr_slot(attributes, kv->key);
+        if (NULL != slot && NULL == *slot) {
+            *slot = kv;
+        }
+    }
+}
+
+static prte_attribute_t* attr_find(prte_attr_list_t *attributes,
+                                   prte_attribute_key_t key)
+{
+    prte_attribute_t *kv, **slot;
+
+    if (NULL != (slot = attr_slot(attributes, key))) {
+        return *slot;
+    }
+    PRTE_LIST_FOREACH(kv, &attributes->super, prte_attribute_t) {
+        if (key == kv->key) {
+            return kv;
+        }
+    }
+    return NULL;
+}
+
+static void attr_remove(prte_attr_list_t *attributes,
+                        prte_attribute_t *kv)
+{
+    prte_attribute_t **slot, *next, *end;
+
+    /* if this was the first entry for its key, then point
+     * the index at the next one on the list, if any */
+    slot = attr_slot(attributes, kv->key);
+    if (NULL != slot && kv == *slot) {
+        *slot = NULL;
+        end = (prte_attribute_t*)prte_list_get_end(&attributes->super);
+        next = (prte_attribute_t*)prte_list_get_next(&kv->super);
+        while (NULL != next && end != next) {
+            if (next->key == kv->key) {
+                *slot = next;
+                break;
+            }
+            next = (prte_attribute_t*)prte_list_get_next(&next->super);
+        }
+    }
+    prte_list_remove_item(&attributes->super, &kv->super);
+}
+
+void prte_attr_list_init(prte_attr_list_t *attributes,
+                         prte_attribute_key_t key_base,
+                         prte_attribute_key_t key_max)
+{
+    if (NULL != attributes->index) {
+        free(attributes->index);
+        attributes->index = NULL;
+    }
+    attributes->base = key_base;
+    attributes->span = key_max - key_base;
+    attr_index_build(attributes);
+}
+
+void prte_attr_list_append(prte_attr_list_t *attributes,
+                           prte_attribute_t *kv)
+{
+    prte_attribute_t **slot;
+
+    prte_list_append(&attributes->super, &kv->super);
+    if (NULL == attributes->index) {
+        attr_index_build(attributes);
+    } else if (NULL != (slot = attr_slot(attributes, kv->key)) && NULL == *slot) {
+        *slot = kv;
+    }
+}
+
+bool prte_get_attribute(prte_attr_list_t *attributes,
                         prte_attribute_key_t key,
                         void **data, pmix_data_type_t type)
 {
     prte_attribute_t *kv;
     int rc;
 
-    PRTE_LIST_FOREACH(kv, attributes, prte_attribute_t) {
-        if (key == kv->key) {
-            if (kv->data.type != type) {
-                PRTE_ERROR_LOG(PRTE_ERR_TYPE_MISMATCH);
-                return false;
-            }
-            if (NULL != data) {
-                if (PRTE_SUCCESS != (rc = prte_attr_unload(kv, data, type))) {
-                    PRTE_ERROR_LOG(rc);
-                }
-            }
-            return true;
+    if (NULL == (kv = attr_find(attributes, key))) {
+        /* not found */
+        return false;
+    }
+    if (kv->data.type != type) {
+        PRTE_ERROR_LOG(PRTE_ERR_TYPE_MISMATCH);
+        return false;
+    }
+    if (NULL != data) {
+        if (PRTE_SUCCESS != (rc = prte_attr_unload(kv, data, type))) {
+            PRTE_ERROR_LOG(rc);
         }
     }
-    /* not found */
-    return false;
+    return true;
 }
 
-int prte_set_attribute(prte_list_t *attributes,
+int prte_set_attribute(prte_attr_list_t *attributes,
                        prte_attribute_key_t key, bool local,
                        void *data, pmix_data_type_t type)
 {
     prte_attribute_t *kv;
     int rc;
 
-    PRTE_LIST_FOREACH(kv, attributes, prte_attribute_t) {
-        if (key == kv->key) {
-            if (kv->data.type != type) {
-                return PRTE_ERR_TYPE_MISMATCH;
-            }
-            if (PRTE_SUCCESS != (rc = prte_attr_load(kv, data, type))) {
-                PRTE_ERROR_LOG(rc);
-            }
-            return rc;
+    if (NULL != (kv = attr_find(attributes, key))) {
+        if (kv->data.type != type) {
+            return PRTE_ERR_TYPE_MISMATCH;
+        }
+        if (PRTE_SUCCESS != (rc = prte_attr_load(kv, data, type))) {
+            PRTE_ERROR_LOG(rc);
         }
-    }
-    /* not found - add it */
-    kv = PRTE_NEW(prte_attribute_t);
-    kv->key = key;
-    kv->local = local;
-    if (PRTE_SUCCESS != (rc = prte_attr_load(kv, data, type))) {
-        PRTE_RELEASE(kv);
         return rc;
     }
-    prte_list_append(attributes, &kv->super);
-    return PRTE_SUCCESS;
+    /* not found - add it */
+    return prte_add_attribute(attributes, key, local, data, type);
 }
 
-prte_attribute_t* prte_fetch_attribute(prte_list_t *attributes,
+prte_attribute_t* prte_fetch_attribute(prte_attr_list_t *attributes,
                                        prte_attribute_t *prev,
                                        prte_attribute_key_t key)
 {
-    prte_attribute_t *kv, *end, *next;
+    prte_attribute_t *end, *next;
 
     /* if prev is NULL, then find the first attr on the list
      * that matches the key */
     if (NULL == prev) {
-        PRTE_LIST_FOREACH(kv, attributes, prte_attribute_t) {
-            if (key == kv->key) {
-                return kv;
-            }
-        }
-        /* if we get, then the key isn't on the list */
-        return NULL;
+        return attr_find(attributes, key);
     }
 
     /* if we are at the end of the list, then nothing to do */
-    end = (prte_attribute_t*)prte_list_get_end(attributes);
+    end = (prte_attribute_t*)prte_list_get_end(&attributes->super);
     if (prev == end || end == (prte_attribute_t*)prte_list_get_next(&prev->super) ||
         NULL == prte_list_get_next(&prev->super)) {
         return NULL;
@@ -132,7 +212,7 @@ prte_attribute_t* prte_fetch_attribute(prte_list_t *attributes,
     return NULL;
 }
 
-int prte_add_attribute(prte_list_t *attributes,
+int prte_add_attribute(prte_attr_list_t *attributes,
                        prte_attribute_key_t key, bool local,
                        void *data, pmix_data_type_t type)
 {
@@ -146,15 +226,15 @@ int prte_add_attribute(prte_list_t *attributes,
         PRTE_RELEASE(kv);
         return rc;
     }
-    prte_list_append(attributes, &kv->super);
+    prte_attr_list_append(attributes, kv);
     return PRTE_SUCCESS;
 }
 
-int prte_prepend_attribute(prte_list_t *attributes,
+int prte_prepend_attribute(prte_attr_list_t *attributes,
                            prte_attribute_key_t key, bool local,
                            void *data, pmix_data_type_t type)
 {
-    prte_attribute_t *kv;
+    prte_attribute_t *kv, **slot;
     int rc;
 
     kv = PRTE_NEW(prte_attribute_t);
@@ -164,20 +244,23 @@ int prte_prepend_attribute(prte_list_t *attributes,
         PRTE_RELEASE(kv);
         return rc;
     }
-    prte_list_prepend(attributes, &kv->super);
+    prte_list_prepend(&attributes->super, &kv->super);
+    if (NULL == attributes->index) {
+        attr_index_build(attributes);
+    } else if (NULL != (slot = attr_slot(attributes, key))) {
+        /* we are now the first entry for this key */
+        *slot = kv;
+    }
     return PRTE_SUCCESS;
 }
 
-void prte_remove_attribute(prte_list_t *attributes, prte_attribute_key_t key)
+void prte_remove_attribute(prte_attr_list_t *attributes, prte_attribute_key_t key)
 {
     prte_attribute_t *kv;
 
-    PRTE_LIST_FOREACH(kv, attributes, prte_attribute_t) {
-        if (key == kv->key) {
-            prte_list_remove_item(attributes, &kv->super);
-            PRTE_RELEASE(kv);
-            return;
-        }
+    if (NULL != (kv = attr_find(attributes, key))) {
+        attr_remove(attributes, kv);
+        PRTE_RELEASE(kv);
     }
 }
 
@@ -204,12 +287,12 @@ int prte_attr_register(const char *project,
     return PRTE_ERR_OUT_OF_RESOURCE;
 }
 
-char *prte_attr_print_list(prte_list_t *attributes)
+char *prte_attr_print_list(prte_attr_list_t *attributes)
 {
     char *out1, **cache = NULL;
     prte_attribute_t *attr;
 
-    PRTE_LIST_FOREACH(attr, attributes, prte_attribute_t) {
+    PRTE_LIST_FOREACH(attr, &attributes->super, prte_attribute_t) {
         prte_argv_append_nosize(&cache, prte_attr_key_to_str(attr->key));
     }
     if (NULL != cache) {
@@ -449,6 +532,8 @@ const char *prte_attr_key_to_str(prte_attribute_key_t key)
             return "JOB_NOINHERIT";
         case PRTE_JOB_FILE:
             return "JOB-FILE";
+        case PRTE_JOB_CATALOG_VERSION:
+            return "JOB-CATALOG-VERSION";
 
         case PRTE_PROC_NOBARRIER:
             return "PROC-NOBARRIER";
@@ -810,3 +895,24 @@ int prte_attr_unload(prte_attribute_t *kv,
     }
     return PRTE_SUCCESS;
 }
+
+static void prte_attr_list_cons(prte_attr_list_t *p)
+{
+    p->base = 0;
+    p->span = 0;
+    p->index = NULL;
+}
+static void prte_attr_list_des(prte_attr_list_t *p)
+{
+    prte_list_item_t *item;
+
+    while (NULL != (item = prte_list_remove_first(&p->super))) {
+        PRTE_RELEASE(item);
+    }
+    if (NULL != p->index) {
+        free(p->index);
+    }
+}
+PRTE_CLASS_INSTANCE(prte_attr_list_t,
+                   prte_list_t,
+                   prte_attr_list_cons, prte_attr_list_des);
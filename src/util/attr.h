@@ -17,6 +17,9 @@
 #include "prte_config.h"
 #include "types.h"
 
+#include "src/class/prte_list.h"
+#include "src/pmix/pmix-internal.h"
+
 /*** FLAG FOR SETTING ATTRIBUTES - INDICATES IF THE
  *** ATTRIBUTE IS TO BE SHARED WITH REMOTE PROCS OR NOT
  */
@@ -188,6 +191,7 @@ typedef uint16_t prte_job_flags_t;
 #define PRTE_JOB_PPR                    (PRTE_JOB_START_KEY + 81)    // char* - string specifying the procs-per-resource pattern
 #define PRTE_JOB_NOINHERIT              (PRTE_JOB_START_KEY + 82)    // bool do NOT inherit parent's mapping/ranking/binding policies
 #define PRTE_JOB_FILE                   (PRTE_JOB_START_KEY + 83)    // char* - file to use for sequential or rankfile mapping
+#define PRTE_JOB_CATALOG_VERSION        (PRTE_JOB_START_KEY + 84)    // uint32_t - version of the job catalog at which this job was launched
 
 #define PRTE_JOB_MAX_KEY   300
 
@@ -246,6 +250,27 @@ typedef uint16_t prte_proc_flags_t;
 #define PRTE_ATTR_KEY_MAX  1000
 
 
+/*** ATTRIBUTE CONTAINER ***/
+/* The attributes on the app, node, job and proc objects are kept on
+ * an ordered list so they can be walked and packed in the order they
+ * were added. Each object type also owns a block of keys (e.g., from
+ * PRTE_JOB_START_KEY to PRTE_JOB_MAX_KEY for a job), and lookups
+ * within that block go through a dense table pointing at the first
+ * matching entry on the list. Keys outside the block fall back to
+ * scanning the list. Most procs carry only a few attributes, so the
+ * table is not allocated until the list holds more than
+ * PRTE_ATTR_INDEX_THRESHOLD entries */
+#define PRTE_ATTR_INDEX_THRESHOLD   8
+
+typedef struct {
+    prte_list_t super;
+    prte_attribute_key_t base;      // first key of the indexed block
+    prte_attribute_key_t span;      // number of keys in the indexed block
+    prte_attribute_t **index;       // first entry on the list for each key in the block
+} prte_attr_list_t;
+PRTE_EXPORT PRTE_CLASS_DECLARATION(prte_attr_list_t);
+
+
 /*** FLAG OPS ***/
 #define PRTE_FLAG_SET(p, f)         ((p)->flags |= (f))
 #define PRTE_FLAG_UNSET(p, f)       ((p)->flags &= ~(f))
@@ -253,26 +278,35 @@ typedef uint16_t prte_proc_flags_t;
 
 PRTE_EXPORT const char *prte_attr_key_to_str(prte_attribute_key_t key);
 
+/* Define the block of keys to be indexed in the given container */
+PRTE_EXPORT void prte_attr_list_init(prte_attr_list_t *attributes,
+                                     prte_attribute_key_t key_base,
+                                     prte_attribute_key_t key_max);
+
+/* Append an already-loaded attribute to a container */
+PRTE_EXPORT void prte_attr_list_append(prte_attr_list_t *attributes,
+                                       prte_attribute_t *kv);
+
 /* Retrieve the named attribute from a list */
-PRTE_EXPORT bool prte_get_attribute(prte_list_t *attributes, prte_attribute_key_t key,
+PRTE_EXPORT bool prte_get_attribute(prte_attr_list_t *attributes, prte_attribute_key_t key,
                                       void **data, pmix_data_type_t type);
 
 /* Set the named attribute in a list, overwriting any prior entry */
-PRTE_EXPORT int prte_set_attribute(prte_list_t *attributes, prte_attribute_key_t key,
+PRTE_EXPORT int prte_set_attribute(prte_attr_list_t *attributes, prte_attribute_key_t key,
                                      bool local, void *data, pmix_data_type_t type);
 
 /* Remove the named attribute from a list */
-PRTE_EXPORT void prte_remove_attribute(prte_list_t *attributes, prte_attribute_key_t key);
+PRTE_EXPORT void prte_remove_attribute(prte_attr_list_t *attributes, prte_attribute_key_t key);
 
-PRTE_EXPORT prte_attribute_t* prte_fetch_attribute(prte_list_t *attributes,
+PRTE_EXPORT prte_attribute_t* prte_fetch_attribute(prte_attr_list_t *attributes,
                                                      prte_attribute_t *prev,
                                                      prte_attribute_key_t key);
 
-PRTE_EXPORT int prte_add_attribute(prte_list_t *attributes,
+PRTE_EXPORT int prte_add_attribute(prte_attr_list_t *attributes,
                                      prte_attribute_key_t key, bool local,
                                      void *data, pmix_data_type_t type);
 
-PRTE_EXPORT int prte_prepend_attribute(prte_list_t *attributes,
+PRTE_EXPORT int prte_prepend_attribute(prte_attr_list_t *attributes,
                                          prte_attribute_key_t key, bool local,
                                          void *data, pmix_data_type_t type);
 
@@ -282,7 +316,7 @@ PRTE_EXPORT int prte_attr_load(prte_attribute_t *kv,
 PRTE_EXPORT int prte_attr_unload(prte_attribute_t *kv,
                                    void **data, pmix_data_type_t type);
 
-PRTE_EXPORT char *prte_attr_print_list(prte_list_t *attributes);
+PRTE_EXPORT char *prte_attr_print_list(prte_attr_list_t *attributes);
 
 /*
  * Register a handler for converting attr keys to strings
@@ -33,18 +33,400 @@
 
 #include "src/util/nidmap.h"
 
-int prte_util_nidmap_create(prte_pointer_array_t *pool,
-                            pmix_data_buffer_t *buffer)
+/* The nidmap is shipped as a list of segments rather than as a list
+ * of names. Each segment covers a run of consecutive node pool
+ * indices whose names share a prefix and suffix around an
+ * incrementing number (e.g., node[0001-4096].cluster), and whose
+ * daemon vpids either increase by one or are all invalid. On a
+ * regularly-named machine this makes the map O(number of name
+ * patterns) instead of O(nodes).
+ *
+ * Every distinct state of the node pool is stamped with an epoch.
+ * When all daemons already hold the state last broadcast to them,
+ * an update carries only the segments that changed since then -
+ * added nodes, nodes that gained a daemon, and removed nodes.
+ */
+#define PRTE_NIDMAP_SEG_REMOVED     0x01    // slots no longer hold a node
+#define PRTE_NIDMAP_SEG_LITERAL     0x02    // single name with no numeric part
+#define PRTE_NIDMAP_SEG_NO_DAEMONS  0x04    // none of these nodes host a daemon
+
+/* longest run of digits we treat as a number */
+#define PRTE_NIDMAP_MAX_DIGITS  18
+
+typedef struct {
+    uint8_t flags;
+    int32_t index;
+    int32_t count;
+    char *prefix;
+    char *suffix;
+    uint8_t width;
+    uint64_t start;
+    pmix_rank_t vpid;
+} nidmap_seg_t;
+
+typedef struct {
+    char *name;         // NULL if the pool slot is empty
+    pmix_rank_t vpid;
+} nidmap_entry_t;
+
+typedef struct {
+    uint32_t epoch;
+    int nentries;
+    nidmap_entry_t *entries;
+    pmix_rank_t ndaemons;
+} nidmap_state_t;
+
+/* the most recent state of the pool we stamped with an epoch, and
+ * the state that was last broadcast to every daemon */
+static nidmap_state_t stamped = {0, 0, NULL, 0};
+static nidmap_state_t baseline = {0, 0, NULL, 0};
+/* the epoch of the map a daemon currently holds */
+static uint32_t held_epoch = 0;
+
+static void state_clear(nidmap_state_t *st)
 {
-    char *raw = NULL;
-    pmix_rank_t *vpids=NULL;
-    uint8_t u8;
-    int n, ndaemons, nbytes;
-    bool compressed;
-    char **names = NULL;
+    int n;
+
+    for (n=0; n < st->nentries; n++) {
+        if (NULL != st->entries[n].name) {
+            free(st->entries[n].name);
+        }
+    }
+    if (NULL != st->entries) {
+        free(st->entries);
+    }
+    st->entries = NULL;
+    st->nentries = 0;
+}
+
+static void state_copy(nidmap_state_t *dst, nidmap_state_t *src)
+{
+    int n;
+
+    state_clear(dst);
+    dst->epoch = src->epoch;
+    dst->ndaemons = src->ndaemons;
+    dst->nentries = src->nentries;
+    dst->entries = (nidmap_entry_t*)calloc(src->nentries, sizeof(nidmap_entry_t));
+    for (n=0; n < src->nentries; n++) {
+        if (NULL != src->entries[n].name) {
+            dst->entries[n].name = strdup(src->entries[n].name);
+        }
+        dst->entries[n].vpid = src->entries[n].vpid;
+    }
+}
+
+static bool entry_equal(nidmap_state_t *a, nidmap_state_t *b, int n)
+{
+    char *na = (n < a->nentries) ? a->entries[n].name : NULL;
+    char *nb = (n < b->nentries) ? b->entries[n].name : NULL;
+
+    if (NULL == na || NULL == nb) {
+        return (na == nb);
+    }
+    return (0 == strcmp(na, nb) && a->entries[n].vpid == b->entries[n].vpid);
+}
+
+/* record the current contents of the pool, bumping the epoch if
+ * anything changed since the last time we looked */
+static void stamp_pool(prte_pointer_array_t *pool)
+{
+    nidmap_state_t cur = {0, 0, NULL, 0};
     prte_node_t *nptr;
-    pmix_byte_object_t bo;
-    size_t sz;
+    int n, max;
+    bool changed;
+
+    cur.nentries = pool->size;
+    cur.entries = (nidmap_entry_t*)calloc(pool->size, sizeof(nidmap_entry_t));
+    for (n=0; n < pool->size; n++) {
+        if (NULL == (nptr = (prte_node_t*)prte_pointer_array_get_item(pool, n))) {
+            continue;
+        }
+        cur.entries[n].name = strdup(nptr->name);
+        if (NULL == nptr->daemon) {
+            cur.entries[n].vpid = PMIX_RANK_INVALID;
+        } else {
+            cur.entries[n].vpid = nptr->daemon->name.rank;
+        }
+    }
+
+    changed = (0 == stamped.epoch);
+    max = (cur.nentries > stamped.nentries) ? cur.nentries : stamped.nentries;
+    for (n=0; !changed && n < max; n++) {
+        changed = !entry_equal(&cur, &stamped, n);
+    }
+    if (changed) {
+        cur.epoch = stamped.epoch + 1;
+        state_clear(&stamped);
+        stamped = cur;
+    } else {
+        state_clear(&cur);
+    }
+    stamped.ndaemons = prte_process_info.num_daemons;
+}
+
+/* see if any daemon in the given state is no longer where it was -
+ * a daemon that has been replaced won't hold that state, even if
+ * the number of daemons is unchanged */
+static bool daemons_moved(nidmap_state_t *st)
+{
+    int n;
+
+    for (n=0; n < st->nentries; n++) {
+        if (NULL != st->entries[n].name &&
+            PMIX_RANK_INVALID != st->entries[n].vpid &&
+            !entry_equal(st, &stamped, n)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/* split a name around its last run of digits. Returns false if the
+ * name has no usable numeric part */
+static bool parse_name(const char *name, char **prefix, char **suffix,
+                       uint8_t *width, uint64_t *num)
+{
+    const char *end, *begin;
+
+    for (end = name + strlen(name); end > name && !isdigit((unsigned char)end[-1]); end--);
+    if (end == name) {
+        return false;
+    }
+    for (begin = end; begin > name && isdigit((unsigned char)begin[-1]); begin--);
+    if (PRTE_NIDMAP_MAX_DIGITS < (end - begin)) {
+        return false;
+    }
+    *prefix = strdup(name);
+    (*prefix)[begin - name] = '\0';
+    *suffix = strdup(end);
+    *num = strtoull(begin, NULL, 10);
+    /* a leading zero means the number is padded to a fixed width */
+    if ('0' == *begin && 1 < (end - begin)) {
+        *width = (uint8_t)(end - begin);
+    } else {
+        *width = 0;
+    }
+    return true;
+}
+
+static bool seg_name(nidmap_seg_t *seg, int32_t k, char *name, size_t len)
+{
+    int rc;
+
+    if (PRTE_NIDMAP_SEG_LITERAL & seg->flags) {
+        rc = snprintf(name, len, "%s", seg->prefix);
+    } else {
+        rc = snprintf(name, len, "%s%0*" PRIu64 "%s", seg->prefix,
+                      (int)seg->width, seg->start + (uint64_t)k, seg->suffix);
+    }
+    return (0 <= rc && (size_t)rc < len);
+}
+
+/* see if the node at pool index idx continues the given segment */
+static bool seg_extends(nidmap_seg_t *seg, int idx, const char *name, pmix_rank_t vpid)
+{
+    char expected[PRTE_MAXHOSTNAMELEN];
+
+    if (idx != seg->index + seg->count ||
+        ((PRTE_NIDMAP_SEG_REMOVED | PRTE_NIDMAP_SEG_LITERAL) & seg->flags)) {
+        return false;
+    }
+    if (PRTE_NIDMAP_SEG_NO_DAEMONS & seg->flags) {
+        if (PMIX_RANK_INVALID != vpid) {
+            return false;
+        }
+    } else if (vpid != seg->vpid + (pmix_rank_t)seg->count) {
+        return false;
+    }
+    if (!seg_name(seg, seg->count, expected, sizeof(expected))) {
+        return false;
+    }
+    return (0 == strcmp(expected, name));
+}
+
+static void seg_free(nidmap_seg_t *segs, int32_t nsegs)
+{
+    int n;
+
+    for (n=0; n < nsegs; n++) {
+        if (NULL != segs[n].prefix) {
+            free(segs[n].prefix);
+        }
+        if (NULL != segs[n].suffix) {
+            free(segs[n].suffix);
+        }
+    }
+    free(segs);
+}
+
+/* encode every entry of the stamped state that differs from the
+ * given base - or all of them if there is no base */
+static int build_segments(nidmap_state_t *base, nidmap_seg_t **segsout, int32_t *nsegsout)
+{
+    nidmap_seg_t *segs = NULL, *seg = NULL, *tmp;
+    int32_t nsegs = 0, nalloc = 0;
+    int n, max;
+    nidmap_entry_t *ent;
+
+    max = stamped.nentries;
+    if (NULL != base && base->nentries > max) {
+        max = base->nentries;
+    }
+    for (n=0; n < max; n++) {
+        if (NULL == base) {
+            if (n >= stamped.nentries || NULL == stamped.entries[n].name) {
+                continue;
+            }
+        } else if (entry_equal(&stamped, base, n)) {
+            continue;
+        }
+        ent = (n < stamped.nentries) ? &stamped.entries[n] : NULL;
+        if (NULL == ent || NULL == ent->name) {
+            /* the node was removed */
+            if (NULL != seg && (PRTE_NIDMAP_SEG_REMOVED & seg->flags) &&
+                n == seg->index + seg->count) {
+                seg->count++;
+                continue;
+            }
+        } else if (NULL != seg && seg_extends(seg, n, ent->name, ent->vpid)) {
+            seg->count++;
+            continue;
+        }
+        /* start a new segment */
+        if (nsegs == nalloc) {
+            nalloc = (0 == nalloc) ? 8 : 2 * nalloc;
+            tmp = (nidmap_seg_t*)realloc(segs, nalloc * sizeof(nidmap_seg_t));
+            if (NULL == tmp) {
+                seg_free(segs, nsegs);
+                return PRTE_ERR_OUT_OF_RESOURCE;
+            }
+            segs = tmp;
+        }
+        seg = &segs[nsegs++];
+        memset(seg, 0, sizeof(nidmap_seg_t));
+        seg->index = n;
+        seg->count = 1;
+        if (NULL == ent || NULL == ent->name) {
+            seg->flags = PRTE_NIDMAP_SEG_REMOVED;
+            continue;
+        }
+        if (!parse_name(ent->name, &seg->prefix, &seg->suffix, &seg->width, &seg->start)) {
+            seg->flags |= PRTE_NIDMAP_SEG_LITERAL;
+            seg->prefix = strdup(ent->name);
+        }
+        if (PMIX_RANK_INVALID == ent->vpid) {
+            seg->flags |= PRTE_NIDMAP_SEG_NO_DAEMONS;
+        } else {
+            seg->vpid = ent->vpid;
+        }
+    }
+
+    *segsout = segs;
+    *nsegsout = nsegs;
+    return PRTE_SUCCESS;
+}
+
+static int pack_segment(pmix_data_buffer_t *buffer, nidmap_seg_t *seg)
+{
+    pmix_status_t rc;
+
+    rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buffer, &seg->flags, 1, PMIX_UINT8);
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
+    rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buffer, &seg->index, 1, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
+    rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buffer, &seg->count, 1, PMIX_INT32);
+    if (PMIX_SUCCESS != rc || (PRTE_NIDMAP_SEG_REMOVED & seg->flags)) {
+        return rc;
+    }
+    rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buffer, &seg->prefix, 1, PMIX_STRING);
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
+    if (!(PRTE_NIDMAP_SEG_LITERAL & seg->flags)) {
+        rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buffer, &seg->suffix, 1, PMIX_STRING);
+        if (PMIX_SUCCESS != rc) {
+            return rc;
+        }
+        rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buffer, &seg->width, 1, PMIX_UINT8);
+        if (PMIX_SUCCESS != rc) {
+            return rc;
+        }
+        rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buffer, &seg->start, 1, PMIX_UINT64);
+        if (PMIX_SUCCESS != rc) {
+            return rc;
+        }
+    }
+    if (!(PRTE_NIDMAP_SEG_NO_DAEMONS & seg->flags)) {
+        rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buffer, &seg->vpid, 1, PMIX_PROC_RANK);
+    }
+    return rc;
+}
+
+static int unpack_segment(pmix_data_buffer_t *buf, nidmap_seg_t *seg)
+{
+    pmix_status_t rc;
+    int cnt;
+
+    memset(seg, 0, sizeof(nidmap_seg_t));
+    cnt = 1;
+    rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &seg->flags, &cnt, PMIX_UINT8);
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
+    cnt = 1;
+    rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &seg->index, &cnt, PMIX_INT32);
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
+    cnt = 1;
+    rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &seg->count, &cnt, PMIX_INT32);
+    if (PMIX_SUCCESS != rc || (PRTE_NIDMAP_SEG_REMOVED & seg->flags)) {
+        return rc;
+    }
+    cnt = 1;
+    rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &seg->prefix, &cnt, PMIX_STRING);
+    if (PMIX_SUCCESS != rc) {
+        return rc;
+    }
+    if (!(PRTE_NIDMAP_SEG_LITERAL & seg->flags)) {
+        cnt = 1;
+        rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &seg->suffix, &cnt, PMIX_STRING);
+        if (PMIX_SUCCESS != rc) {
+            return rc;
+        }
+        cnt = 1;
+        rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &seg->width, &cnt, PMIX_UINT8);
+        if (PMIX_SUCCESS != rc) {
+            return rc;
+        }
+        cnt = 1;
+        rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &seg->start, &cnt, PMIX_UINT64);
+        if (PMIX_SUCCESS != rc) {
+            return rc;
+        }
+    }
+    if (PRTE_NIDMAP_SEG_NO_DAEMONS & seg->flags) {
+        seg->vpid = PMIX_RANK_INVALID;
+    } else {
+        cnt = 1;
+        rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &seg->vpid, &cnt, PMIX_PROC_RANK);
+    }
+    return rc;
+}
+
+static int nidmap_pack(prte_pointer_array_t *pool,
+                       pmix_data_buffer_t *buffer,
+                       bool broadcast)
+{
+    uint8_t u8;
+    uint32_t base;
+    int32_t n, nsegs = 0;
+    nidmap_seg_t *segs = NULL;
     pmix_status_t rc;
 
     /* pack a flag indicating if the HNP was included in the allocation */
@@ -71,110 +453,167 @@ int prte_util_nidmap_create(prte_pointer_array_t *pool,
         return rc;
     }
 
-    /* daemon vpids start from 0 and increase linearly by one
-     * up to the number of nodes in the system. The vpid is
-     * a 32-bit value. We don't know how many of the nodes
-     * in the system have daemons - we may not be using them
-     * all just yet. However, even the largest systems won't
-     * have more than a million nodes for quite some time,
-     * so for now we'll just allocate enough space to hold
-     * them all. Someone can optimize this further later */
-    nbytes = prte_process_info.num_daemons * sizeof(pmix_rank_t);
-    vpids = (pmix_rank_t*)malloc(nbytes);
+    stamp_pool(pool);
 
-    ndaemons = 0;
-    for (n=0; n < pool->size; n++) {
-        if (NULL == (nptr = (prte_node_t*)prte_pointer_array_get_item(pool, n))) {
-            continue;
-        }
-        /* add the hostname to the argv */
-        prte_argv_append_nosize(&names, nptr->name);
-        /* store the vpid */
-        if (NULL == nptr->daemon) {
-            vpids[ndaemons] = PMIX_RANK_INVALID;
-        } else {
-            vpids[ndaemons] = nptr->daemon->name.rank;
-        }
-        ++ndaemons;
-    }
-
-    /* construct the string of node names for compression */
-    raw = prte_argv_join(names, ',');
-    prte_argv_free(names);
-    if (PMIx_Data_compress((uint8_t*)raw, strlen(raw)+1,
-                           (uint8_t**)&bo.bytes, &sz)) {
-        /* mark that this was compressed */
-        compressed = true;
-        bo.size = sz;
-        free(raw);
+    /* we can only send the changes if every daemon that will receive
+     * this already holds the baseline - i.e., no daemons have been
+     * added, and none replaced, since it was broadcast */
+    if (broadcast && 0 < baseline.epoch &&
+        baseline.ndaemons == prte_process_info.num_daemons &&
+        !daemons_moved(&baseline)) {
+        base = baseline.epoch;
+        rc = build_segments(&baseline, &segs, &nsegs);
     } else {
-        /* mark that this was not compressed */
-        compressed = false;
-        bo.bytes = (char*)raw;
-        bo.size = strlen(raw)+1;
+        base = 0;
+        rc = build_segments(NULL, &segs, &nsegs);
     }
-    /* indicate compression */
-    rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buffer, &compressed, 1, PMIX_BOOL);
-    if (PMIX_SUCCESS != rc) {
-        PMIX_ERROR_LOG(rc);
-        free(bo.bytes);
-        free(vpids);
+    if (PRTE_SUCCESS != rc) {
+        PRTE_ERROR_LOG(rc);
         return rc;
     }
-    /* add the object */
-    rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buffer, &bo, 1, PMIX_BYTE_OBJECT);
+
+    /* pack the epoch of this map and the one it updates */
+    rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buffer, &stamped.epoch, 1, PMIX_UINT32);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
-        free(bo.bytes);
-        free(vpids);
-        return rc;
-    }
-    free(bo.bytes);
-
-    /* compress the vpids */
-    if (PMIx_Data_compress((uint8_t*)vpids, nbytes,
-                           (uint8_t**)&bo.bytes, &sz)) {
-        /* mark that this was compressed */
-        compressed = true;
-        bo.size = sz;
-        free(vpids);
-    } else {
-        /* mark that this was not compressed */
-        compressed = false;
-        bo.bytes = (char*)vpids;
-        bo.size = nbytes*ndaemons;
+        goto cleanup;
     }
-    /* indicate compression */
-    rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buffer, &compressed, 1, PMIX_BOOL);
+    rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buffer, &base, 1, PMIX_UINT32);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
-        free(bo.bytes);
-        return rc;
+        goto cleanup;
     }
-    /* add the object */
-    rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buffer, &bo, 1, PMIX_BYTE_OBJECT);
+    rc = PMIx_Data_pack(PRTE_PROC_MY_NAME, buffer, &nsegs, 1, PMIX_INT32);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
-        free(bo.bytes);
-        return rc;
+        goto cleanup;
+    }
+    for (n=0; n < nsegs; n++) {
+        if (PMIX_SUCCESS != (rc = pack_segment(buffer, &segs[n]))) {
+            PMIX_ERROR_LOG(rc);
+            goto cleanup;
+        }
+    }
+
+    if (broadcast) {
+        state_copy(&baseline, &stamped);
     }
-    free(bo.bytes);
 
+  cleanup:
+    if (NULL != segs) {
+        seg_free(segs, nsegs);
+    }
     return rc;
 }
 
+int prte_util_nidmap_create(prte_pointer_array_t *pool,
+                            pmix_data_buffer_t *buffer)
+{
+    return nidmap_pack(pool, buffer, false);
+}
+
+int prte_util_nidmap_update(prte_pointer_array_t *pool,
+                            pmix_data_buffer_t *buffer)
+{
+    return nidmap_pack(pool, buffer, true);
+}
+
+void prte_util_nidmap_finalize(void)
+{
+    state_clear(&stamped);
+    state_clear(&baseline);
+    stamped.epoch = 0;
+    baseline.epoch = 0;
+    held_epoch = 0;
+}
+
+/* break the link between a node and the daemon that was on it */
+static void drop_daemon(prte_node_t *nd)
+{
+    prte_proc_t *proc = nd->daemon;
+
+    nd->daemon = NULL;
+    if (proc->node == nd) {
+        proc->node = NULL;
+        PRTE_RELEASE(nd);
+    }
+    PRTE_RELEASE(proc);
+}
+
+static void add_node(int n, const char *name, pmix_rank_t vpid,
+                     prte_job_t *daemons, prte_topology_t *t)
+{
+    prte_node_t *nd;
+    prte_proc_t *proc;
+    char *raw;
+
+    nd = (prte_node_t*)prte_pointer_array_get_item(prte_node_pool, n);
+    if (NULL != nd && 0 != strcmp(nd->name, name)) {
+        /* this slot now holds a different node */
+        if (NULL != nd->daemon) {
+            drop_daemon(nd);
+        }
+        prte_pointer_array_set_item(prte_node_pool, n, NULL);
+        PRTE_RELEASE(nd);
+        nd = NULL;
+    }
+    if (NULL == nd) {
+        /* add this name to the pool */
+        nd = PRTE_NEW(prte_node_t);
+        nd->name = strdup(name);
+        nd->index = n;
+        prte_pointer_array_set_item(prte_node_pool, n, nd);
+        /* see if this is our node */
+        if (prte_check_host_is_local(name)) {
+            /* add our aliases as an attribute - will include all the interface aliases captured in prte_init */
+            raw = prte_argv_join(prte_process_info.aliases, ',');
+            prte_set_attribute(&nd->attributes, PRTE_NODE_ALIAS, PRTE_ATTR_LOCAL, raw, PMIX_STRING);
+            free(raw);
+        }
+        /* set the topology - always default to homogeneous
+         * as that is the most common scenario */
+        nd->topology = t;
+    }
+    /* the daemon we knew of on this node may have been replaced */
+    if (NULL != nd->daemon && nd->daemon->name.rank != vpid) {
+        drop_daemon(nd);
+    }
+    /* see if it has a daemon on it */
+    if (PMIX_RANK_INVALID != vpid && NULL == nd->daemon) {
+        if (NULL == (proc = (prte_proc_t*)prte_pointer_array_get_item(daemons->procs, vpid))) {
+            proc = PRTE_NEW(prte_proc_t);
+            PMIX_LOAD_PROCID(&proc->name, PRTE_PROC_MY_NAME->nspace, vpid);
+            proc->state = PRTE_PROC_STATE_RUNNING;
+            PRTE_FLAG_SET(proc, PRTE_PROC_FLAG_ALIVE);
+            daemons->num_procs++;
+            prte_pointer_array_set_item(daemons->procs, proc->name.rank, proc);
+        } else if (NULL != proc->node) {
+            /* this daemon has moved here from another node */
+            if (proc->node->daemon == proc) {
+                drop_daemon(proc->node);
+            } else {
+                PRTE_RELEASE(proc->node);
+                proc->node = NULL;
+            }
+        }
+        PRTE_RETAIN(nd);
+        proc->node = nd;
+        PRTE_RETAIN(proc);
+        nd->daemon = proc;
+    }
+}
+
 int prte_util_decode_nidmap(pmix_data_buffer_t *buf)
 {
     uint8_t u8;
-    pmix_rank_t *vpid = NULL;
-    int cnt, n;
-    bool compressed;
-    size_t sz;
-    pmix_byte_object_t pbo;
-    char *raw = NULL, **names = NULL;
+    int cnt;
+    int32_t n, k, nsegs;
+    uint32_t epoch, base;
+    bool apply;
+    char name[PRTE_MAXHOSTNAMELEN];
+    nidmap_seg_t seg;
     prte_node_t *nd;
-    prte_job_t *daemons;
-    prte_proc_t *proc;
+    prte_job_t *daemons = NULL;
     prte_topology_t *t = NULL;
     pmix_status_t rc;
 
@@ -183,7 +622,7 @@ int prte_util_decode_nidmap(pmix_data_buffer_t *buf)
     rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &u8, &cnt, PMIX_UINT8);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
-        goto cleanup;
+        return rc;
     }
     if (1 == u8) {
         prte_hnp_is_allocated = true;
@@ -196,7 +635,7 @@ int prte_util_decode_nidmap(pmix_data_buffer_t *buf)
     rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &u8, &cnt, PMIX_UINT8);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
-        goto cleanup;
+        return rc;
     }
     if (1 == u8) {
         prte_managed_allocation = true;
@@ -204,145 +643,96 @@ int prte_util_decode_nidmap(pmix_data_buffer_t *buf)
         prte_managed_allocation = false;
     }
 
-    /* unpack compression flag for node names */
+    /* unpack the epochs */
     cnt = 1;
-    rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &compressed, &cnt, PMIX_BOOL);
+    rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &epoch, &cnt, PMIX_UINT32);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
-        goto cleanup;
-    }
-
-    /* unpack the nodename object */
-    cnt = 1;
-    rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &pbo, &cnt, PMIX_BYTE_OBJECT);
-    if (PMIX_SUCCESS != rc) {
-        PMIX_ERROR_LOG(rc);
-        goto cleanup;
-    }
-
-    /* if compressed, decompress */
-    if (compressed) {
-        if (!PMIx_Data_decompress((uint8_t**)&raw, &sz,
-                                  (uint8_t*)pbo.bytes, pbo.size)) {
-            PRTE_ERROR_LOG(PRTE_ERROR);
-            PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
-            rc = PRTE_ERROR;
-            goto cleanup;
-        }
-    } else {
-        raw = (char*)pbo.bytes;
-        pbo.bytes = NULL; // protect the data
-        pbo.size = 0;
+        return rc;
     }
-    PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
-    names = prte_argv_split(raw, ',');
-    free(raw);
-
-
-    /* unpack compression flag for daemon vpids */
     cnt = 1;
-    rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &compressed, &cnt, PMIX_BOOL);
+    rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &base, &cnt, PMIX_UINT32);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
-        goto cleanup;
+        return rc;
     }
-
-    /* unpack the vpid object */
     cnt = 1;
-    rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &pbo, &cnt, PMIX_BYTE_OBJECT);
+    rc = PMIx_Data_unpack(PRTE_PROC_MY_NAME, buf, &nsegs, &cnt, PMIX_INT32);
     if (PMIX_SUCCESS != rc) {
         PMIX_ERROR_LOG(rc);
-        goto cleanup;
+        return rc;
     }
 
-    /* if compressed, decompress */
-    if (compressed) {
-        if (!PMIx_Data_decompress((uint8_t**)&vpid, &sz,
-                                  (uint8_t*)pbo.bytes, pbo.size)) {
-            PRTE_ERROR_LOG(PRTE_ERROR);
-            PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
-            rc = PRTE_ERROR;
-            goto cleanup;
+    /* if we are the HNP, we don't need any of this stuff. Otherwise,
+     * we can apply a full map at any time, but an update only on
+     * top of the map it was generated against. Nothing needs to be
+     * done if we already hold this epoch */
+    apply = false;
+    if (!PRTE_PROC_IS_MASTER && epoch != held_epoch) {
+        if (0 != base && base != held_epoch) {
+            PRTE_ERROR_LOG(PRTE_ERR_COMM_FAILURE);
+            return PRTE_ERR_COMM_FAILURE;
+        }
+        apply = true;
+        /* get the daemon job object */
+        daemons = prte_get_job_data_object(PRTE_PROC_MY_NAME->nspace);
+        /* get our topology */
+        t = (prte_topology_t*)prte_pointer_array_get_item(prte_node_topologies, 0);
+        if (NULL == t) {
+            /* should never happen */
+            PRTE_ERROR_LOG(PRTE_ERR_NOT_FOUND);
+            return PRTE_ERR_NOT_FOUND;
         }
-    } else {
-        vpid = (pmix_rank_t*)pbo.bytes;
-        sz = pbo.size;
-        pbo.bytes = NULL;
-        pbo.size = 0;
-    }
-    PMIX_BYTE_OBJECT_DESTRUCT(&pbo);
-
-    /* if we are the HNP, we don't need any of this stuff */
-    if (PRTE_PROC_IS_MASTER) {
-        rc = PRTE_SUCCESS;
-        goto cleanup;
     }
 
-    /* get the daemon job object */
-    daemons = prte_get_job_data_object(PRTE_PROC_MY_NAME->nspace);
-
-    /* get our topology */
-    t = (prte_topology_t*)prte_pointer_array_get_item(prte_node_topologies, 0);
-    if (NULL == t) {
-        /* should never happen */
-        PRTE_ERROR_LOG(PRTE_ERR_NOT_FOUND);
-        rc = PRTE_ERR_NOT_FOUND;
-        goto cleanup;
-    }
-    /* create the node pool array - this will include
-     * _all_ nodes known to the allocation */
-    for (n=0; NULL != names[n]; n++) {
-        /* do we already have this node? */
-        if (NULL != prte_pointer_array_get_item(prte_node_pool, n)) {
-            continue;
-        }
-        /* add this name to the pool */
-        nd = PRTE_NEW(prte_node_t);
-        nd->name = strdup(names[n]);
-        nd->index = n;
-        prte_pointer_array_set_item(prte_node_pool, n, nd);
-        /* see if this is our node */
-        if (prte_check_host_is_local(names[n])) {
-            /* add our aliases as an attribute - will include all the interface aliases captured in prte_init */
-            raw = prte_argv_join(prte_process_info.aliases, ',');
-            prte_set_attribute(&nd->attributes, PRTE_NODE_ALIAS, PRTE_ATTR_LOCAL, raw, PMIX_STRING);
-            free(raw);
+    /* process the segments as we unpack them - we still have to
+     * consume them even if we won't apply them */
+    for (n=0; n < nsegs; n++) {
+        if (PMIX_SUCCESS != (rc = unpack_segment(buf, &seg))) {
+            PMIX_ERROR_LOG(rc);
+            return rc;
         }
-        /* set the topology - always default to homogeneous
-         * as that is the most common scenario */
-        nd->topology = t;
-        /* see if it has a daemon on it */
-        if (PMIX_RANK_INVALID != vpid[n]) {
-            if (NULL == (proc = (prte_proc_t*)prte_pointer_array_get_item(daemons->procs, vpid[n]))) {
-                proc = PRTE_NEW(prte_proc_t);
-                PMIX_LOAD_PROCID(&proc->name, PRTE_PROC_MY_NAME->nspace, vpid[n]);
-                proc->state = PRTE_PROC_STATE_RUNNING;
-                PRTE_FLAG_SET(proc, PRTE_PROC_FLAG_ALIVE);
-                daemons->num_procs++;
-                prte_pointer_array_set_item(daemons->procs, proc->name.rank, proc);
+        for (k=0; apply && k < seg.count; k++) {
+            if (PRTE_NIDMAP_SEG_REMOVED & seg.flags) {
+                if (NULL != (nd = (prte_node_t*)prte_pointer_array_get_item(prte_node_pool, seg.index + k))) {
+                    if (NULL != nd->daemon) {
+                        drop_daemon(nd);
+                    }
+                    prte_pointer_array_set_item(prte_node_pool, seg.index + k, NULL);
+                    PRTE_RELEASE(nd);
+                }
+                continue;
+            }
+            if (!seg_name(&seg, k, name, sizeof(name))) {
+                rc = PRTE_ERR_BAD_PARAM;
+                break;
             }
-            PRTE_RETAIN(nd);
-            proc->node = nd;
-            PRTE_RETAIN(proc);
-            nd->daemon = proc;
+            add_node(seg.index + k, name, (PMIX_RANK_INVALID == seg.vpid) ? seg.vpid : seg.vpid + k,
+                     daemons, t);
+        }
+        if (NULL != seg.prefix) {
+            free(seg.prefix);
+        }
+        if (NULL != seg.suffix) {
+            free(seg.suffix);
+        }
+        if (PRTE_SUCCESS != rc) {
+            PRTE_ERROR_LOG(rc);
+            return rc;
         }
     }
 
-    /* update num procs */
-    if (prte_process_info.num_daemons != daemons->num_procs) {
-        prte_process_info.num_daemons = daemons->num_procs;
+    if (apply) {
+        held_epoch = epoch;
+        /* update num procs */
+        if (prte_process_info.num_daemons != daemons->num_procs) {
+            prte_process_info.num_daemons = daemons->num_procs;
+        }
+        /* need to update the routing plan */
+        prte_routed.update_routing_plan();
     }
-    /* need to update the routing plan */
-    prte_routed.update_routing_plan();
 
-  cleanup:
-    if (NULL != vpid) {
-        free(vpid);
-    }
-    if (NULL != names) {
-        prte_argv_free(names);
-    }
-    return rc;
+    return PRTE_SUCCESS;
 }
 
 int prte_util_pass_node_info(pmix_data_buffer_t *buffer)
@@ -652,7 +1042,7 @@ int prte_util_parse_node_info(pmix_data_buffer_t *buf)
     int8_t i8;
     int16_t i16;
     int32_t ntopos;
-    bool compressed, found;
+    bool compressed;
     int rc = PRTE_SUCCESS, cnt, n, m;
     prte_node_t *nptr;
     size_t sz;
@@ -746,20 +1136,8 @@ int prte_util_parse_node_info(pmix_data_buffer_t *buf)
             topo = ptopo.topology;
             ptopo.topology = NULL;
             PMIX_TOPOLOGY_DESTRUCT(&ptopo);
-            /* see if we already have it - there aren't many topologies
-             * in a cluster, so this won't take long */
-            found = false;
-            for (m=0; m < prte_node_topologies->size; m++) {
-                t3 = (prte_topology_t*)prte_pointer_array_get_item(prte_node_topologies, m);
-                if (NULL == t3) {
-                    continue;
-                }
-                if (0 == strcmp(sig, t3->sig)) {
-                    found = true;
-                    break;
-                }
-            }
-            if (found) {
+            /* see if we already have it */
+            if (NULL != prte_get_topology(sig)) {
                 hwloc_topology_destroy(topo);
                 free(sig);
             } else {
@@ -772,7 +1150,7 @@ int prte_util_parse_node_info(pmix_data_buffer_t *buf)
                 root->userdata = (void*)PRTE_NEW(prte_hwloc_topo_data_t);
                 sum = (prte_hwloc_topo_data_t*)root->userdata;
                 sum->available = prte_hwloc_base_setup_summary(topo);
-                t2->index = prte_pointer_array_add(prte_node_topologies, t2);
+                prte_add_topology(t2);
             }
         }
         PMIX_DATA_BUFFER_DESTRUCT(&bucket);
@@ -836,15 +1214,8 @@ int prte_util_parse_node_info(pmix_data_buffer_t *buf)
             sig = topos[m];
             /* find that signature in our topologies - might be at a
              * different location */
-            for (m=0; m < prte_node_topologies->size; m++) {
-                t3 = (prte_topology_t*)prte_pointer_array_get_item(prte_node_topologies, m);
-                if (NULL == t3) {
-                    continue;
-                }
-                if (0 == strcmp(sig, t3->sig)) {
-                    nptr->topology = t3;
-                    break;
-                }
+            if (NULL != (t3 = prte_get_topology(sig))) {
+                nptr->topology = t3;
             }
             /* unpack the next daemon rank */
             cnt = 1;
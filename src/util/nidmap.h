@@ -34,8 +34,16 @@
 PRTE_EXPORT int prte_util_nidmap_create(prte_pointer_array_t *pool,
                                           pmix_data_buffer_t *buf);
 
+/* same as create, but for a map being sent to every daemon - only
+ * the changes since the last such map are included if all daemons
+ * are known to hold it */
+PRTE_EXPORT int prte_util_nidmap_update(prte_pointer_array_t *pool,
+                                        pmix_data_buffer_t *buf);
+
 PRTE_EXPORT int prte_util_decode_nidmap(pmix_data_buffer_t *buf);
 
+PRTE_EXPORT void prte_util_nidmap_finalize(void);
+
 
 /* pass topology and #slots info */
 PRTE_EXPORT int prte_util_pass_node_info(pmix_data_buffer_t *buf);
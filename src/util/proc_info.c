@@ -157,7 +157,7 @@ void prte_setup_hostname(void)
 
 }
 
-bool prte_check_host_is_local(char *name)
+bool prte_check_host_is_local(const char *name)
 {
     int i;
 